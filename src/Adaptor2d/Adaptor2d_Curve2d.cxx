@@ -184,6 +184,37 @@ void Adaptor2d_Curve2d::D1(const Standard_Real ,
 }
 
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor2d_Curve2d::D0Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt2d&       thePoints) const
+{
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    D0 (theParams (i), thePoints (i));
+  }
+}
+
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor2d_Curve2d::D1Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt2d&       thePoints,
+                                 TColgp_Array1OfVec2d&       theD1) const
+{
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    D1 (theParams (i), thePoints (i), theD1 (i));
+  }
+}
+
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec2d.hxx>
 #include <Standard_Boolean.hxx>
 #include <GeomAbs_CurveType.hxx>
 class Standard_OutOfRange;
@@ -102,6 +104,19 @@ public:
   //! is not C1.
   Standard_EXPORT virtual void D1 (const Standard_Real U, gp_Pnt2d& P, gp_Vec2d& V) const;
   
+  //! Computes the points of parameters <theParams> on the curve:
+  //! thePoints(i) receives the point of parameter theParams(i),
+  //! thus the bounds of <thePoints> must be the ones of <theParams>.
+  //! Parameters sorted in increasing order let the adaptor share the
+  //! evaluation data between neighbouring points.
+  //! The default implementation calls D0() for each point.
+  Standard_EXPORT virtual void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints) const;
+  
+  //! Computes the points and the first derivatives of parameters
+  //! <theParams> on the curve, see D0Array().
+  //! The default implementation calls D1() for each point.
+  Standard_EXPORT virtual void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints, TColgp_Array1OfVec2d& theD1) const;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
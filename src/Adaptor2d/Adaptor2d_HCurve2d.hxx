@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec2d.hxx>
 #include <Standard_Boolean.hxx>
 #include <gp_Pnt2d.hxx>
 #include <gp_Vec2d.hxx>
@@ -86,6 +88,10 @@ public:
   
     void D1 (const Standard_Real U, gp_Pnt2d& P, gp_Vec2d& V) const;
   
+    void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints) const;
+  
+    void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints, TColgp_Array1OfVec2d& theD1) const;
+  
     void D2 (const Standard_Real U, gp_Pnt2d& P, gp_Vec2d& V1, gp_Vec2d& V2) const;
   
     void D3 (const Standard_Real U, gp_Pnt2d& P, gp_Vec2d& V1, gp_Vec2d& V2, gp_Vec2d& V3) const;
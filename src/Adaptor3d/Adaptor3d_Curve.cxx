@@ -176,6 +176,37 @@ void Adaptor3d_Curve::D1(const Standard_Real , gp_Pnt& , gp_Vec& ) const
 }
 
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D0Array (const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         thePoints) const
+{
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    D0 (theParams (i), thePoints (i));
+  }
+}
+
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D1Array (const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1) const
+{
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    D1 (theParams (i), thePoints (i), theD1 (i));
+  }
+}
+
+
 //=======================================================================
 //function : D2
 //purpose  : 
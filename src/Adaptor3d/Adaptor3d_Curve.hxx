@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <Standard_Boolean.hxx>
 #include <GeomAbs_CurveType.hxx>
 class Standard_OutOfRange;
@@ -104,6 +106,19 @@ public:
   //! is not C1.
   Standard_EXPORT virtual void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const;
   
+  //! Computes the points of parameters <theParams> on the curve:
+  //! thePoints(i) receives the point of parameter theParams(i),
+  //! thus the bounds of <thePoints> must be the ones of <theParams>.
+  //! Parameters sorted in increasing order let the adaptor share the
+  //! evaluation data between neighbouring points.
+  //! The default implementation calls D0() for each point.
+  Standard_EXPORT virtual void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const;
+  
+  //! Computes the points and the first derivatives of parameters
+  //! <theParams> on the curve, see D0Array().
+  //! The default implementation calls D1() for each point.
+  Standard_EXPORT virtual void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1) const;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <Standard_Boolean.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
@@ -103,6 +105,10 @@ public:
   
     void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const;
   
+    void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const;
+  
+    void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1) const;
+  
     void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const;
   
     void D3 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2, gp_Vec& V3) const;
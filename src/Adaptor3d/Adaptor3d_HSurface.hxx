@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 #include <Standard_Boolean.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
@@ -91,6 +93,12 @@ public:
   
     Handle(Adaptor3d_HSurface) VTrim (const Standard_Real First, const Standard_Real Last, const Standard_Real Tol) const;
   
+  //! Returns an independent copy of the surface adaptor,
+  //! see Adaptor3d_Surface::ShallowCopy().
+    Handle(Adaptor3d_HSurface) ShallowCopy() const;
+  
+    Standard_Boolean CanShallowCopy() const;
+  
     Standard_Boolean IsUClosed() const;
   
     Standard_Boolean IsVClosed() const;
@@ -109,6 +117,10 @@ public:
   
     void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const;
   
+    void D0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints) const;
+  
+    void D1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const;
+  
     void D2 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV) const;
   
     void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const;
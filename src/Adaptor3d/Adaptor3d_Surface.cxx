@@ -179,6 +179,26 @@ Handle(Adaptor3d_HSurface) Adaptor3d_Surface::VTrim(const Standard_Real , const
   throw Standard_NotImplemented("Adaptor3d_Surface::VTrim");
 }
 
+//=======================================================================
+//function : ShallowCopy
+//purpose  : 
+//=======================================================================
+
+Handle(Adaptor3d_HSurface) Adaptor3d_Surface::ShallowCopy() const
+{
+  return Handle(Adaptor3d_HSurface)();
+}
+
+//=======================================================================
+//function : CanShallowCopy
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean Adaptor3d_Surface::CanShallowCopy() const
+{
+  return Standard_False;
+}
+
 
 //=======================================================================
 //function : IsUClosed
@@ -282,6 +302,46 @@ void Adaptor3d_Surface::D1(const Standard_Real , const Standard_Real , gp_Pnt& ,
 }
 
 
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D0Grid (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt&         thePoints) const
+{
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      D0 (theU (i), theV (j), thePoints (i, j));
+    }
+  }
+}
+
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D1Grid (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt&         thePoints,
+                                TColgp_Array2OfVec&         theD1U,
+                                TColgp_Array2OfVec&         theD1V) const
+{
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      D1 (theU (i), theV (j), thePoints (i, j), theD1U (i, j), theD1V (i, j));
+    }
+  }
+}
+
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -25,6 +25,8 @@
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 #include <Standard_Boolean.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 class Standard_OutOfRange;
@@ -113,6 +115,18 @@ public:
   //! If <First> >= <Last>
   Standard_EXPORT virtual Handle(Adaptor3d_HSurface) VTrim (const Standard_Real First, const Standard_Real Last, const Standard_Real Tol) const;
   
+  //! Returns a new adaptor on the same surface and parameter range
+  //! which does not share evaluation caches with <me>, so that the
+  //! copy can be evaluated in another thread.
+  //! The underlying geometry is shared, not copied.
+  //! Returns a null handle if the adaptor does not support copying
+  //! (default implementation).
+  Standard_EXPORT virtual Handle(Adaptor3d_HSurface) ShallowCopy() const;
+  
+  //! Returns True if ShallowCopy() is supported by the adaptor.
+  //! Returns False by default.
+  Standard_EXPORT virtual Standard_Boolean CanShallowCopy() const;
+  
   Standard_EXPORT virtual Standard_Boolean IsUClosed() const;
   
   Standard_EXPORT virtual Standard_Boolean IsVClosed() const;
@@ -137,6 +151,19 @@ public:
   //! intervals is not C1.
   Standard_EXPORT virtual void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const;
   
+  //! Computes the points of the grid of parameters <theU> x <theV>:
+  //! thePoints(i, j) receives the point of parameters theU(i), theV(j),
+  //! thus the bounds of <thePoints> must be the ones of <theU> and <theV>.
+  //! Parameters sorted in increasing order let the adaptor share the
+  //! evaluation data between neighbouring points.
+  //! The default implementation calls D0() for each point.
+  Standard_EXPORT virtual void D0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints) const;
+  
+  //! Computes the points and the first derivatives of the grid
+  //! of parameters <theU> x <theV>, see D0Grid().
+  //! The default implementation calls D1() for each point.
+  Standard_EXPORT virtual void D1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const;
+  
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //! Raised  if   the   continuity   of the current
@@ -44,12 +44,14 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <IntTools_Context.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_UBTreeFiller.hxx>
 #include <NCollection_Vector.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <TColStd_IndexedMapOfInteger.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -1125,6 +1127,148 @@ void BOPAlgo_Tools::IntersectVertices(const TopTools_IndexedDataMapOfShapeReal&
   }
 }
 
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPAlgo_ClusterBox
+//purpose  : Auxiliary class for computation of the bounding box
+//           of the shape
+//=======================================================================
+class BOPAlgo_ClusterBox {
+ public:
+  BOPAlgo_ClusterBox() : myGap(0.) {};
+  //
+  void SetShape(const TopoDS_Shape& theS) {
+    myShape = theS;
+  }
+  //
+  void SetGap(const Standard_Real theGap) {
+    myGap = theGap;
+  }
+  //
+  const Bnd_Box& Box() const {
+    return myBox;
+  }
+  //
+  void Perform() {
+    BRepBndLib::Add(myShape, myBox, Standard_False);
+    if (!myBox.IsVoid()) {
+      myBox.SetGap(myBox.GetGap() + myGap);
+    }
+  }
+  //
+ protected:
+  TopoDS_Shape myShape;
+  Standard_Real myGap;
+  Bnd_Box myBox;
+};
+//
+typedef NCollection_Vector
+  <BOPAlgo_ClusterBox> BOPAlgo_VectorOfClusterBox;
+//
+typedef BOPTools_Functor
+  <BOPAlgo_ClusterBox,
+  BOPAlgo_VectorOfClusterBox> BOPAlgo_ClusterBoxFunctor;
+//
+typedef BOPTools_Cnt
+  <BOPAlgo_ClusterBoxFunctor,
+  BOPAlgo_VectorOfClusterBox> BOPAlgo_ClusterBoxCnt;
+//
+/////////////////////////////////////////////////////////////////////////
+
+//=======================================================================
+//function : ClusterShapes
+//purpose  : Builds the groups of shapes with interfering bounding boxes
+//=======================================================================
+void BOPAlgo_Tools::ClusterShapes(const TopTools_ListOfShape& theShapes,
+                                  const Standard_Boolean theRunParallel,
+                                  const Standard_Real theFuzzyValue,
+                                  TopTools_ListOfListOfShape& theClusters)
+{
+  // Avoid duplicates
+  TopTools_IndexedMapOfShape aMS;
+  TopTools_ListIteratorOfListOfShape aItLS(theShapes);
+  for (; aItLS.More(); aItLS.Next()) {
+    aMS.Add(aItLS.Value());
+  }
+  //
+  Standard_Integer i, j, aNbS = aMS.Extent();
+  if (aNbS <= 1) {
+    if (aNbS == 1) {
+      theClusters.Append(TopTools_ListOfShape()).Append(aMS(1));
+    }
+    return;
+  }
+  //
+  // Compute bounding boxes of the shapes taking into account
+  // the tolerances and the additional tolerance of the operation
+  BOPAlgo_VectorOfClusterBox aVSB;
+  for (i = 1; i <= aNbS; ++i) {
+    BOPAlgo_ClusterBox& aSB = aVSB.Appended();
+    aSB.SetShape(aMS(i));
+    aSB.SetGap(theFuzzyValue + Precision::Confusion());
+  }
+  BOPAlgo_ClusterBoxCnt::Perform(theRunParallel, aVSB);
+  //
+  // Use unbalanced binary tree of bounding boxes for sorting of the shapes.
+  BOPTools_BoxBndTree aBBTree;
+  NCollection_UBTreeFiller <Standard_Integer,
+                            Bnd_Box> aTreeFiller(aBBTree);
+  for (i = 1; i <= aNbS; ++i) {
+    const Bnd_Box& aBox = aVSB(i - 1).Box();
+    if (!aBox.IsVoid()) {
+      aTreeFiller.Add(i, aBox);
+    }
+  }
+  // Shake the tree
+  aTreeFiller.Fill();
+  //
+  // Fence map
+  TColStd_MapOfInteger aMFence;
+  // Build the groups of interfering shapes
+  for (i = 1; i <= aNbS; ++i) {
+    if (!aMFence.Add(i)) {
+      continue;
+    }
+    // Start the group
+    TColStd_IndexedMapOfInteger aMCluster;
+    aMCluster.Add(i);
+    //
+    for (j = 1; j <= aMCluster.Extent(); ++j) {
+      const Bnd_Box& aBox = aVSB(aMCluster(j) - 1).Box();
+      if (aBox.IsVoid()) {
+        continue;
+      }
+      BOPTools_BoxBndTreeSelector aSelector;
+      aSelector.SetBox(aBox);
+      aBBTree.Select(aSelector);
+      // Add the interfering shapes into the group
+      TColStd_ListIteratorOfListOfInteger aItLI(aSelector.Indices());
+      for (; aItLI.More(); aItLI.Next()) {
+        if (aMFence.Add(aItLI.Value())) {
+          aMCluster.Add(aItLI.Value());
+        }
+      }
+    }
+    //
+    // Put the shapes of the group into the list keeping the input order
+    Standard_Integer aNbC = aMCluster.Extent();
+    TopTools_ListOfShape& aCluster = theClusters.Append(TopTools_ListOfShape());
+    if (aNbC == 1) {
+      aCluster.Append(aMS(i));
+      continue;
+    }
+    //
+    NCollection_Array1<Standard_Integer> anIndices(1, aNbC);
+    for (j = 1; j <= aNbC; ++j) {
+      anIndices(j) = aMCluster(j);
+    }
+    std::sort(&anIndices(1), &anIndices(1) + aNbC);
+    for (j = 1; j <= aNbC; ++j) {
+      aCluster.Append(aMS(anIndices(j)));
+    }
+  }
+}
+
 //=======================================================================
 //function : TreatCompound
 //purpose  : 
@@ -166,6 +166,15 @@ public:
                                                 const Standard_Real theFuzzyValue,
                                                 TopTools_ListOfListOfShape& theChains);
 
+  //! Builds the groups of shapes connected through the interference of
+  //! their bounding boxes, enlarged by the tolerances and by <theFuzzyValue>.
+  //! The shapes of different groups can not interfere with each other.
+  //! The order of the shapes in each group follows the input order.
+  Standard_EXPORT static void ClusterShapes(const TopTools_ListOfShape& theShapes,
+                                            const Standard_Boolean theRunParallel,
+                                            const Standard_Real theFuzzyValue,
+                                            TopTools_ListOfListOfShape& theClusters);
+
   //! Collect in the output list recursively all non-compound subshapes of the first level
   //! of the given shape theS. If a shape presents in the map theMFence it is skipped.
   //! All shapes put in the output are also added into theMFence.
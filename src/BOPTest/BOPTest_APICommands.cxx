@@ -128,6 +128,7 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetUseClustering(BOPTest_Objects::UseClustering());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   pBuilder->Build();
@@ -195,6 +196,7 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetUseClustering(BOPTest_Objects::UseClustering());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   aBuilder.Build();
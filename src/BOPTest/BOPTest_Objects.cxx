@@ -108,6 +108,7 @@ class BOPTest_Session {
     myDrawWarnShapes = Standard_False;
     myCheckInverted = Standard_True;
     myUseOBB = Standard_False;
+    myUseClustering = Standard_False;
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
@@ -168,6 +169,14 @@ class BOPTest_Session {
   Standard_Boolean UseOBB() const {
     return myUseOBB;
   };
+  //
+  void SetUseClustering(const Standard_Boolean bUse) {
+    myUseClustering = bUse;
+  };
+  //
+  Standard_Boolean UseClustering() const {
+    return myUseClustering;
+  };
 
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
@@ -204,6 +213,7 @@ protected:
   Standard_Boolean myDrawWarnShapes;
   Standard_Boolean myCheckInverted;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myUseClustering;
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
@@ -457,6 +467,22 @@ Standard_Boolean BOPTest_Objects::UseOBB()
   return GetSession().UseOBB();
 }
 //=======================================================================
+//function : SetUseClustering
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetUseClustering(const Standard_Boolean bUse)
+{
+  GetSession().SetUseClustering(bUse);
+}
+//=======================================================================
+//function : UseClustering
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::UseClustering()
+{
+  return GetSession().UseClustering();
+}
+//=======================================================================
 //function : SetUnifyEdges
 //purpose  : 
 //=======================================================================
@@ -97,6 +97,10 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetUseClustering(const Standard_Boolean bUse);
+
+  Standard_EXPORT static Standard_Boolean UseClustering();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
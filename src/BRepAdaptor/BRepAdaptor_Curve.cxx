@@ -403,6 +403,46 @@ void BRepAdaptor_Curve::D1(const Standard_Real U,
   V.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::D0Array(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints) const
+{
+  if (myConSurf.IsNull())
+    myCurve.D0Array(theParams,thePoints);
+  else
+    myConSurf->D0Array(theParams,thePoints);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+    thePoints(i).Transform(myTrsf);
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::D1Array(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1) const
+{
+  if (myConSurf.IsNull())
+    myCurve.D1Array(theParams,thePoints,theD1);
+  else
+    myConSurf->D1Array(theParams,thePoints,theD1);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    thePoints(i).Transform(myTrsf);
+    theD1(i).Transform(myTrsf);
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -162,6 +162,14 @@ public:
   //! is not C1.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const Standard_OVERRIDE;
   
+  //! Computes the points of parameters <theParams>,
+  //! see Adaptor3d_Curve::D0Array().
+  Standard_EXPORT void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives
+  //! of parameters <theParams>, see D0Array().
+  Standard_EXPORT void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1) const Standard_OVERRIDE;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
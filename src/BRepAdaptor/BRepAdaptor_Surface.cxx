@@ -18,6 +18,7 @@
 #include <Adaptor3d_HCurve.hxx>
 #include <Adaptor3d_HSurface.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepAdaptor_HSurface.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepTools.hxx>
 #include <Geom_BezierSurface.hxx>
@@ -198,6 +199,26 @@ Handle(Adaptor3d_HSurface) BRepAdaptor_Surface::VTrim
   return HS->VTrim(First,Last,Tol);
 }
 
+//=======================================================================
+//function : ShallowCopy
+//purpose  : 
+//=======================================================================
+
+Handle(Adaptor3d_HSurface) BRepAdaptor_Surface::ShallowCopy() const
+{
+  Handle(BRepAdaptor_HSurface) aCopy = new BRepAdaptor_HSurface();
+  BRepAdaptor_Surface& aSurface = aCopy->ChangeSurface();
+  aSurface.myFace = myFace;
+  aSurface.myTrsf = myTrsf;
+  Handle(GeomAdaptor_HSurface) aGeomCopy = Handle(GeomAdaptor_HSurface)::DownCast (mySurf.ShallowCopy());
+  if (aGeomCopy.IsNull())
+  {
+    return Handle(Adaptor3d_HSurface)();
+  }
+  aSurface.mySurf = aGeomCopy->ChangeSurface();
+  return aCopy;
+}
+
 
 //=======================================================================
 //function : Value
@@ -240,6 +261,48 @@ void  BRepAdaptor_Surface::D1(const Standard_Real U,
   D1V.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D0Grid(const TColStd_Array1OfReal& theU,
+                                 const TColStd_Array1OfReal& theV,
+                                 TColgp_Array2OfPnt&         thePoints) const
+{
+  mySurf.D0Grid(theU,theV,thePoints);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+      thePoints(i,j).Transform(myTrsf);
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D1Grid(const TColStd_Array1OfReal& theU,
+                                 const TColStd_Array1OfReal& theV,
+                                 TColgp_Array2OfPnt&         thePoints,
+                                 TColgp_Array2OfVec&         theD1U,
+                                 TColgp_Array2OfVec&         theD1V) const
+{
+  mySurf.D1Grid(theU,theV,thePoints,theD1U,theD1V);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      thePoints(i,j).Transform(myTrsf);
+      theD1U(i,j).Transform(myTrsf);
+      theD1V(i,j).Transform(myTrsf);
+    }
+  }
+}
+
 
 //=======================================================================
 //function : D2
@@ -141,6 +141,13 @@ public:
   //! If <First> >= <Last>
   Standard_EXPORT Handle(Adaptor3d_HSurface) VTrim (const Standard_Real First, const Standard_Real Last, const Standard_Real Tol) const Standard_OVERRIDE;
   
+  //! Returns a new adaptor on the same face
+  //! with its own evaluation cache.
+  Standard_EXPORT Handle(Adaptor3d_HSurface) ShallowCopy() const Standard_OVERRIDE;
+  
+  //! Returns True.
+  virtual Standard_Boolean CanShallowCopy() const Standard_OVERRIDE { return Standard_True; }
+  
     Standard_Boolean IsUClosed() const Standard_OVERRIDE;
   
     Standard_Boolean IsVClosed() const Standard_OVERRIDE;
@@ -165,6 +172,14 @@ public:
   //! intervals is not C1.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
   
+  //! Computes the points of the grid of parameters <theU> x <theV>,
+  //! see Adaptor3d_Surface::D0Grid().
+  Standard_EXPORT void D0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of the grid
+  //! of parameters <theU> x <theV>, see Adaptor3d_Surface::D1Grid().
+  Standard_EXPORT void D1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const Standard_OVERRIDE;
+  
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //! Raised  if   the   continuity   of the current
@@ -158,6 +158,11 @@ void BRepAlgoAPI_BooleanOperation::Build()
     return;
   }
 
+  // Treat the groups of interfering arguments separately if requested
+  if (myUseClustering && myOperation == BOPAlgo_FUSE &&
+      BuildClusters(myArguments, myTools, myOperation))
+    return;
+
   // DEBUG option for dumping shapes and scripts
   BRepAlgoAPI_DumpOper aDumpOper;
   {
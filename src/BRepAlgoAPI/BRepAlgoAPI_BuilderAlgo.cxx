@@ -15,11 +15,214 @@
 
 #include <BRepAlgoAPI_BuilderAlgo.hxx>
 
+#include <BOPAlgo_BOP.hxx>
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
+#include <BOPAlgo_Tools.hxx>
 #include <BOPDS_DS.hxx>
+#include <BOPTools_AlgoTools.hxx>
+#include <BOPTools_AlgoTools3D.hxx>
+#include <BOPTools_Parallel.hxx>
+#include <BRep_Builder.hxx>
+#include <Message_Report.hxx>
+#include <NCollection_Vector.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_ListOfListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+//=======================================================================
+//function : CollectSectionEdges
+//purpose  : Collects the section edges from the intersection results
+//=======================================================================
+static void CollectSectionEdges(const BOPDS_PDS& thePDS,
+                                TopTools_ListOfShape& theLSE)
+{
+  // Fence map to avoid duplicated section edges in the list
+  TopTools_MapOfShape aMFence;
+  // Iterate on all Face/Face interferences and take section edges
+  BOPDS_VectorOfInterfFF& aFFs = thePDS->InterfFF();
+  const Standard_Integer aNbFF = aFFs.Length();
+  for (Standard_Integer i = 0; i < aNbFF; ++i)
+  {
+    BOPDS_InterfFF& aFFi = aFFs(i);
+    // Section curves between pair of faces
+    const BOPDS_VectorOfCurve& aSectionCurves = aFFi.Curves();
+    const Standard_Integer aNbC = aSectionCurves.Length();
+    for (Standard_Integer j = 0; j < aNbC; ++j)
+    {
+      const BOPDS_Curve& aCurve = aSectionCurves(j);
+      // Section edges created from the curve
+      const BOPDS_ListOfPaveBlock& aSectionEdges = aCurve.PaveBlocks();
+      BOPDS_ListIteratorOfListOfPaveBlock aItPB(aSectionEdges);
+      for (; aItPB.More(); aItPB.Next())
+      {
+        const Handle(BOPDS_PaveBlock)& aPB = aItPB.Value();
+        const TopoDS_Shape& aSE = thePDS->Shape(aPB->Edge());
+        if (aMFence.Add(aSE))
+          theLSE.Append(aSE);
+      }
+    }
+  }
+}
+
+//=======================================================================
+//class    : BRepAlgoAPI_ClusterBuilder
+//purpose  : Performs the operation on the group of arguments.
+//           The tools are released right after the operation,
+//           only the result, the history and the section edges are kept.
+//=======================================================================
+class BRepAlgoAPI_ClusterBuilder
+{
+public:
+
+  //! Empty constructor
+  BRepAlgoAPI_ClusterBuilder()
+  : myOperation(BOPAlgo_UNKNOWN),
+    myRunParallel(Standard_False),
+    myFuzzyValue(0.),
+    myNonDestructive(Standard_False),
+    myGlue(BOPAlgo_GlueOff),
+    myCheckInverted(Standard_True),
+    myUseOBB(Standard_False),
+    myFillHistory(Standard_True),
+    myReport(new Message_Report)
+  {}
+
+  //! Returns the objects of the operation
+  TopTools_ListOfShape& ChangeObjects() { return myObjects; }
+
+  //! Returns the tools of the operation
+  TopTools_ListOfShape& ChangeTools() { return myTools; }
+
+  //! Sets the type of the operation, BOPAlgo_UNKNOWN for General Fuse
+  void SetOperation(const BOPAlgo_Operation theOperation) { myOperation = theOperation; }
+
+  //! Sets the options of the operation
+  void SetOptions(const Standard_Boolean theRunParallel,
+                  const Standard_Real theFuzzyValue,
+                  const Standard_Boolean theNonDestructive,
+                  const BOPAlgo_GlueEnum theGlue,
+                  const Standard_Boolean theCheckInverted,
+                  const Standard_Boolean theUseOBB,
+                  const Standard_Boolean theFillHistory)
+  {
+    myRunParallel = theRunParallel;
+    myFuzzyValue = theFuzzyValue;
+    myNonDestructive = theNonDestructive;
+    myGlue = theGlue;
+    myCheckInverted = theCheckInverted;
+    myUseOBB = theUseOBB;
+    myFillHistory = theFillHistory;
+  }
+
+  //! Sets the progress indicator
+  void SetProgressIndicator(const Handle(Message_ProgressIndicator)& theProgress)
+  {
+    myProgressIndicator = theProgress;
+  }
+
+  //! Performs the operation
+  void Perform()
+  {
+    TopTools_ListOfShape aLArgs = myObjects;
+    for (TopTools_ListOfShape::Iterator it(myTools); it.More(); it.Next())
+      aLArgs.Append(it.Value());
+
+    Handle(NCollection_BaseAllocator) anAlloc =
+      NCollection_BaseAllocator::CommonBaseAllocator();
+
+    // Intersection of the arguments
+    BOPAlgo_PaveFiller aPF(anAlloc);
+    aPF.SetArguments(aLArgs);
+    aPF.SetRunParallel(myRunParallel);
+    aPF.SetProgressIndicator(myProgressIndicator);
+    aPF.SetFuzzyValue(myFuzzyValue);
+    aPF.SetNonDestructive(myNonDestructive);
+    aPF.SetGlue(myGlue);
+    aPF.SetUseOBB(myUseOBB);
+    aPF.Perform();
+    if (aPF.HasErrors())
+    {
+      myReport->Merge(aPF.GetReport());
+      return;
+    }
+
+    // Building of the result
+    BOPAlgo_Builder aGF(anAlloc);
+    BOPAlgo_BOP aBOP(anAlloc);
+    BOPAlgo_Builder& aBuilder = (myOperation == BOPAlgo_UNKNOWN) ? aGF : aBOP;
+    if (myOperation == BOPAlgo_UNKNOWN)
+    {
+      aGF.SetArguments(aLArgs);
+    }
+    else
+    {
+      aBOP.SetArguments(myObjects);
+      aBOP.SetTools(myTools);
+      aBOP.SetOperation(myOperation);
+    }
+    aBuilder.SetRunParallel(myRunParallel);
+    aBuilder.SetProgressIndicator(myProgressIndicator);
+    aBuilder.SetCheckInverted(myCheckInverted);
+    aBuilder.SetToFillHistory(myFillHistory);
+    aBuilder.PerformWithFiller(aPF);
+    // The report of the builder includes the one of the intersection tool
+    myReport->Merge(aBuilder.GetReport());
+    if (aBuilder.HasErrors())
+      return;
+
+    myShape = aBuilder.Shape();
+    if (myFillHistory)
+    {
+      myHistory = new BRepTools_History;
+      myHistory->Merge(aBuilder.History());
+    }
+    CollectSectionEdges(aPF.PDS(), mySectionEdges);
+  }
+
+  //! Returns the report of the operation
+  const Handle(Message_Report)& GetReport() const { return myReport; }
+
+  //! Returns the result of the operation
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns the history of the operation
+  const Handle(BRepTools_History)& History() const { return myHistory; }
+
+  //! Returns the section edges
+  const TopTools_ListOfShape& SectionEdges() const { return mySectionEdges; }
+
+private:
+  TopTools_ListOfShape myObjects;
+  TopTools_ListOfShape myTools;
+  BOPAlgo_Operation myOperation;
+  Standard_Boolean myRunParallel;
+  Standard_Real myFuzzyValue;
+  Standard_Boolean myNonDestructive;
+  BOPAlgo_GlueEnum myGlue;
+  Standard_Boolean myCheckInverted;
+  Standard_Boolean myUseOBB;
+  Standard_Boolean myFillHistory;
+  Handle(Message_ProgressIndicator) myProgressIndicator;
+  Handle(Message_Report) myReport;
+  TopoDS_Shape myShape;
+  Handle(BRepTools_History) myHistory;
+  TopTools_ListOfShape mySectionEdges;
+};
+//
+typedef NCollection_Vector
+  <BRepAlgoAPI_ClusterBuilder> BRepAlgoAPI_VectorOfClusterBuilder;
+//
+typedef BOPTools_Functor
+  <BRepAlgoAPI_ClusterBuilder,
+  BRepAlgoAPI_VectorOfClusterBuilder> BRepAlgoAPI_ClusterBuilderFunctor;
+//
+typedef BOPTools_Cnt
+  <BRepAlgoAPI_ClusterBuilderFunctor,
+  BRepAlgoAPI_VectorOfClusterBuilder> BRepAlgoAPI_ClusterBuilderCnt;
 
 //=======================================================================
 // function: BRepAlgoAPI_BuilderAlgo
@@ -32,6 +235,7 @@ BRepAlgoAPI_BuilderAlgo::BRepAlgoAPI_BuilderAlgo()
   myGlue(BOPAlgo_GlueOff),
   myCheckInverted(Standard_True),
   myFillHistory(Standard_True),
+  myUseClustering(Standard_False),
   myIsIntersectionNeeded(Standard_True),
   myDSFiller(NULL),
   myBuilder(NULL)
@@ -47,6 +251,7 @@ BRepAlgoAPI_BuilderAlgo::BRepAlgoAPI_BuilderAlgo(const BOPAlgo_PaveFiller& aPF)
   myGlue(BOPAlgo_GlueOff),
   myCheckInverted(Standard_True),
   myFillHistory(Standard_True),
+  myUseClustering(Standard_False),
   myIsIntersectionNeeded(Standard_False),
   myBuilder(NULL)
 {
@@ -82,6 +287,8 @@ void BRepAlgoAPI_BuilderAlgo::Clear()
 
   if (mySimplifierHistory)
     mySimplifierHistory.Nullify();
+
+  myClusterSectionEdges.Clear();
 }
 //=======================================================================
 //function : Build
@@ -93,6 +300,9 @@ void BRepAlgoAPI_BuilderAlgo::Build()
   NotDone();
   // Destroy the tools if necessary
   Clear();
+  // Treat the groups of interfering arguments separately if requested
+  if (myUseClustering && BuildClusters(myArguments, TopTools_ListOfShape(), BOPAlgo_UNKNOWN))
+    return;
   // If necessary perform intersection of the argument shapes
   IntersectShapes(myArguments);
   if (HasErrors())
@@ -167,6 +377,147 @@ void BRepAlgoAPI_BuilderAlgo::BuildResult()
   }
 }
 //=======================================================================
+//function : BuildClusters
+//purpose  : Performs the operation on the groups of arguments separately
+//=======================================================================
+Standard_Boolean BRepAlgoAPI_BuilderAlgo::BuildClusters(const TopTools_ListOfShape& theObjects,
+                                                        const TopTools_ListOfShape& theTools,
+                                                        const BOPAlgo_Operation theOperation)
+{
+  if (!myIsIntersectionNeeded)
+    return Standard_False;
+
+  const Standard_Boolean isBOP = (theOperation != BOPAlgo_UNKNOWN);
+  TopTools_MapOfShape aMObjects, aMTools;
+  TopTools_ListOfShape aLArgs;
+  TopTools_ListIteratorOfListOfShape aItLS(theObjects);
+  for (; aItLS.More(); aItLS.Next())
+  {
+    aMObjects.Add(aItLS.Value());
+    aLArgs.Append(aItLS.Value());
+  }
+  for (aItLS.Initialize(theTools); aItLS.More(); aItLS.Next())
+  {
+    aMTools.Add(aItLS.Value());
+    aLArgs.Append(aItLS.Value());
+  }
+
+  if (isBOP)
+  {
+    // Keep the checks of the arguments on the whole set:
+    // all arguments of Fuse should be non-empty shapes of the same dimension
+    Standard_Integer aDim = -1;
+    for (aItLS.Initialize(aLArgs); aItLS.More(); aItLS.Next())
+    {
+      const TopoDS_Shape& aS = aItLS.Value();
+      if (BOPTools_AlgoTools3D::IsEmptyShape(aS))
+        return Standard_False;
+      const Standard_Integer aDimS = BOPTools_AlgoTools::Dimension(aS);
+      if (aDimS < 0 || (aDim >= 0 && aDimS != aDim))
+        return Standard_False;
+      aDim = aDimS;
+    }
+  }
+
+  // Split the arguments into the groups of interfering shapes
+  TopTools_ListOfListOfShape aClusters;
+  BOPAlgo_Tools::ClusterShapes(aLArgs, myRunParallel, myFuzzyValue, aClusters);
+  if (aClusters.Extent() < 2)
+    return Standard_False;
+
+  // Prepare the operations on the groups of several shapes
+  BRepAlgoAPI_VectorOfClusterBuilder aVCB;
+  TopTools_ListOfListOfShape::Iterator aItC(aClusters);
+  for (; aItC.More(); aItC.Next())
+  {
+    const TopTools_ListOfShape& aCluster = aItC.Value();
+    if (aCluster.Extent() == 1)
+    {
+      // The single argument of Boolean operation is taken as is only
+      // if it is not a container which could be rebuilt by the operation
+      const TopAbs_ShapeEnum aType = aCluster.First().ShapeType();
+      if (isBOP && (aType == TopAbs_COMPOUND || aType == TopAbs_COMPSOLID))
+        return Standard_False;
+      continue;
+    }
+
+    BRepAlgoAPI_ClusterBuilder& aCB = aVCB.Appended();
+    aCB.SetOperation(theOperation);
+    for (aItLS.Initialize(aCluster); aItLS.More(); aItLS.Next())
+    {
+      const TopoDS_Shape& aS = aItLS.Value();
+      if (!isBOP || aMObjects.Contains(aS))
+        aCB.ChangeObjects().Append(aS);
+      if (isBOP && aMTools.Contains(aS))
+        aCB.ChangeTools().Append(aS);
+    }
+
+    // The interfering arguments of the same group are treated
+    // by the Boolean operation together with the other group only
+    if (isBOP && (aCB.ChangeObjects().IsEmpty() || aCB.ChangeTools().IsEmpty()))
+      return Standard_False;
+  }
+
+  // Perform the operations, in parallel if there are several of them
+  const Standard_Boolean isParallelClusters = myRunParallel && aVCB.Length() > 1;
+  const Standard_Integer aNbCB = aVCB.Length();
+  for (Standard_Integer i = 0; i < aNbCB; ++i)
+  {
+    BRepAlgoAPI_ClusterBuilder& aCB = aVCB(i);
+    aCB.SetOptions(myRunParallel && !isParallelClusters, myFuzzyValue, myNonDestructive,
+                   myGlue, myCheckInverted, myUseOBB, myFillHistory);
+    if (!isParallelClusters)
+      aCB.SetProgressIndicator(myProgressIndicator);
+  }
+  BRepAlgoAPI_ClusterBuilderCnt::Perform(isParallelClusters, aVCB);
+
+  for (Standard_Integer i = 0; i < aNbCB; ++i)
+    GetReport()->Merge(aVCB(i).GetReport());
+  if (HasErrors())
+    return Standard_True;
+
+  // Combine the results of the groups
+  BRep_Builder aBB;
+  TopoDS_Compound aResult;
+  aBB.MakeCompound(aResult);
+  if (myFillHistory)
+    myHistory = new BRepTools_History;
+
+  Standard_Integer iCB = 0;
+  for (aItC.Initialize(aClusters); aItC.More(); aItC.Next())
+  {
+    const TopTools_ListOfShape& aCluster = aItC.Value();
+    if (aCluster.Extent() == 1)
+    {
+      // Non-interfering argument is not modified by the operation
+      aBB.Add(aResult, aCluster.First());
+      continue;
+    }
+
+    const BRepAlgoAPI_ClusterBuilder& aCB = aVCB(iCB++);
+    const TopoDS_Shape& aClusterResult = aCB.Shape();
+    if (aClusterResult.ShapeType() == TopAbs_COMPOUND)
+    {
+      for (TopoDS_Iterator aIt(aClusterResult); aIt.More(); aIt.Next())
+        aBB.Add(aResult, aIt.Value());
+    }
+    else
+      aBB.Add(aResult, aClusterResult);
+
+    // The groups do not share any sub-shapes, thus merging of
+    // their histories is a union of them
+    if (myFillHistory)
+      myHistory->Merge(aCB.History());
+
+    for (aItLS.Initialize(aCB.SectionEdges()); aItLS.More(); aItLS.Next())
+      myClusterSectionEdges.Append(aItLS.Value());
+  }
+
+  myShape = aResult;
+  Done();
+  return Standard_True;
+}
+//=======================================================================
 //function : SimplifyResult
 //purpose  : 
 //=======================================================================
@@ -258,57 +609,44 @@ Standard_Boolean BRepAlgoAPI_BuilderAlgo::HasDeleted() const
 const TopTools_ListOfShape& BRepAlgoAPI_BuilderAlgo::SectionEdges()
 {
   myGenerated.Clear();
-  if (myBuilder == NULL)
+  if (myBuilder == NULL && myClusterSectionEdges.IsEmpty())
     return myGenerated;
 
+  // Section edges from the intersection results
+  TopTools_ListOfShape aLSE;
+  if (myBuilder != NULL)
+    CollectSectionEdges(myDSFiller->PDS(), aLSE);
+  const TopTools_ListOfShape& aSectionEdges = (myBuilder != NULL) ? aLSE : myClusterSectionEdges;
+
   // Fence map to avoid duplicated section edges in the result list
   TopTools_MapOfShape aMFence;
-  // Intersection results
-  const BOPDS_PDS& pDS = myDSFiller->PDS();
-  // Iterate on all Face/Face interferences and take section edges
-  BOPDS_VectorOfInterfFF& aFFs = pDS->InterfFF();
-  const Standard_Integer aNbFF = aFFs.Length();
-  for (Standard_Integer i = 0; i < aNbFF; ++i)
+  TopTools_ListIteratorOfListOfShape aItLSE(aSectionEdges);
+  for (; aItLSE.More(); aItLSE.Next())
   {
-    BOPDS_InterfFF& aFFi = aFFs(i);
-    // Section curves between pair of faces
-    const BOPDS_VectorOfCurve& aSectionCurves = aFFi.Curves();
-    const Standard_Integer aNbC = aSectionCurves.Length();
-    for (Standard_Integer j = 0; j < aNbC; ++j)
+    const TopoDS_Shape& aSE = aItLSE.Value();
+    if (!aMFence.Add(aSE))
+      continue;
+    // Take into account simplification of the result shape
+    if (mySimplifierHistory)
     {
-      const BOPDS_Curve& aCurve = aSectionCurves(j);
-      // Section edges created from the curve
-      const BOPDS_ListOfPaveBlock& aSectionEdges = aCurve.PaveBlocks();
-      BOPDS_ListIteratorOfListOfPaveBlock aItPB(aSectionEdges);
-      for (; aItPB.More(); aItPB.Next())
+      if (mySimplifierHistory->IsRemoved(aSE))
+        continue;
+
+      const TopTools_ListOfShape& aLSEIm = mySimplifierHistory->Modified(aSE);
+      if (!aLSEIm.IsEmpty())
       {
-        const Handle(BOPDS_PaveBlock)& aPB = aItPB.Value();
-        const TopoDS_Shape& aSE = pDS->Shape(aPB->Edge());
-        if (!aMFence.Add(aSE))
-          continue;
-        // Take into account simplification of the result shape
-        if (mySimplifierHistory)
+        TopTools_ListIteratorOfListOfShape aItLEIm(aLSEIm);
+        for (; aItLEIm.More(); aItLEIm.Next())
         {
-          if (mySimplifierHistory->IsRemoved(aSE))
-            continue;
-
-          const TopTools_ListOfShape& aLSEIm = mySimplifierHistory->Modified(aSE);
-          if (!aLSEIm.IsEmpty())
-          {
-            TopTools_ListIteratorOfListOfShape aItLEIm(aLSEIm);
-            for (; aItLEIm.More(); aItLEIm.Next())
-            {
-              if (aMFence.Add(aItLEIm.Value()))
-                myGenerated.Append(aItLEIm.Value());
-            }
-          }
-          else
-            myGenerated.Append(aSE);
+          if (aMFence.Add(aItLEIm.Value()))
+            myGenerated.Append(aItLEIm.Value());
         }
-        else
-          myGenerated.Append(aSE);
       }
+      else
+        myGenerated.Append(aSE);
     }
+    else
+      myGenerated.Append(aSE);
   }
   return myGenerated;
 }
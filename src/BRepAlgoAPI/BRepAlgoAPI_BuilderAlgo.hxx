@@ -20,6 +20,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_Operation.hxx>
 #include <BOPAlgo_PPaveFiller.hxx>
 #include <BOPAlgo_PBuilder.hxx>
 #include <BRepAlgoAPI_Algo.hxx>
@@ -43,6 +44,9 @@
 //!                          most likely will lead to incorrect results.
 //! - *Disabling history collection* - allows disabling the collection of the history
 //!                                    of shapes modifications during the operation.
+//! - *Clustering of the arguments* - allows performing the operation separately
+//!                                   on the groups of arguments with interfering bounding boxes
+//!                                   (by default it is off).
 //!
 //! It returns the following Error statuses:<br>
 //! - 0 - in case of success;<br>
@@ -134,6 +138,28 @@ public: //! @name Setting options
     return myCheckInverted;
   }
 
+  //! Enables/Disables the clustering of the arguments.
+  //! In this mode the arguments are split into the groups connected through
+  //! the interference of their bounding boxes. The operation is performed on each
+  //! group separately (the groups are processed simultaneously in parallel mode),
+  //! and the arguments not interfering with any other argument are put into
+  //! the result as is. It reduces the memory consumption and the running time
+  //! for the big number of sparsely located arguments.
+  //! The mode is taken into account for the General Fuse and Fuse operations
+  //! performed with the internal intersection tool. In this mode the intersection
+  //! and building tools are not kept, and the methods DSFiller() and Builder()
+  //! return NULL.
+  void SetUseClustering(const Standard_Boolean theFlag)
+  {
+    myUseClustering = theFlag;
+  }
+
+  //! Returns the flag defining whether the arguments should be clustered.
+  Standard_Boolean UseClustering() const
+  {
+    return myUseClustering;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -255,6 +281,16 @@ protected: //! @name Protected methods for shapes intersection and building resu
   //! Builds the resulting shape
   Standard_EXPORT void BuildResult();
 
+  //! Performs the operation on the groups of the arguments with interfering
+  //! bounding boxes separately and combines the results.
+  //! <theOperation> is BOPAlgo_UNKNOWN for the General Fuse operation,
+  //! in which case <theTools> should be empty.
+  //! Returns FALSE if the clustering is not applicable and the operation
+  //! has to be performed on all arguments at once.
+  Standard_EXPORT Standard_Boolean BuildClusters(const TopTools_ListOfShape& theObjects,
+                                                 const TopTools_ListOfShape& theTools,
+                                                 const BOPAlgo_Operation theOperation);
+
 
 protected: //! @name Clearing the contents of the algorithm
 
@@ -272,6 +308,7 @@ protected: //! @name Fields
   BOPAlgo_GlueEnum myGlue;           //!< Gluing mode management
   Standard_Boolean myCheckInverted;  //!< Check for inverted solids management
   Standard_Boolean myFillHistory;    //!< Controls the history collection
+  Standard_Boolean myUseClustering;  //!< Clustering of the arguments management
 
   // Tools
   Standard_Boolean myIsIntersectionNeeded; //!< Flag to control whether the intersection
@@ -284,6 +321,7 @@ protected: //! @name Fields
                                            //! shapes modifications during the operation
                                            //! (including result simplification)
   Handle(BRepTools_History) mySimplifierHistory; //!< History of result shape simplification
+  TopTools_ListOfShape myClusterSectionEdges;    //!< Section edges of the clusters of arguments
 };
 
 #endif // _BRepAlgoAPI_BuilderAlgo_HeaderFile
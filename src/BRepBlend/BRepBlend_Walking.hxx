@@ -157,6 +157,8 @@ private:
   Standard_Boolean check;
   Standard_Boolean twistflag1;
   Standard_Boolean twistflag2;
+  Standard_Boolean sectioncalculee;
+  Standard_Integer nbcomputedsection;
 
 
 };
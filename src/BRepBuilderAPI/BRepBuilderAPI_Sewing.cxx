@@ -53,7 +53,6 @@
 #include <BRep_Tool.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_TVertex.hxx>
-#include <BRepBuilderAPI_BndBoxTreeSelector.hxx>
 #include <BRepBuilderAPI_CellFilter.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepBuilderAPI_VertexInspector.hxx>
@@ -62,6 +61,7 @@
 #include <BRepTools_Quilt.hxx>
 #include <BRepTools_ReShape.hxx>
 #include <BSplCLib.hxx>
+#include <BVH_IndexedBoxSet.hxx>
 #include <Extrema_ExtPC.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
 #include <GCPnts_UniformAbscissa.hxx>
@@ -87,7 +87,9 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressIndicator.hxx>
 #include <Message_ProgressSentry.hxx>
-#include <NCollection_UBTreeFiller.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
@@ -95,10 +97,12 @@
 #include <Standard_OutOfRange.hxx>
 #include <Standard_Type.hxx>
 #include <TColgp_Array1OfVec.hxx>
+#include <TColgp_HArray1OfPnt.hxx>
 #include <TColgp_SequenceOfPnt.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColStd_HArray1OfReal.hxx>
 #include <TColStd_IndexedMapOfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <TColStd_ListOfInteger.hxx>
@@ -124,6 +128,9 @@
 #include <TopTools_MapOfShape.hxx>
 #include <TopTools_SequenceOfShape.hxx>
 
+#include <algorithm>
+#include <vector>
+
 IMPLEMENT_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing,Standard_Transient)
 
 //#include <LocalAnalysis_SurfaceContinuity.hxx>
@@ -1061,6 +1068,106 @@ void BRepBuilderAPI_Sewing::EvaluateAngulars(TopTools_SequenceOfShape& sequenceS
   }
 }
 
+//! Number of points for curve discretization used to evaluate distances
+static const Standard_Integer THE_NB_DIST_SAMPLES = 8;
+
+//=======================================================================
+//function : GetEdgeCurve
+//purpose  : Returns 3D curve of the edge with location applied
+//=======================================================================
+
+static Standard_Boolean GetEdgeCurve(const TopoDS_Edge& theEdge,
+                                     Handle(Geom_Curve)& theCurve,
+                                     Standard_Real& theFirst,
+                                     Standard_Real& theLast)
+{
+  TopLoc_Location loc;
+  theCurve = BRep_Tool::Curve(theEdge, loc, theFirst, theLast);
+  if (theCurve.IsNull()) return Standard_False;
+  if (!loc.IsIdentity()) {
+    theCurve = Handle(Geom_Curve)::DownCast(theCurve->Copy());
+    theCurve->Transform(loc.Transformation());
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : SampleEdgeCurve
+//purpose  : Evaluates points uniformly distributed in parameter
+//=======================================================================
+
+static void SampleEdgeCurve(const Handle(Geom_Curve)& theCurve,
+                            const Standard_Real theFirst,
+                            const Standard_Real theLast,
+                            TColgp_Array1OfPnt& thePnts)
+{
+  const Standard_Integer npt = thePnts.Length();
+  Standard_Real T, deltaT = (theLast - theFirst) / (npt - 1);
+  for (Standard_Integer j = 1; j <= npt; j++) {
+    if (j == 1) T = theFirst;
+    else if (j == npt) T = theLast;
+    else T = theFirst + (j - 1) * deltaT;
+    thePnts(thePnts.Lower() + j - 1) = theCurve->Value(T);
+  }
+}
+
+//=======================================================================
+//class    : BRepBuilderAPI_SampleEdgeFunctor
+//purpose  : Samples the curves of the edges in parallel threads;
+//           the points are left null for the edge without curve or failed
+//=======================================================================
+
+class BRepBuilderAPI_SampleEdgeFunctor
+{
+public:
+
+  BRepBuilderAPI_SampleEdgeFunctor (const TopTools_IndexedMapOfShape& theEdges,
+                                    NCollection_Array1<BRepBuilderAPI_Sewing::EdgeSample>& theSamples)
+  : myEdges (theEdges), mySamples (theSamples) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    BRepBuilderAPI_Sewing::EdgeSample& aSample = mySamples(theIndex);
+    try {
+      OCC_CATCH_SIGNALS
+      const TopoDS_Edge& anEdge = TopoDS::Edge(myEdges(theIndex));
+      TopLoc_Location loc;
+      aSample.Curve = BRep_Tool::Curve(anEdge, loc, aSample.First, aSample.Last);
+      aSample.Tolerance = BRep_Tool::Tolerance(anEdge);
+      Handle(Geom_Curve) c3d;
+      Standard_Real first, last;
+      if (GetEdgeCurve(anEdge, c3d, first, last)) {
+        Handle(TColgp_HArray1OfPnt) aPnts = new TColgp_HArray1OfPnt(1, THE_NB_DIST_SAMPLES);
+        SampleEdgeCurve(c3d, first, last, aPnts->ChangeArray1());
+        aSample.Points = aPnts;
+      }
+    }
+    catch (Standard_Failure const&) {
+      aSample.Points.Nullify();
+    }
+  }
+
+  //! Checks that the edge has not been modified since the sample was taken
+  static Standard_Boolean IsValid (const TopoDS_Edge& theEdge,
+                                   const BRepBuilderAPI_Sewing::EdgeSample& theSample)
+  {
+    TopLoc_Location loc;
+    Standard_Real first, last;
+    Handle(Geom_Curve) c3d = BRep_Tool::Curve(theEdge, loc, first, last);
+    return c3d == theSample.Curve
+        && first == theSample.First
+        && last  == theSample.Last
+        && BRep_Tool::Tolerance(theEdge) == theSample.Tolerance;
+  }
+
+private:
+  BRepBuilderAPI_SampleEdgeFunctor& operator= (const BRepBuilderAPI_SampleEdgeFunctor&);
+
+private:
+  const TopTools_IndexedMapOfShape& myEdges;
+  NCollection_Array1<BRepBuilderAPI_Sewing::EdgeSample>& mySamples;
+};
+
 //=======================================================================
 // function : EvaluateDistances
 // purpose  : internal use
@@ -1078,8 +1185,8 @@ void BRepBuilderAPI_Sewing::EvaluateDistances(TopTools_SequenceOfShape& sequence
   tabDst.Init(-1.0);
   arrLen.Init(0.);
   tabMinDist.Init(Precision::Infinite());
-  const Standard_Integer npt = 8; // Number of points for curve discretization
-  TColgp_Array1OfPnt ptsRef(1, npt), ptsSec(1, npt);
+  const Standard_Integer npt = THE_NB_DIST_SAMPLES; // Number of points for curve discretization
+  TColgp_Array1OfPnt ptsRef(1, npt), ptsSec(1, npt), ptsCur(1, npt);
 
   Standard_Integer i, j, lengSec = sequenceSec.Length();
   TColgp_SequenceOfPnt seqSec;
@@ -1092,14 +1199,19 @@ void BRepBuilderAPI_Sewing::EvaluateDistances(TopTools_SequenceOfShape& sequence
     // reading of the edge (attention for the first one: reference)
     const TopoDS_Edge& sec = TopoDS::Edge(sequenceSec(i));
 
-    TopLoc_Location loc;
-    Standard_Real first, last;
-    Handle(Geom_Curve) c3d = BRep_Tool::Curve(sec, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
+    // take points sampled before merging if the edge has not been
+    // modified since then (its tolerance and curve are updated by merging);
+    // the curve is then retrieved only for projection
+    Handle(Geom_Curve) c3d;
+    Standard_Real first = 0., last = 0.;
+    const EdgeSample* aSample = myEdgeSamples.Seek(sec);
+    if (aSample != NULL && !BRepBuilderAPI_SampleEdgeFunctor::IsValid(sec, *aSample))
+      aSample = NULL;
+    if (aSample == NULL) {
+      if (!GetEdgeCurve(sec, c3d, first, last)) continue;
+      SampleEdgeCurve(c3d, first, last, ptsCur);
     }
+    const TColgp_Array1OfPnt& pts = (aSample != NULL ? aSample->Points->Array1() : ptsCur);
 
     if (i == indRef) {
       c3dRef = c3d; firstRef = first; lastRef = last;
@@ -1108,19 +1220,13 @@ void BRepBuilderAPI_Sewing::EvaluateDistances(TopTools_SequenceOfShape& sequence
     Standard_Real dist = Precision::Infinite(), distFor = -1.0, distRev = -1.0;
     Standard_Real aMinDist = Precision::Infinite();
 
-    Standard_Real T, deltaT = (last - first) / (npt - 1);
     Standard_Real aLenSec2 = 0.;
    
     Standard_Integer nbFound = 0;
     for (j = 1; j <= npt; j++) {
 
-      // Uniform parameter on curve
-      if (j == 1) T = first;
-      else if (j == npt) T = last;
-      else T = first + (j - 1) * deltaT;
-
       // Take point on curve
-      gp_Pnt pt = c3d->Value(T);
+      const gp_Pnt& pt = pts(j);
      
       if (i == indRef) {
         ptsRef(j) = pt;
@@ -1174,10 +1280,16 @@ void BRepBuilderAPI_Sewing::EvaluateDistances(TopTools_SequenceOfShape& sequence
       nbFound = 0, aMinDist = Precision::Infinite(), dist = -1;
       TColgp_Array1OfPnt arrProj(1, npt);
       TColStd_Array1OfReal arrDist(1, npt), arrPara(1, npt);
-      if( arrLen(indRef) >= arrLen(i)) 
+      if( arrLen(indRef) >= arrLen(i)) {
+        if (c3dRef.IsNull())
+          GetEdgeCurve(TopoDS::Edge(sequenceSec(indRef)),c3dRef,firstRef,lastRef);
         ProjectPointsOnCurve(ptsSec,c3dRef,firstRef,lastRef,arrDist,arrPara,arrProj,Standard_False);
-      else
+      }
+      else {
+        if (c3d.IsNull())
+          GetEdgeCurve(sec,c3d,first,last);
         ProjectPointsOnCurve(ptsRef,c3d,first,last,arrDist,arrPara,arrProj,Standard_False);
+      }
       for( j = 1; j <= npt; j++ )
       {
         if(arrDist(j) < 0.)
@@ -1754,6 +1866,7 @@ void BRepBuilderAPI_Sewing::Init(const Standard_Real tolerance,
   //myCuttingFloatingEdgesMode = Standard_False; //gka
   mySameParameterMode  = Standard_True;
   myLocalToleranceMode = Standard_False;
+  myRunParallel        = Standard_False;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -2224,6 +2337,71 @@ void BRepBuilderAPI_Sewing::Dump() const
   cout << " " << endl;
 }
 
+//=======================================================================
+//function : IsSmallEdge
+//purpose  : Checks if the 3D curve of the edge fits into the given tolerance
+//=======================================================================
+
+static Standard_Boolean IsSmallEdge(const TopoDS_Edge& theEdge,
+                                    const Standard_Real theMinTolerance)
+{
+  Standard_Real first, last;
+  Handle(Geom_Curve) c3d = BRep_Tool::Curve(theEdge,first,last);
+  if (c3d.IsNull()) {
+#ifdef OCCT_DEBUG
+    cout << "Warning: Possibly small edge can be sewed: No 3D curve" << endl;
+#endif
+    return Standard_False;
+  }
+
+  // Evaluate curve compactness
+  const Standard_Integer npt = 5;
+  gp_Pnt cp((c3d->Value(first).XYZ()+c3d->Value(last).XYZ())*0.5);
+  Standard_Real dist, maxdist = 0.0;
+  Standard_Real delta = (last - first)/(npt - 1);
+  for (Standard_Integer idx = 0; idx < npt; idx++) {
+    dist = cp.Distance(c3d->Value(first + idx*delta));
+    if (maxdist < dist) maxdist = dist;
+  }
+  return (2.*maxdist <= theMinTolerance);
+}
+
+//=======================================================================
+//class    : BRepBuilderAPI_SmallEdgeFunctor
+//purpose  : Checks the edges for smallness in parallel threads;
+//           state of the edge: -1 - not checked, 0 - normal, 1 - small
+//=======================================================================
+
+class BRepBuilderAPI_SmallEdgeFunctor
+{
+public:
+
+  BRepBuilderAPI_SmallEdgeFunctor (const TopTools_IndexedMapOfShape& theEdges,
+                                   const Standard_Real theMinTolerance,
+                                   TColStd_Array1OfInteger& theStates)
+  : myEdges (theEdges), myMinTolerance (theMinTolerance), myStates (theStates) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    try {
+      OCC_CATCH_SIGNALS
+      myStates(theIndex) = IsSmallEdge(TopoDS::Edge(myEdges(theIndex)),myMinTolerance) ? 1 : 0;
+    }
+    catch (Standard_Failure const&) {
+      // leave the edge to the sequential check
+      myStates(theIndex) = -1;
+    }
+  }
+
+private:
+  BRepBuilderAPI_SmallEdgeFunctor& operator= (const BRepBuilderAPI_SmallEdgeFunctor&);
+
+private:
+  const TopTools_IndexedMapOfShape& myEdges;
+  Standard_Real myMinTolerance;
+  TColStd_Array1OfInteger& myStates;
+};
+
 //=======================================================================
 //function : FaceAnalysis
 //purpose  : Remove
@@ -2246,6 +2424,24 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Handle(Message_ProgressIndicator)
   TopTools_MapOfShape SmallEdges;
   TopTools_IndexedDataMapOfShapeListOfShape GluedVertices;
   Standard_Integer i = 1;
+
+  // Check the edges for smallness in advance
+  TopTools_IndexedMapOfShape CheckedEdges;
+  TColStd_Array1OfInteger CheckedStates;
+  if (myRunParallel) {
+    for (i = 1; i <= myOldShapes.Extent(); i++) {
+      for (TopExp_Explorer eexp(myOldShapes(i),TopAbs_EDGE); eexp.More(); eexp.Next()) {
+        if (!BRep_Tool::Degenerated(TopoDS::Edge(eexp.Current())))
+          CheckedEdges.Add(eexp.Current());
+      }
+    }
+    if (!CheckedEdges.IsEmpty()) {
+      CheckedStates.Resize(1, CheckedEdges.Extent(), Standard_False);
+      BRepBuilderAPI_SmallEdgeFunctor aFunctor(CheckedEdges, MinTolerance(), CheckedStates);
+      OSD_Parallel::For(1, CheckedEdges.Extent() + 1, aFunctor);
+    }
+  }
+
   Message_ProgressSentry aPS (thePI, "Shape analysis", 0, myOldShapes.Extent(), 1);
   for (i = 1; i <= myOldShapes.Extent() && aPS.More(); i++, aPS.Next()) {
     for (TopExp_Explorer fexp(myOldShapes(i),TopAbs_FACE); fexp.More(); fexp.Next()) {
@@ -2293,36 +2489,11 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Handle(Message_ProgressIndicator)
 	  if (!isSmall) {
 
 	    // Check for small edge
-	    Standard_Real first, last;
-	    Handle(Geom_Curve) c3d = BRep_Tool::Curve(edge,first,last);
-	    if (c3d.IsNull()) {
-#ifdef OCCT_DEBUG
-	      cout << "Warning: Possibly small edge can be sewed: No 3D curve" << endl;
-#endif
-	    }
-	    else {
-	      // Evaluate curve compactness
-	      const Standard_Integer npt = 5;
-	      gp_Pnt cp((c3d->Value(first).XYZ()+c3d->Value(last).XYZ())*0.5);
-	      Standard_Real dist, maxdist = 0.0;
-	      Standard_Real delta = (last - first)/(npt - 1);
-	      for (Standard_Integer idx = 0; idx < npt; idx++) {
-		dist = cp.Distance(c3d->Value(first + idx*delta));
-		if (maxdist < dist) maxdist = dist;
-	      }
-	      isSmall = (2.*maxdist <= MinTolerance());
-	      /*try {
-		GeomAdaptor_Curve cAdapt(c3d);
-		Standard_Real length = GCPnts_AbscissaPoint::Length(cAdapt,first,last);
-		isSmall = (length <= MinTolerance());
-	      }
-	      catch (Standard_Failure) {
-#ifdef OCCT_DEBUG
-		cout << "Warning: Possibly small edge can be sewed: ";
-		Standard_Failure::Caught()->Print(cout); cout << endl;
-#endif
-	      }*/
-	    }
+	    const Standard_Integer anIndex = CheckedEdges.FindIndex(edge);
+	    if (anIndex > 0 && CheckedStates(anIndex) >= 0)
+	      isSmall = (CheckedStates(anIndex) == 1);
+	    else
+	      isSmall = IsSmallEdge(edge, MinTolerance());
 
 	    if (isSmall) {
 
@@ -3136,6 +3307,31 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
                                     const Handle(Message_ProgressIndicator)& thePI)
 {
   BRep_Builder B;
+
+  // Sample curves of bounds and sections for evaluation of distances
+  myEdgeSamples.Clear();
+  if (myRunParallel) {
+    TopTools_IndexedMapOfShape SampledEdges;
+    TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterS(myBoundFaces);
+    for (; anIterS.More(); anIterS.Next()) {
+      if (!anIterS.Value().Extent()) continue;
+      SampledEdges.Add(anIterS.Key());
+      if (myBoundSections.IsBound(anIterS.Key())) {
+        TopTools_ListIteratorOfListOfShape its(myBoundSections(anIterS.Key()));
+        for (; its.More(); its.Next()) SampledEdges.Add(its.Value());
+      }
+    }
+    if (!SampledEdges.IsEmpty()) {
+      NCollection_Array1<EdgeSample> aSamples(1, SampledEdges.Extent());
+      BRepBuilderAPI_SampleEdgeFunctor aFunctor(SampledEdges, aSamples);
+      OSD_Parallel::For(1, SampledEdges.Extent() + 1, aFunctor);
+      for (Standard_Integer i = 1; i <= SampledEdges.Extent(); i++) {
+        if (!aSamples(i).Points.IsNull())
+          myEdgeSamples.Bind(SampledEdges(i), aSamples(i));
+      }
+    }
+  }
+
   //  TopTools_MapOfShape MergedEdges;
   Message_ProgressSentry aPS (thePI, "Merging bounds", 0, myBoundFaces.Extent(), 1);
   TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
@@ -3464,6 +3660,7 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
   }
 
   myNbVertices = myVertexNode.Extent() + myVertexNodeFree.Extent();
+  myEdgeSamples.Clear();
   myNodeSections.Clear();
   myVertexNode.Clear();
   myVertexNodeFree.Clear();
@@ -3615,6 +3812,112 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   return success;
 }
 
+//=======================================================================
+//struct   : BRepBuilderAPI_BoundCutting
+//purpose  : Candidate vertices to cut the bound and their projections
+//=======================================================================
+
+struct BRepBuilderAPI_BoundCutting
+{
+  std::vector<Standard_Integer> Vertices; //!< indices of the vertices in myVertexNode
+  Handle(TColStd_HArray1OfReal) Dist;
+  Handle(TColStd_HArray1OfReal) Para;
+  Handle(TColgp_HArray1OfPnt)   Proj;
+  Standard_Boolean              IsDone;
+
+  BRepBuilderAPI_BoundCutting() : IsDone (Standard_False) {}
+};
+
+//=======================================================================
+//class    : BRepBuilderAPI_CuttingFunctor
+//purpose  : Finds the vertices lying near the bound and projects them
+//           on the bound curve; the bounds are processed independently
+//=======================================================================
+
+class BRepBuilderAPI_CuttingFunctor
+{
+public:
+
+  BRepBuilderAPI_CuttingFunctor (const BRepBuilderAPI_Sewing& theSewing,
+                                 const BVH_IndexedBoxSet& theNodes,
+                                 NCollection_Array1<BRepBuilderAPI_BoundCutting>& theCuttings)
+  : mySewing (theSewing), myNodes (theNodes), myCuttings (theCuttings) {}
+
+  //! Processes the bound catching the exceptions;
+  //! the failed bound is left not done.
+  void operator() (const Standard_Integer theIndex) const
+  {
+    try {
+      OCC_CATCH_SIGNALS
+      Perform (theIndex);
+    }
+    catch (Standard_Failure const&) {
+      myCuttings(theIndex) = BRepBuilderAPI_BoundCutting();
+    }
+  }
+
+  //! Fills the cutting data of the bound with the given index.
+  void Perform (const Standard_Integer theIndex) const
+  {
+    BRepBuilderAPI_BoundCutting& aCutting = myCuttings(theIndex);
+    aCutting.Vertices.clear();
+    aCutting.IsDone = Standard_True;
+    // Do not cut floating edges
+    if (!mySewing.myBoundFaces(theIndex).Extent()) return;
+    // Obtain bound curve
+    const TopoDS_Edge& bound = TopoDS::Edge(mySewing.myBoundFaces.FindKey(theIndex));
+    TopLoc_Location loc;
+    Standard_Real first, last;
+    Handle(Geom_Curve) c3d = BRep_Tool::Curve(bound, loc, first, last);
+    if (c3d.IsNull()) return;
+    if (!loc.IsIdentity()) {
+      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
+      c3d->Transform(loc.Transformation());
+    }
+    // Create bounding box around curve
+    Bnd_Box aGlobalBox;
+    GeomAdaptor_Curve adptC(c3d,first,last);
+    BndLib_Add3dCurve::Add(adptC,mySewing.myTolerance,aGlobalBox);
+    if (aGlobalBox.IsVoid()) return;
+    // Sort vertices to find candidates
+    std::vector<Standard_Integer> aFound;
+    myNodes.Select (aGlobalBox, aFound);
+    // Skip bound if no node is in the boundind box
+    if (aFound.empty()) return;
+    std::sort (aFound.begin(), aFound.end());
+    // Retrieve bound nodes
+    TopoDS_Vertex V1, V2;
+    TopExp::Vertices(bound,V1,V2);
+    const TopoDS_Shape& Node1 = mySewing.myVertexNode.FindFromKey(V1);
+    const TopoDS_Shape& Node2 = mySewing.myVertexNode.FindFromKey(V2);
+    for (size_t i = 0; i < aFound.size(); i++) {
+      const TopoDS_Shape& Node = mySewing.myVertexNode.FindFromIndex(aFound[i]);
+      if (!Node.IsSame(Node1) && !Node.IsSame(Node2))
+        aCutting.Vertices.push_back(aFound[i]);
+    }
+    const Standard_Integer nbCandidates = (Standard_Integer )aCutting.Vertices.size();
+    if (!nbCandidates) return;
+    // Project vertices on curve
+    aCutting.Dist = new TColStd_HArray1OfReal(1, nbCandidates);
+    aCutting.Para = new TColStd_HArray1OfReal(1, nbCandidates);
+    aCutting.Proj = new TColgp_HArray1OfPnt(1, nbCandidates);
+    TColgp_Array1OfPnt arrPnt(1,nbCandidates);
+    for (Standard_Integer j = 1; j <= nbCandidates; j++)
+      arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(mySewing.myVertexNode.FindKey(aCutting.Vertices[j-1])));
+    mySewing.ProjectPointsOnCurve(arrPnt,c3d,first,last,aCutting.Dist->ChangeArray1(),
+                                  aCutting.Para->ChangeArray1(),aCutting.Proj->ChangeArray1(),
+                                  Standard_True);
+  }
+
+private:
+  BRepBuilderAPI_CuttingFunctor& operator= (const BRepBuilderAPI_CuttingFunctor&);
+
+private:
+  const BRepBuilderAPI_Sewing& mySewing;
+  const BVH_IndexedBoxSet& myNodes;
+  NCollection_Array1<BRepBuilderAPI_BoundCutting>& myCuttings;
+};
+
 //=======================================================================
 //function : Cutting
 //purpose  : Modifies :
@@ -3629,81 +3932,48 @@ void BRepBuilderAPI_Sewing::Cutting(const Handle(Message_ProgressIndicator)& the
   if (!nbVertices) return;
   // Create a box tree with vertices
   Standard_Real eps = myTolerance*0.5;
-  BRepBuilderAPI_BndBoxTree aTree;
-  NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller (aTree);
-  BRepBuilderAPI_BndBoxTreeSelector aSelector;
+  Handle(BVH_IndexedBoxSet) aNodes = new BVH_IndexedBoxSet();
   for (i = 1; i <= nbVertices; i++) {
     gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
     Bnd_Box aBox;
     aBox.Set(pt);
     aBox.Enlarge(eps);
-    aTreeFiller.Add (i, aBox);
+    aNodes->Add (i, aBox);
   }
-  aTreeFiller.Fill();
+  aNodes->BVH();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location loc;
-  Standard_Real first, last;
-  // Iterate on all boundaries
+  // Find and project the candidate vertices for all bounds;
+  // the bounds failed in parallel mode are processed again below
   Standard_Integer nbBounds = myBoundFaces.Extent();
+  NCollection_Array1<BRepBuilderAPI_BoundCutting> aCuttings(1, nbBounds);
+  BRepBuilderAPI_CuttingFunctor aFunctor(*this, *aNodes, aCuttings);
+  OSD_Parallel::For(1, nbBounds + 1, aFunctor, !myRunParallel);
+
+  // Iterate on all boundaries
   Message_ProgressSentry aPS (thePI, "Cutting bounds", 0, nbBounds, 1);
-  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent()) continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
+  for (Standard_Integer iBound = 1; iBound <= nbBounds && aPS.More(); iBound++, aPS.Next()) {
+    BRepBuilderAPI_BoundCutting& aCutting = aCuttings(iBound);
+    if (!aCutting.IsDone) aFunctor.Perform(iBound);
+    Standard_Integer nbCandidates = (Standard_Integer )aCutting.Vertices.size();
+    if (!nbCandidates) continue;
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(iBound));
     // Create cutting sections
     TopTools_ListOfShape listSections;
     { //szv: Use brackets to destroy local variables
       // Obtain candidate vertices
       TopoDS_Vertex V1, V2;
+      TopExp::Vertices(bound,V1,V2);
       TopTools_IndexedMapOfShape CandidateVertices;
-      { //szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d,first,last);
-        BndLib_Add3dCurve::Add(adptC,myTolerance,aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent (aGlobalBox);
-        aTree.Select (aSelector); 
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent()) continue;
-        // Retrieve bound nodes
-        TopExp::Vertices(bound,V1,V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
-        // Fill map of candidate vertices
-        TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next()) {
-          const Standard_Integer index = itl.Value();
-          const TopoDS_Shape& Node = myVertexNode.FindFromIndex(index);
-          if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
-        }
-        aSelector.ClearResList();
-      }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates) continue;
-      // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1,nbCandidates), arrDist(1,nbCandidates);
-      TColgp_Array1OfPnt arrPnt(1,nbCandidates), arrProj(1,nbCandidates);
-      for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt,c3d,first,last,arrDist,arrPara,arrProj,Standard_True);
+      for (i = 0; i < nbCandidates; i++)
+        CandidateVertices.Add(myVertexNode.FindKey(aCutting.Vertices[i]));
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal seqPara;
       CreateCuttingNodes(CandidateVertices,bound,
-        V1,V2,arrDist,arrPara,arrProj,seqNode,seqPara);
+        V1,V2,aCutting.Dist->Array1(),aCutting.Para->Array1(),aCutting.Proj->Array1(),
+        seqNode,seqPara);
+      // Release projections of the processed bound
+      aCutting = BRepBuilderAPI_BoundCutting();
       if (!seqPara.Length()) continue;
       // Create cutting sections
       CreateSections(bound, seqNode, seqPara, listSections);
@@ -40,6 +40,10 @@
 #include <TColStd_Array1OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_SequenceOfReal.hxx>
+#include <TColgp_HArray1OfPnt.hxx>
+#include <Geom_Curve.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
 #include <Message_ProgressIndicator.hxx>
 
@@ -53,7 +57,6 @@ class TopoDS_Face;
 class Geom_Surface;
 class TopLoc_Location;
 class Geom2d_Curve;
-class Geom_Curve;
 
 
 class BRepBuilderAPI_Sewing;
@@ -231,6 +234,14 @@ public:
   //! in this case WorkTolerance = myTolerance + tolEdge1+ tolEdg2;
     void SetLocalTolerancesMode (const Standard_Boolean theLocalTolerancesMode);
   
+  //! Sets the flag to perform the analysis of faces, the search of cutting
+  //! vertices and the sampling of edges for merging in parallel threads.
+  //! The result does not depend on this flag. By default - false.
+    void SetRunParallel (const Standard_Boolean theIsParallel);
+  
+  //! Returns the flag of parallel processing.
+    Standard_Boolean RunParallel() const;
+  
   //! Sets mode for non-manifold sewing.
     void SetNonManifoldMode (const Standard_Boolean theNonManifoldMode);
   
@@ -368,14 +379,33 @@ protected:
 
 private:
 
+  friend class BRepBuilderAPI_CuttingFunctor;
+  friend class BRepBuilderAPI_SampleEdgeFunctor;
+
+  //! Points sampled on the edge curve with the state of the edge
+  //! (curve, range and tolerance) they have been computed for
+  struct EdgeSample
+  {
+    Handle(Geom_Curve)          Curve;
+    Standard_Real               First;
+    Standard_Real               Last;
+    Standard_Real               Tolerance;
+    Handle(TColgp_HArray1OfPnt) Points;
+
+    EdgeSample() : First (0.), Last (0.), Tolerance (0.) {}
+  };
 
   Standard_Boolean myFaceMode;
   Standard_Boolean myFloatingEdgesMode;
   Standard_Boolean mySameParameterMode;
   Standard_Boolean myLocalToleranceMode;
+  Standard_Boolean myRunParallel;
   Standard_Real myMinTolerance;
   Standard_Real myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
+  //! Points sampled on the bounds and sections before merging,
+  //! used by EvaluateDistances() while the edge is not modified
+  NCollection_DataMap<TopoDS_Shape, EdgeSample, TopTools_ShapeMapHasher> myEdgeSamples;
 
 
 };
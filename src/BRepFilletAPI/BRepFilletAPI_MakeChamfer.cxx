@@ -35,6 +35,16 @@ BRepFilletAPI_MakeChamfer::BRepFilletAPI_MakeChamfer(const TopoDS_Shape &S):myBu
 {
 }
 
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+
+void BRepFilletAPI_MakeChamfer::SetRunParallel(const Standard_Boolean theFlag)
+{
+  myBuilder.SetRunParallel(theFlag);
+}
+
 
 
 //=======================================================================
@@ -55,6 +55,10 @@ public:
   //! The edges on which chamfers are built are defined using the Add function.
   Standard_EXPORT BRepFilletAPI_MakeChamfer(const TopoDS_Shape& S);
   
+  //! Sets the flag of parallel computation of the surfaces
+  //! of the contours. The result does not depend on the flag.
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theFlag);
+  
   //! Adds edge E to the table of edges used by this
   //! algorithm to build chamfers, where the parameters
   //! of the chamfer must be set after the
@@ -71,6 +71,16 @@ void BRepFilletAPI_MakeFillet::SetContinuity(
   myBuilder.SetContinuity(InternalContinuity, AngleTol );
 }
 
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+
+void BRepFilletAPI_MakeFillet::SetRunParallel(const Standard_Boolean theFlag)
+{
+  myBuilder.SetRunParallel(theFlag);
+}
+
 //=======================================================================
 //function : Add
 //purpose  : 
@@ -76,6 +76,10 @@ public:
   //! and support'faces.
   Standard_EXPORT void SetContinuity (const GeomAbs_Shape InternalContinuity, const Standard_Real AngularTolerance);
   
+  //! Sets the flag of parallel computation of the surfaces
+  //! of the contours. The result does not depend on the flag.
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theFlag);
+  
   //! Adds a  fillet contour in  the  builder  (builds a
   //! contour  of tangent edges).
   //! The Radius must be set after.
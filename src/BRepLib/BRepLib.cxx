@@ -1081,12 +1081,23 @@ static Standard_Real ComputeTol(const Handle(Adaptor3d_HCurve)& c3d,
   Standard_Real first = c3d->FirstParameter();
   Standard_Real last  = c3d->LastParameter();
   Standard_Real dapp = -1.;
+
+  // evaluate both curves at all sample parameters at once
+  TColStd_Array1OfReal aParams(0, nbp);
   for (Standard_Integer i = 0; i <= nbp; ++i)
   {
     const Standard_Real t = IntToReal(i)/IntToReal(nbp);
-    const Standard_Real u = first*(1.-t) + last*t;
-    gp_Pnt Pc3d = c3d->Value(u);
-    gp_Pnt2d Puv = c2d->Value(u);
+    aParams(i) = first*(1.-t) + last*t;
+  }
+  TColgp_Array1OfPnt   aPnts3d(0, nbp);
+  TColgp_Array1OfPnt2d aPntsUV(0, nbp);
+  c3d->D0Array(aParams, aPnts3d);
+  c2d->D0Array(aParams, aPntsUV);
+
+  for (Standard_Integer i = 0; i <= nbp; ++i)
+  {
+    const gp_Pnt&   Pc3d = aPnts3d(i);
+    const gp_Pnt2d& Puv  = aPntsUV(i);
     if(!isUPeriodic)
     {
       if(Puv.X() < uf - du)
@@ -25,6 +25,7 @@
 #include <TopLoc_Location.hxx>
 #include <BRep_Tool.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS.hxx>
@@ -96,9 +97,7 @@ BRepMesh_EdgeTessellator::BRepMesh_EdgeTessellator(
         {
           Standard_Real aParam;
           gp_Pnt        aPoint3d;
-          gp_Pnt2d      aPoint2d;
           aDetalizator.Value( aNodeIt, aParam, aPoint3d);
-          myCurve2d.D0(aParam, aPoint2d);
 
           myTool->AddPoint( aPoint3d, aParam, Standard_False );
         }
@@ -152,11 +151,33 @@ BRepMesh_EdgeTessellator::BRepMesh_EdgeTessellator(
         aParamArray.SetValue(i, aParam);
       }
 
+      // evaluate the nodes once, they are shared by neighbouring segments
+      TColgp_Array1OfPnt2d aUVArray(1, aNodesNb);
+      aGACurve.D0Array(aParamArray, aUVArray);
+      TColgp_Array1OfPnt aPntArray(1, aNodesNb);
+      for (Standard_Integer i = 1; i <= aNodesNb; ++i)
+        aPntArray(i) = aSurf.Value(aUVArray(i).X(), aUVArray(i).Y());
+
       for (Standard_Integer i = 1; i < aNodesNb; ++i)
-        splitSegment(aSurf, aGACurve, aParamArray(i), aParamArray(i + 1), 1);
+        splitSegment(aSurf, aGACurve, aParamArray(i), aParamArray(i + 1),
+                     aUVArray(i), aUVArray(i + 1), aPntArray(i), aPntArray(i + 1), 1);
     }
   }
 
+  // Evaluate 2d points of all nodes at once
+  aNodesNb = myTool->NbPoints();
+  if (aNodesNb > 0)
+  {
+    TColStd_Array1OfReal aParamArray(1, aNodesNb);
+    for (Standard_Integer i = 1; i <= aNodesNb; ++i)
+    {
+      gp_Pnt aTmpPnt;
+      myTool->Value(i, aParamArray(i), aTmpPnt);
+    }
+    myNodesUV.Resize(1, aNodesNb, Standard_False);
+    myCurve2d.D0Array(aParamArray, myNodesUV);
+  }
+
    const Standard_Real aTol = Precision::Confusion();
    const Standard_Real aDu  = mySurface->UResolution (aTol);
    const Standard_Real aDv  = mySurface->VResolution (aTol);
@@ -178,8 +199,9 @@ Standard_Boolean BRepMesh_EdgeTessellator::Value(
   gp_Pnt&                thePoint,
   gp_Pnt2d&              theUV)
 {
-  myTool->Value(theIndex, theParameter, thePoint);
-  myCurve2d.D0(theParameter, theUV);
+  if (!myTool->Value(theIndex, theParameter, thePoint))
+    return Standard_False;
+  theUV = myNodesUV(theIndex);
 
   // If point coordinates are out of surface range, 
   // it is necessary to re-project point.
@@ -216,24 +238,27 @@ void BRepMesh_EdgeTessellator::splitSegment(
   const Geom2dAdaptor_Curve&  theCurve2d,
   const Standard_Real         theFirst,
   const Standard_Real         theLast,
+  const gp_Pnt2d&             theUVFirst,
+  const gp_Pnt2d&             theUVLast,
+  const gp_Pnt&               thePntFirst,
+  const gp_Pnt&               thePntLast,
   const Standard_Integer      theNbIter)
 {
   // limit iteration depth
   if(theNbIter > 10)
     return;
 
-  gp_Pnt2d uvf, uvl, uvm;
-  gp_Pnt   P3dF, P3dL, midP3d, midP3dFromSurf;
+  gp_Pnt2d uvm;
+  gp_Pnt   midP3d, midP3dFromSurf;
   Standard_Real midpar;
   
   if(Abs(theLast - theFirst) < 2 * Precision::PConfusion())
     return;
 
-  theCurve2d.D0(theFirst, uvf);
-  theCurve2d.D0(theLast,  uvl);
-
-  P3dF = theSurf.Value(uvf.X(), uvf.Y());
-  P3dL = theSurf.Value(uvl.X(), uvl.Y());
+  const gp_Pnt2d& uvf  = theUVFirst;
+  const gp_Pnt2d& uvl  = theUVLast;
+  const gp_Pnt&   P3dF = thePntFirst;
+  const gp_Pnt&   P3dL = thePntLast;
   
   if(P3dF.SquareDistance(P3dL) < mySquareMinSize)
     return;
@@ -259,6 +284,13 @@ void BRepMesh_EdgeTessellator::splitSegment(
   myCOnS.D0(midpar, midP3d);
   myTool->AddPoint(midP3d, midpar, Standard_False);
 
-  splitSegment(theSurf, theCurve2d, theFirst, midpar, theNbIter + 1);
-  splitSegment(theSurf, theCurve2d, midpar, theLast,  theNbIter + 1); 
+  if(theNbIter >= 10)
+    return;
+
+  gp_Pnt2d uvMid;
+  theCurve2d.D0(midpar, uvMid);
+  const gp_Pnt P3dMid = theSurf.Value(uvMid.X(), uvMid.Y());
+
+  splitSegment(theSurf, theCurve2d, theFirst, midpar, uvf, uvMid, P3dF, P3dMid, theNbIter + 1);
+  splitSegment(theSurf, theCurve2d, midpar, theLast, uvMid, uvl, P3dMid, P3dL, theNbIter + 1); 
 }
@@ -24,6 +24,7 @@
 #include <BRepMesh_FaceAttribute.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <Geom2dAdaptor_Curve.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 
 class Adaptor3d_Surface;
@@ -69,11 +70,18 @@ public:
 
 private:
 
-  //! 
+  //! Inserts middle points into the segment [theFirst, theLast] while its
+  //! deviation from the surface exceeds the deflection.
+  //! Points of the segment ends on the pcurve and on the surface are given
+  //! by the caller, so that each node is evaluated only once.
   void splitSegment(const Adaptor3d_Surface&    theSurf,
                     const Geom2dAdaptor_Curve&  theCurve2d,
                     const Standard_Real         theFirst,
                     const Standard_Real         theLast,
+                    const gp_Pnt2d&             theUVFirst,
+                    const gp_Pnt2d&             theUVLast,
+                    const gp_Pnt&               thePntFirst,
+                    const gp_Pnt&               thePntLast,
                     const Standard_Integer      theNbIter);
 
 private:
@@ -86,6 +94,7 @@ private:
   Standard_Real                         myEdgeSqTol;
   Standard_Real                         myFaceRangeU[2];
   Standard_Real                         myFaceRangeV[2];
+  TColgp_Array1OfPnt2d                  myNodesUV;
 };
 
 DEFINE_STANDARD_HANDLE(BRepMesh_EdgeTessellator, BRepMesh_IEdgeTool)
@@ -43,6 +43,7 @@
 #include <TColStd_ListOfInteger.hxx>
 #include <TColStd_SequenceOfReal.hxx>
 #include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array2OfBoolean.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <TopTools_DataMapOfShapeReal.hxx>
@@ -1255,21 +1256,66 @@ void BRepMesh_FastDiscretFace::insertInternalVerticesOther(
 #endif
 
   // insert nodes of the regular grid
+  const Standard_Integer aNbParams1 = aParams[0].Length();
+  const Standard_Integer aNbParams2 = aParams[1].Length();
+  if (aNbParams1 == 0 || aNbParams2 == 0)
+    return;
+
+  // classify the grid first, so that only rows and columns
+  // containing interior nodes are evaluated
   const BRepMesh::HClassifier& aClassifier = myAttribute->ChangeClassifier();
-  for (Standard_Integer i = 1; i <= aParams[0].Length(); ++i)
+  TColStd_Array2OfBoolean aIsInside(1, aNbParams1, 1, aNbParams2);
+  TColStd_Array1OfInteger aGridIndex1(1, aNbParams1), aGridIndex2(1, aNbParams2);
+  aGridIndex1.Init(0);
+  aGridIndex2.Init(0);
+  for (Standard_Integer i = 1; i <= aNbParams1; ++i)
   {
     const Standard_Real aParam1 = aParams[0].Value (i);
-    for (Standard_Integer j = 1; j <= aParams[1].Length(); ++j)
+    for (Standard_Integer j = 1; j <= aNbParams2; ++j)
     {
-      const Standard_Real aParam2 = aParams[1].Value (j);
-      gp_Pnt2d aPnt2d(aParam1, aParam2);
+      gp_Pnt2d aPnt2d(aParam1, aParams[1].Value (j));
 
       // Classify intersection point
-      if (aClassifier->Perform(aPnt2d) == TopAbs_IN)
+      aIsInside(i, j) = (aClassifier->Perform(aPnt2d) == TopAbs_IN);
+      if (aIsInside(i, j))
+      {
+        aGridIndex1(i) = 1;
+        aGridIndex2(j) = 1;
+      }
+    }
+  }
+
+  // number the rows and columns to be evaluated
+  Standard_Integer aNbGrid1 = 0, aNbGrid2 = 0;
+  for (Standard_Integer i = 1; i <= aNbParams1; ++i)
+    if (aGridIndex1(i) != 0)
+      aGridIndex1(i) = ++aNbGrid1;
+  for (Standard_Integer j = 1; j <= aNbParams2; ++j)
+    if (aGridIndex2(j) != 0)
+      aGridIndex2(j) = ++aNbGrid2;
+  if (aNbGrid1 == 0)
+    return;
+
+  // evaluate the reduced grid at once
+  TColStd_Array1OfReal aGridParams1(1, aNbGrid1), aGridParams2(1, aNbGrid2);
+  for (Standard_Integer i = 1; i <= aNbParams1; ++i)
+    if (aGridIndex1(i) != 0)
+      aGridParams1(aGridIndex1(i)) = aParams[0].Value (i);
+  for (Standard_Integer j = 1; j <= aNbParams2; ++j)
+    if (aGridIndex2(j) != 0)
+      aGridParams2(aGridIndex2(j)) = aParams[1].Value (j);
+  TColgp_Array2OfPnt aGridPnts(1, aNbGrid1, 1, aNbGrid2);
+  gFace->D0Grid(aGridParams1, aGridParams2, aGridPnts);
+
+  for (Standard_Integer i = 1; i <= aNbParams1; ++i)
+  {
+    for (Standard_Integer j = 1; j <= aNbParams2; ++j)
+    {
+      if (aIsInside(i, j))
       {
-        gp_Pnt aPnt;
-        gFace->D0(aPnt2d.X(), aPnt2d.Y(), aPnt);
-        insertVertex(aPnt, aPnt2d.Coord(), theNewVertices);
+        const Standard_Integer aGridI = aGridIndex1(i), aGridJ = aGridIndex2(j);
+        gp_XY aUV(aGridParams1(aGridI), aGridParams2(aGridJ));
+        insertVertex(aGridPnts(aGridI, aGridJ), aUV, theNewVertices);
       }
     }
   }
@@ -50,6 +50,173 @@
 #include <NCollection_UBTreeFiller.hxx>
 //
 #include <BOPTools_AlgoTools.hxx>
+//
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopoDS_TShape.hxx>
+
+//=======================================================================
+//class    : BRepOffset_FaceFaceInter
+//purpose  : Intersection of the pair of faces, planned by the
+//           algorithm to be performed together with the other ones
+//=======================================================================
+class BRepOffset_FaceFaceInter
+{
+public:
+
+  BRepOffset_FaceFaceInter()
+  : mySide (TopAbs_UNKNOWN),
+    myIsRefEdge (Standard_False),
+    myIsPipes (Standard_False)
+  {}
+
+  //! Initializes the intersection by BRepOffset_Tool::Inter3D(),
+  //! or by BRepOffset_Tool::PipeInter() if <theIsPipes> is TRUE.
+  void Init (const TopoDS_Face&     theF1,
+             const TopoDS_Face&     theF2,
+             const TopAbs_State     theSide,
+             const TopoDS_Edge&     theRefEdge,
+             const Standard_Boolean theIsRefEdge,
+             const Standard_Boolean theIsPipes = Standard_False)
+  {
+    myF1 = theF1;
+    myF2 = theF2;
+    mySide = theSide;
+    myRefEdge = theRefEdge;
+    myIsRefEdge = theIsRefEdge;
+    myIsPipes = theIsPipes;
+  }
+
+  void Perform()
+  {
+    if (myIsPipes) {
+      BRepOffset_Tool::PipeInter (myF1, myF2, myLInt1, myLInt2, mySide);
+    }
+    else {
+      BRepOffset_Tool::Inter3D (myF1, myF2, myLInt1, myLInt2, mySide, myRefEdge, myIsRefEdge);
+    }
+  }
+
+  const TopoDS_Face& Face1() const { return myF1; }
+
+  const TopoDS_Face& Face2() const { return myF2; }
+
+  const TopTools_ListOfShape& LInt1() const { return myLInt1; }
+
+  const TopTools_ListOfShape& LInt2() const { return myLInt2; }
+
+private:
+
+  TopoDS_Face myF1;
+  TopoDS_Face myF2;
+  TopAbs_State mySide;
+  TopoDS_Edge myRefEdge;
+  Standard_Boolean myIsRefEdge;
+  Standard_Boolean myIsPipes;
+  TopTools_ListOfShape myLInt1;
+  TopTools_ListOfShape myLInt2;
+};
+
+typedef NCollection_Vector<BRepOffset_FaceFaceInter> BRepOffset_VectorOfFaceFaceInter;
+
+//=======================================================================
+//class    : BRepOffset_FaceFaceInterFunctor
+//purpose  : Performs the intersections of one batch
+//=======================================================================
+class BRepOffset_FaceFaceInterFunctor
+{
+public:
+
+  BRepOffset_FaceFaceInterFunctor (BRepOffset_VectorOfFaceFaceInter&           theInters,
+                                   const NCollection_Vector<Standard_Integer>& theBatch)
+  : myInters (theInters),
+    myBatch (theBatch)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    myInters.ChangeValue (myBatch (theIndex)).Perform();
+  }
+
+private:
+
+  BRepOffset_FaceFaceInterFunctor& operator= (const BRepOffset_FaceFaceInterFunctor&);
+
+  BRepOffset_VectorOfFaceFaceInter&           myInters;
+  const NCollection_Vector<Standard_Integer>& myBatch;
+};
+
+//=======================================================================
+//function : PerformInters
+//purpose  : Performs the planned intersections of the pairs of faces.
+//           BRepOffset_Tool::Inter3D() updates the sub-shapes of the
+//           intersected faces (3D curves, tolerances), therefore the
+//           pairs sharing sub-shapes are intersected in the order of
+//           planning, and only independent pairs are intersected
+//           simultaneously.
+//=======================================================================
+static void PerformInters (BRepOffset_VectorOfFaceFaceInter& theInters,
+                           const Standard_Boolean            theRunParallel)
+{
+  Standard_Integer i, j;
+  const Standard_Integer aNbInters = theInters.Length();
+  if (!theRunParallel || aNbInters < 2) {
+    for (i = 0; i < aNbInters; ++i) {
+      theInters.ChangeValue (i).Perform();
+    }
+    return;
+  }
+  //
+  // Put each intersection into the batch following the last batch
+  // in which the sub-shapes of its faces are used
+  NCollection_Vector<NCollection_Vector<Standard_Integer> > aBatches;
+  NCollection_DataMap<Handle(TopoDS_TShape), Standard_Integer> aMSBatch;
+  for (i = 0; i < aNbInters; ++i) {
+    const BRepOffset_FaceFaceInter& anInter = theInters (i);
+    TopTools_IndexedMapOfShape aMS;
+    TopExp::MapShapes (anInter.Face1(), aMS);
+    TopExp::MapShapes (anInter.Face2(), aMS);
+    //
+    Standard_Integer aBatch = 0;
+    const Standard_Integer aNbS = aMS.Extent();
+    for (j = 1; j <= aNbS; ++j) {
+      const Standard_Integer* pBatch = aMSBatch.Seek (aMS(j).TShape());
+      if (pBatch && *pBatch >= aBatch) {
+        aBatch = *pBatch + 1;
+      }
+    }
+    for (j = 1; j <= aNbS; ++j) {
+      aMSBatch.Bind (aMS(j).TShape(), aBatch);
+    }
+    //
+    if (aBatch == aBatches.Length()) {
+      aBatches.Append (NCollection_Vector<Standard_Integer>());
+    }
+    aBatches.ChangeValue (aBatch).Append (i);
+  }
+  //
+  const Standard_Integer aNbBatches = aBatches.Length();
+  for (i = 0; i < aNbBatches; ++i) {
+    const NCollection_Vector<Standard_Integer>& aBatch = aBatches (i);
+    BRepOffset_FaceFaceInterFunctor aFunctor (theInters, aBatch);
+    OSD_Parallel::For (0, aBatch.Length(), aFunctor);
+  }
+}
+
+//=======================================================================
+//struct   : BRepOffset_ConnexPair
+//purpose  : Pair of connected faces treated by ConnexIntByInt
+//=======================================================================
+struct BRepOffset_ConnexPair
+{
+  Standard_Integer ShapeIndex; //!< index of the connecting edge or vertex
+  TopoDS_Face      F1;         //!< initial faces
+  TopoDS_Face      F2;
+  TopoDS_Face      NF1;        //!< extended offset faces
+  TopoDS_Face      NF2;
+  Standard_Integer InterIndex; //!< index of the planned intersection or -1
+};
 
 //=======================================================================
 //function : BRepOffset_Inter3d
@@ -60,10 +227,20 @@ BRepOffset_Inter3d::BRepOffset_Inter3d(const Handle(BRepAlgo_AsDes)& AsDes,
                                        const Standard_Real           Tol)
 :myAsDes(AsDes),
 mySide(Side),
-myTol(Tol)
+myTol(Tol),
+myRunParallel(Standard_False)
 {
 }
 
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+void BRepOffset_Inter3d::SetRunParallel(const Standard_Boolean theFlag)
+{
+  myRunParallel = theFlag;
+}
+
 
 //=======================================================================
 //function : ExtentEdge
@@ -256,9 +433,10 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
   BRepOffset_Type    OT   = BRepOffset_Concave;
   if (mySide == TopAbs_OUT) OT   = BRepOffset_Convex;
   TopExp_Explorer                Exp(ShapeInit,TopAbs_EDGE);
-  TopTools_ListOfShape           LInt1,LInt2;
   TopoDS_Face                    F1,F2;
   TopoDS_Edge                    NullEdge;
+  // intersections are planned first and performed all together
+  BRepOffset_VectorOfFaceFaceInter aInters;
 
   //---------------------------------------------------------------------
   // etape 1 : Intersection of faces // corresponding to the initial faces 
@@ -276,8 +454,8 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
         F1 = TopoDS::Face(InitOffsetFace.Image(Anc.First()).First());
         F2 = TopoDS::Face(InitOffsetFace.Image(Anc.Last ()).First());
         if (!IsDone(F1,F2)) {
-          BRepOffset_Tool::Inter3D (F1,F2,LInt1,LInt2,mySide,E,Standard_True);
-          Store (F1,F2,LInt1,LInt2);
+          aInters.Append(BRepOffset_FaceFaceInter()).Init(F1,F2,mySide,E,Standard_True);
+          SetDone(F1,F2);
         }
       }          
     }
@@ -338,8 +516,8 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
                 //---------------------------------------------------------------------
                 // Intersection tube/tube if the edges are not tangent (AFINIR).
                 //----------------------------------------------------------------------
-                BRepOffset_Tool::PipeInter (F1,F2,LInt1,LInt2,mySide);
-                Store (F1,F2,LInt1,LInt2);
+                aInters.Append(BRepOffset_FaceFaceInter()).Init(F1,F2,mySide,NullEdge,Standard_False,Standard_True);
+                SetDone(F1,F2);
               }
             }
             else {
@@ -361,8 +539,8 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
                 if (!TangentFaces) {
                   F2 = TopoDS::Face(InitOffsetFace.Image(InitF2).First());
                   if (!IsDone(F1,F2)) {
-                    BRepOffset_Tool::Inter3D (F1,F2,LInt1,LInt2,mySide,NullEdge);
-                    Store (F1,F2,LInt1,LInt2);
+                    aInters.Append(BRepOffset_FaceFaceInter()).Init(F1,F2,mySide,NullEdge,Standard_False);
+                    SetDone(F1,F2);
                   }
                 }
                 InitF2 = TopoDS::Face(AncE2.Last ());
@@ -371,8 +549,8 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
                 if (!TangentFaces) {
                   F2 = TopoDS::Face(InitOffsetFace.Image(InitF2).First());
                   if (!IsDone(F1,F2)) {
-                    BRepOffset_Tool::Inter3D (F1,F2,LInt1,LInt2,mySide,NullEdge);
-                    Store (F1,F2,LInt1,LInt2);
+                    aInters.Append(BRepOffset_FaceFaceInter()).Init(F1,F2,mySide,NullEdge,Standard_False);
+                    SetDone(F1,F2);
                   }
                 }
               }
@@ -382,6 +560,17 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
       }
     }
   }
+  //---------------------------------------------------------------------
+  // Perform the planned intersections and store the results in the
+  // order of planning.
+  //---------------------------------------------------------------------
+  PerformInters (aInters, myRunParallel);
+  //
+  const Standard_Integer aNbInters = aInters.Length();
+  for (Standard_Integer i = 0; i < aNbInters; ++i) {
+    const BRepOffset_FaceFaceInter& anInter = aInters(i);
+    StoreInter (anInter.Face1(),anInter.Face2(),anInter.LInt1(),anInter.LInt2());
+  }
 }
 
 
@@ -420,6 +609,10 @@ void BRepOffset_Inter3d::ConnexIntByInt
   //
   TopTools_DataMapOfShapeListOfShape aDMVLF1, aDMVLF2, aDMIntFF;
   TopTools_IndexedDataMapOfShapeListOfShape aDMIntE;
+  // pairs of faces met in the order of treatment
+  // and the intersections planned for them
+  NCollection_Vector<BRepOffset_ConnexPair> aPairs;
+  BRepOffset_VectorOfFaceFaceInter aInters;
   //
   if (bIsPlanar) {
     aNb = VEmap.Extent();
@@ -563,82 +756,109 @@ void BRepOffset_Inter3d::ConnexIntByInt
         NF2 = TopoDS::Face(MES(OF2));
       }
       //
+      BRepOffset_ConnexPair& aPair = aPairs.Append(BRepOffset_ConnexPair());
+      aPair.ShapeIndex = i;
+      aPair.F1 = F1;
+      aPair.F2 = F2;
+      aPair.NF1 = NF1;
+      aPair.NF2 = NF2;
+      aPair.InterIndex = -1;
       if (!IsDone(NF1,NF2)) {
-        TopTools_ListOfShape LInt1,LInt2;
-        BRepOffset_Tool::Inter3D (NF1,NF2,LInt1,LInt2,CurSide,E,bEdge);
+        aPair.InterIndex = aInters.Length();
+        aInters.Append(BRepOffset_FaceFaceInter()).Init(NF1,NF2,CurSide,E,bEdge);
         SetDone(NF1,NF2);
-        if (!LInt1.IsEmpty()) {
-          Store (NF1,NF2,LInt1,LInt2);
-          //
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS)) {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next()) {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
-          }
-          //
-          it.Initialize(LInt1);
-          for (; it.More(); it.Next()) {
-            const TopoDS_Shape& aNE = it.Value();
+      }
+    }
+  }
+  //
+  // perform the planned intersections
+  PerformInters (aInters, myRunParallel);
+  //
+  // treat the pairs of faces in the order of planning
+  aNb = aPairs.Length();
+  for (i = 0; i < aNb; ++i) {
+    const BRepOffset_ConnexPair& aPair = aPairs(i);
+    const TopoDS_Shape& aS = VEmap(aPair.ShapeIndex);
+    F1  = aPair.F1;
+    F2  = aPair.F2;
+    NF1 = aPair.NF1;
+    NF2 = aPair.NF2;
+    //
+    if (aPair.InterIndex >= 0) {
+      const BRepOffset_FaceFaceInter& anInter = aInters(aPair.InterIndex);
+      const TopTools_ListOfShape& LInt1 = anInter.LInt1();
+      const TopTools_ListOfShape& LInt2 = anInter.LInt2();
+      if (!LInt1.IsEmpty()) {
+        Store (NF1,NF2,LInt1,LInt2);
+        //
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS)) {
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next()) {
+            const TopoDS_Shape& aNE = aExp.Current();
             B.Add(C, aNE);
-            //
-            // keep connection from new edge to shape from which it was created
-            TopTools_ListOfShape *pLS = &aDMIntE(aDMIntE.Add(aNE, TopTools_ListOfShape()));
-            pLS->Append(aS);
-            // keep connection to faces created the edge as well
-            TopTools_ListOfShape* pLFF = aDMIntFF.Bound(aNE, TopTools_ListOfShape());
-            pLFF->Append(F1);
-            pLFF->Append(F2);
           }
-          //
-          Build.Bind(aS,C);
-        }
-        else {
-          Failed.Append(aS);
         }
-      } else { // IsDone(NF1,NF2)
-        //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
-        const TopTools_ListOfShape &aLInt1 = myAsDes->Descendant(NF1);
-        const TopTools_ListOfShape &aLInt2 = myAsDes->Descendant(NF2);
-        
-        if (!aLInt1.IsEmpty()) {
-          TopoDS_Compound C;
-          B.MakeCompound(C);
+        //
+        it.Initialize(LInt1);
+        for (; it.More(); it.Next()) {
+          const TopoDS_Shape& aNE = it.Value();
+          B.Add(C, aNE);
           //
-          if (Build.IsBound(aS)) {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next()) {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
+          // keep connection from new edge to shape from which it was created
+          TopTools_ListOfShape *pLS = &aDMIntE(aDMIntE.Add(aNE, TopTools_ListOfShape()));
+          pLS->Append(aS);
+          // keep connection to faces created the edge as well
+          TopTools_ListOfShape* pLFF = aDMIntFF.Bound(aNE, TopTools_ListOfShape());
+          pLFF->Append(F1);
+          pLFF->Append(F2);
+        }
+        //
+        Build.Bind(aS,C);
+      }
+      else {
+        Failed.Append(aS);
+      }
+    } else { // IsDone(NF1,NF2)
+      //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
+      const TopTools_ListOfShape &aLInt1 = myAsDes->Descendant(NF1);
+      const TopTools_ListOfShape &aLInt2 = myAsDes->Descendant(NF2);
+      
+      if (!aLInt1.IsEmpty()) {
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS)) {
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next()) {
+            const TopoDS_Shape& aNE = aExp.Current();
+            B.Add(C, aNE);
           }
+        }
+        //
+        for (it.Initialize(aLInt1) ; it.More(); it.Next()) {
+          const TopoDS_Shape &anE1 = it.Value();
           //
-          for (it.Initialize(aLInt1) ; it.More(); it.Next()) {
-            const TopoDS_Shape &anE1 = it.Value();
-            //
-            for (it1.Initialize(aLInt2) ; it1.More(); it1.Next()) {
-              const TopoDS_Shape &anE2 = it1.Value();
-              if (anE1.IsSame(anE2)) {
-                B.Add(C, anE1);
-                //
-                TopTools_ListOfShape *pLS = aDMIntE.ChangeSeek(anE1);
-                if (pLS) {
-                  pLS->Append(aS);
-                }
+          for (it1.Initialize(aLInt2) ; it1.More(); it1.Next()) {
+            const TopoDS_Shape &anE2 = it1.Value();
+            if (anE1.IsSame(anE2)) {
+              B.Add(C, anE1);
+              //
+              TopTools_ListOfShape *pLS = aDMIntE.ChangeSeek(anE1);
+              if (pLS) {
+                pLS->Append(aS);
               }
             }
           }
-          Build.Bind(aS,C);
-        }
-        else {
-          Failed.Append(aS);
         }
+        Build.Bind(aS,C);
+      }
+      else {
+        Failed.Append(aS);
       }
     }
     //  Modified by skv - Fri Dec 26 12:20:14 2003 OCC4455 End
@@ -1288,6 +1508,20 @@ void BRepOffset_Inter3d::Store(const TopoDS_Face& F1,
                                const TopoDS_Face& F2, 
                                const TopTools_ListOfShape& LInt1, 
                                const TopTools_ListOfShape& LInt2)
+{
+  StoreInter(F1,F2,LInt1,LInt2);
+  SetDone(F1,F2);
+}
+
+//=======================================================================
+//function : StoreInter
+//purpose  : 
+//=======================================================================
+
+void BRepOffset_Inter3d::StoreInter(const TopoDS_Face& F1, 
+                                    const TopoDS_Face& F2, 
+                                    const TopTools_ListOfShape& LInt1, 
+                                    const TopTools_ListOfShape& LInt2)
 {
   if (!LInt1.IsEmpty()) {
     myTouched.Add(F1);
@@ -1299,5 +1533,4 @@ void BRepOffset_Inter3d::Store(const TopoDS_Face& F1,
       myNewEdges.Add(it.Value());
     }
   }
-  SetDone(F1,F2);
 }
@@ -47,6 +47,12 @@ public:
   
   Standard_EXPORT BRepOffset_Inter3d(const Handle(BRepAlgo_AsDes)& AsDes, const TopAbs_State Side, const Standard_Real Tol);
   
+  //! Sets the flag of parallel processing of the intersections
+  //! in ConnexIntByArc() and ConnexIntByInt(). The pairs of faces
+  //! sharing sub-shapes are still intersected in the serial order,
+  //! so the result does not depend on this flag.
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theFlag);
+  
   Standard_EXPORT void CompletInt (const TopTools_ListOfShape& SetOfFaces, const BRepAlgo_Image& InitOffsetFace);
   
   Standard_EXPORT void FaceInter (const TopoDS_Face& F1, const TopoDS_Face& F2, const BRepAlgo_Image& InitOffsetFace);
@@ -84,6 +90,10 @@ private:
 
   
   Standard_EXPORT void Store (const TopoDS_Face& F1, const TopoDS_Face& F2, const TopTools_ListOfShape& LInt1, const TopTools_ListOfShape& LInt2);
+  
+  //! Stores the intersection edges of the faces <F1> and <F2>
+  //! without marking the pair as done.
+  Standard_EXPORT void StoreInter (const TopoDS_Face& F1, const TopoDS_Face& F2, const TopTools_ListOfShape& LInt1, const TopTools_ListOfShape& LInt2);
 
 
   Handle(BRepAlgo_AsDes) myAsDes;
@@ -92,6 +102,7 @@ private:
   TopTools_IndexedMapOfShape myNewEdges;
   TopAbs_State mySide;
   Standard_Real myTol;
+  Standard_Boolean myRunParallel;
 
 
 };
@@ -113,8 +113,11 @@
 #include <Geom_Line.hxx>
 #include <NCollection_Vector.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
 //
 #include <BOPAlgo_MakerVolume.hxx>
+#include <BOPAlgo_Options.hxx>
 #include <BOPTools_AlgoTools.hxx>
 
 #include <stdio.h>
@@ -566,6 +569,7 @@ static void FillContours(const TopoDS_Shape& aShape,
 //=======================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+: myRunParallel (BOPAlgo_Options::GetParallelMode())
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -595,7 +599,8 @@ mySelfInter  (SelfInter),
 myJoin       (Join),
 myThickening    (Thickening),
 myRemoveIntEdges(RemoveIntEdges),
-myDone     (Standard_False)
+myDone     (Standard_False),
+myRunParallel (BOPAlgo_Options::GetParallelMode())
 {
   myAsDes = new BRepAlgo_AsDes();
   MakeOffsetShape();
@@ -826,6 +831,7 @@ void BRepOffset_MakeOffset::MakeOffsetShape()
   // Intersection 3d .
   //-----------------
   BRepOffset_Inter3d Inter(myAsDes,Side,myTol);
+  Inter.SetRunParallel(myRunParallel);
   Intersection3D (Inter);
   //-----------------
   // Intersection2D
@@ -1029,6 +1035,44 @@ const TopoDS_Shape&  BRepOffset_MakeOffset::Shape() const
   return myOffsetShape;
 }
 
+//=======================================================================
+//class    : BRepOffset_OffsetFaceFunctor
+//purpose  : Builds the offsets of the faces having no tangent edges
+//=======================================================================
+class BRepOffset_OffsetFaceFunctor
+{
+public:
+
+  BRepOffset_OffsetFaceFunctor (const NCollection_Vector<TopoDS_Face>&   theFaces,
+                                const NCollection_Vector<Standard_Real>& theOffsets,
+                                const Standard_Boolean                   theOffsetOutside,
+                                const GeomAbs_JoinType                   theJoin,
+                                NCollection_Vector<BRepOffset_Offset>&   theResults)
+  : myFaces (theFaces),
+    myOffsets (theOffsets),
+    myOffsetOutside (theOffsetOutside),
+    myJoin (theJoin),
+    myResults (theResults)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopTools_DataMapOfShapeShape anEmptyMap;
+    myResults.ChangeValue (theIndex).Init (myFaces (theIndex), myOffsets (theIndex),
+                                           anEmptyMap, myOffsetOutside, myJoin);
+  }
+
+private:
+
+  BRepOffset_OffsetFaceFunctor& operator= (const BRepOffset_OffsetFaceFunctor&);
+
+  const NCollection_Vector<TopoDS_Face>&   myFaces;
+  const NCollection_Vector<Standard_Real>& myOffsets;
+  const Standard_Boolean                   myOffsetOutside;
+  const GeomAbs_JoinType                   myJoin;
+  NCollection_Vector<BRepOffset_Offset>&   myResults;
+};
+
 //=======================================================================
 //function : MakeOffsetFaces
 //purpose  : 
@@ -1044,9 +1088,41 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& the
   //
   BRepLib::SortFaces(myShape, aLF);
   //
+  // The faces having no tangent edges share nothing with the offsets
+  // of the other faces (ShapeTgt), so their offsets are built in advance
+  // in parallel threads.
+  TopTools_DataMapOfShapeInteger aMFInd;
+  NCollection_Vector<BRepOffset_Offset> aOffsets;
+  if (myRunParallel) {
+    NCollection_Vector<TopoDS_Face> aFaces;
+    NCollection_Vector<Standard_Real> aFaceOffsets;
+    aItLF.Initialize(aLF);
+    for (; aItLF.More(); aItLF.Next()) {
+      const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+      TopTools_ListOfShape Let;
+      myAnalyse.Edges(aF,BRepOffset_Tangent,Let);
+      if (Let.IsEmpty() && aMFInd.Bind(aF, aFaces.Length())) {
+        aFaces.Append(aF);
+        aFaceOffsets.Append(myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset);
+      }
+    }
+    //
+    const Standard_Integer aNbF = aFaces.Length();
+    if (aNbF > 0) {
+      aOffsets.SetValue(aNbF - 1, BRepOffset_Offset());
+    }
+    BRepOffset_OffsetFaceFunctor aFunctor(aFaces, aFaceOffsets, OffsetOutside, myJoin, aOffsets);
+    OSD_Parallel::For(0, aNbF, aFunctor, aNbF < 2);
+  }
+  //
   aItLF.Initialize(aLF);
   for (; aItLF.More(); aItLF.Next()) {
     const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+    const Standard_Integer* pInd = aMFInd.Seek(aF);
+    if (pInd) {
+      theMapSF.Bind(aF,aOffsets(*pInd));
+      continue;
+    }
     aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
     BRepOffset_Offset OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
     TopTools_ListOfShape Let;
@@ -1121,6 +1197,7 @@ void BRepOffset_MakeOffset::BuildOffsetByInter()
   if (myOffset > 0) ExtentContext = 1;
 
   BRepOffset_Inter3d Inter3 (AsDes,Side,myTol);
+  Inter3.SetRunParallel(myRunParallel);
   // Intersection between parallel faces
   Inter3.ConnexIntByInt(myShape,MapSF,myAnalyse,MES,Build,Failed,myIsPlanar);
   // Intersection with caps.
@@ -3666,6 +3743,24 @@ const TopoDS_Shape& BRepOffset_MakeOffset::GetBadShape() const
   return myBadShape;
 }
 
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+void BRepOffset_MakeOffset::SetRunParallel(const Standard_Boolean theFlag)
+{
+  myRunParallel = theFlag;
+}
+
+//=======================================================================
+//function : RunParallel
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepOffset_MakeOffset::RunParallel() const
+{
+  return myRunParallel;
+}
+
 //=======================================================================
 //function : RemoveInternalEdges
 //purpose  : 
@@ -121,6 +121,16 @@ public:
   //! Return bad shape, which obtained in CheckInputData.
   Standard_EXPORT const TopoDS_Shape& GetBadShape() const;
 
+  //! Sets the flag of parallel processing. In the parallel mode the
+  //! offset faces are built and intersected in several threads,
+  //! the result being the same as in the serial mode.
+  //! By default, the global parallel mode of the Boolean
+  //! operations (BOPAlgo_Options::GetParallelMode()) is used.
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theFlag);
+
+  //! Returns the flag of parallel processing.
+  Standard_EXPORT Standard_Boolean RunParallel() const;
+
 
 protected:
 
@@ -217,6 +227,7 @@ private:
   Standard_Boolean myIsPerformSewing; // Handle bad walls in thicksolid mode.
   Standard_Boolean myIsPlanar;
   TopoDS_Shape myBadShape;
+  Standard_Boolean myRunParallel;
 
 };
 
@@ -61,6 +61,7 @@ static Standard_Real ta  = 1.e-2;
 static Standard_Real fl  = 1.e-3;
 static Standard_Real tapp_angle = 1.e-2;
 static GeomAbs_Shape blend_cont = GeomAbs_C1;
+static Standard_Boolean blend_parallel = Standard_False;
 
 static BRepFilletAPI_MakeFillet* Rakk = 0;
 static BRepFilletAPI_MakeFillet* Rake = 0;
@@ -110,6 +111,17 @@ static Standard_Integer contblend(Draw_Interpretor& di, Standard_Integer narg, c
   }
 }
 
+static Standard_Integer parallelblend(Draw_Interpretor& di, Standard_Integer narg, const char** a)
+{
+  if (narg == 1) {
+    di << (blend_parallel ? 1 : 0) << "\n";
+    return 0;
+  }
+  if (narg > 2) return 1;
+  blend_parallel = (Draw::Atoi(a[1]) != 0);
+  return 0;
+}
+
 static void printtolblend(Draw_Interpretor& di)
 {
   //cout<<"tolerance ang : "<<ta<<endl;
@@ -161,6 +173,7 @@ static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer narg, const
   Rakk = new BRepFilletAPI_MakeFillet(V,FSh);
   Rakk->SetParams(ta,t3d,t2d,t3d,t2d,fl);
   Rakk->SetContinuity(blend_cont, tapp_angle);
+  Rakk->SetRunParallel(blend_parallel);
   Standard_Real Rad;
   TopoDS_Edge E;
   Standard_Integer nbedge = 0;
@@ -719,6 +732,10 @@ void  BRepTest::FilletCommands(Draw_Interpretor& theCommands)
 		  "tolblend [ta t3d t2d fl]",__FILE__,
 		  tolblend,g);
 
+  theCommands.Add("parallelblend",
+		  "parallelblend [0/1] : switches parallel computation of the contours by blend",__FILE__,
+		  parallelblend,g);
+
   theCommands.Add("blend",
 		  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P]",__FILE__,
 		  BLEND,g);
@@ -342,6 +342,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   Standard_Boolean aSameParameterMode = Standard_True;
   Standard_Boolean aFloatingEdgesMode = Standard_False;
   Standard_Boolean aFaceMode = Standard_True;
+  Standard_Boolean aRunParallel = Standard_False;
   Standard_Boolean aSetMinTol = Standard_False;
   Standard_Real aMinTol = 0.;
   Standard_Real aMaxTol = Precision::Infinite();
@@ -387,6 +388,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
       case 'p': aSameParameterMode = aVal; break;
       case 'e': aFloatingEdgesMode = aVal; break;
       case 'f': aFaceMode = aVal; break;
+      case 'r': aRunParallel = aVal; break;
       }
     }
     else
@@ -423,6 +425,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "  r - mode for parallel processing\n";
     return (1);
   }
     
@@ -449,6 +452,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   aSewing.SetFaceMode (aFaceMode);
   aSewing.SetMinTolerance (aMinTol);
   aSewing.SetMaxTolerance (aMaxTol);
+  aSewing.SetRunParallel (aRunParallel);
 
   for (Standard_Integer i = 1; i <= aSeq.Length(); i++)
     aSewing.Add(aSeq.Value(i));
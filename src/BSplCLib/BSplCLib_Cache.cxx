@@ -13,6 +13,7 @@
 
 #include <BSplCLib_Cache.hxx>
 #include <BSplCLib.hxx>
+#include <BSplCLib_Horner.hxx>
 
 #include <NCollection_LocalArray.hxx>
 
@@ -271,3 +272,124 @@ void BSplCLib_Cache::D3(const Standard_Real& theParameter,
   theTorsion.SetCoord(aPntDeriv[aShift], aPntDeriv[aShift + 1], aPntDeriv[aShift + 2]);
 }
 
+
+
+void BSplCLib_Cache::D0Array(const TColStd_Array1OfReal& theParams,
+                             const Standard_Integer      theFrom,
+                             const Standard_Integer      theTo,
+                                   TColgp_Array1OfPnt2d& thePoints) const
+{
+  const Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Real anInvLength = 1.0 / myParams.SpanLength;
+  Standard_Real aPoint[3];
+  if (myIsRational)
+  {
+    for (Standard_Integer i = theFrom; i <= theTo; i++)
+    {
+      const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+      BSplCLib_Horner::Eval<3>(aParam, myParams.Degree, aPolesArray, aPoint);
+      thePoints(i).SetCoord(aPoint[0] / aPoint[2], aPoint[1] / aPoint[2]);
+    }
+    return;
+  }
+
+  for (Standard_Integer i = theFrom; i <= theTo; i++)
+  {
+    const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+    BSplCLib_Horner::Eval<2>(aParam, myParams.Degree, aPolesArray, aPoint);
+    thePoints(i).SetCoord(aPoint[0], aPoint[1]);
+  }
+}
+
+void BSplCLib_Cache::D0Array(const TColStd_Array1OfReal& theParams,
+                             const Standard_Integer      theFrom,
+                             const Standard_Integer      theTo,
+                                   TColgp_Array1OfPnt&   thePoints) const
+{
+  const Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Real anInvLength = 1.0 / myParams.SpanLength;
+  Standard_Real aPoint[4];
+  if (myIsRational)
+  {
+    for (Standard_Integer i = theFrom; i <= theTo; i++)
+    {
+      const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+      BSplCLib_Horner::Eval<4>(aParam, myParams.Degree, aPolesArray, aPoint);
+      thePoints(i).SetCoord(aPoint[0] / aPoint[3], aPoint[1] / aPoint[3], aPoint[2] / aPoint[3]);
+    }
+    return;
+  }
+
+  for (Standard_Integer i = theFrom; i <= theTo; i++)
+  {
+    const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+    BSplCLib_Horner::Eval<3>(aParam, myParams.Degree, aPolesArray, aPoint);
+    thePoints(i).SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+  }
+}
+
+void BSplCLib_Cache::D1Array(const TColStd_Array1OfReal& theParams,
+                             const Standard_Integer      theFrom,
+                             const Standard_Integer      theTo,
+                                   TColgp_Array1OfPnt2d& thePoints,
+                                   TColgp_Array1OfVec2d& theTangents) const
+{
+  const Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Real anInvLength = 1.0 / myParams.SpanLength;
+  Standard_Real aPoint[3], aDeriv[3];
+  if (myIsRational)
+  {
+    for (Standard_Integer i = theFrom; i <= theTo; i++)
+    {
+      const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+      // derivative of the quotient: (P' - P * w') / w
+      BSplCLib_Horner::EvalD1<3>(aParam, myParams.Degree, aPolesArray, aPoint, aDeriv);
+      const Standard_Real anInvWeight = 1.0 / aPoint[2];
+      const gp_XY aPnt (aPoint[0] * anInvWeight, aPoint[1] * anInvWeight);
+      thePoints(i).SetXY(aPnt);
+      theTangents(i).SetXY((gp_XY(aDeriv[0], aDeriv[1]) - aPnt * aDeriv[2]) * (anInvWeight * anInvLength));
+    }
+    return;
+  }
+
+  for (Standard_Integer i = theFrom; i <= theTo; i++)
+  {
+    const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+    BSplCLib_Horner::EvalD1<2>(aParam, myParams.Degree, aPolesArray, aPoint, aDeriv);
+    thePoints(i).SetCoord(aPoint[0], aPoint[1]);
+    theTangents(i).SetCoord(aDeriv[0] * anInvLength, aDeriv[1] * anInvLength);
+  }
+}
+
+void BSplCLib_Cache::D1Array(const TColStd_Array1OfReal& theParams,
+                             const Standard_Integer      theFrom,
+                             const Standard_Integer      theTo,
+                                   TColgp_Array1OfPnt&   thePoints,
+                                   TColgp_Array1OfVec&   theTangents) const
+{
+  const Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Real anInvLength = 1.0 / myParams.SpanLength;
+  Standard_Real aPoint[4], aDeriv[4];
+  if (myIsRational)
+  {
+    for (Standard_Integer i = theFrom; i <= theTo; i++)
+    {
+      const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+      // derivative of the quotient: (P' - P * w') / w
+      BSplCLib_Horner::EvalD1<4>(aParam, myParams.Degree, aPolesArray, aPoint, aDeriv);
+      const Standard_Real anInvWeight = 1.0 / aPoint[3];
+      const gp_XYZ aPnt (aPoint[0] * anInvWeight, aPoint[1] * anInvWeight, aPoint[2] * anInvWeight);
+      thePoints(i).SetXYZ(aPnt);
+      theTangents(i).SetXYZ((gp_XYZ(aDeriv[0], aDeriv[1], aDeriv[2]) - aPnt * aDeriv[3]) * (anInvWeight * anInvLength));
+    }
+    return;
+  }
+
+  for (Standard_Integer i = theFrom; i <= theTo; i++)
+  {
+    const Standard_Real aParam = (myParams.PeriodicNormalization (theParams(i)) - myParams.SpanStart) * anInvLength;
+    BSplCLib_Horner::EvalD1<3>(aParam, myParams.Degree, aPolesArray, aPoint, aDeriv);
+    thePoints(i).SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+    theTangents(i).SetCoord(aDeriv[0] * anInvLength, aDeriv[1] * anInvLength, aDeriv[2] * anInvLength);
+  }
+}
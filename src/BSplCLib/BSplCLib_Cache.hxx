@@ -29,6 +29,8 @@
 #include <TColStd_Array1OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <TColgp_Array1OfVec2d.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -132,6 +134,35 @@ public:
                                 gp_Vec&        theCurvature,
                                 gp_Vec&        theTorsion) const;
 
+  //! Calculates the points on the curve for the parameters theParams(theFrom..theTo),
+  //! all of them placed in the cached span.
+  //! \param[in]  theParams  parameters of calculation
+  //! \param[in]  theFrom    first index of parameter to process
+  //! \param[in]  theTo      last index of parameter to process
+  //! \param[out] thePoints  thePoints(i) receives the point of parameter theParams(i)
+  Standard_EXPORT void D0Array(const TColStd_Array1OfReal& theParams,
+                               const Standard_Integer      theFrom,
+                               const Standard_Integer      theTo,
+                                     TColgp_Array1OfPnt2d& thePoints) const;
+  Standard_EXPORT void D0Array(const TColStd_Array1OfReal& theParams,
+                               const Standard_Integer      theFrom,
+                               const Standard_Integer      theTo,
+                                     TColgp_Array1OfPnt&   thePoints) const;
+
+  //! Calculates the points on the curve and first derivatives for the parameters
+  //! theParams(theFrom..theTo), all of them placed in the cached span.
+  //! Results are stored as in D0Array().
+  Standard_EXPORT void D1Array(const TColStd_Array1OfReal& theParams,
+                               const Standard_Integer      theFrom,
+                               const Standard_Integer      theTo,
+                                     TColgp_Array1OfPnt2d& thePoints,
+                                     TColgp_Array1OfVec2d& theTangents) const;
+  Standard_EXPORT void D1Array(const TColStd_Array1OfReal& theParams,
+                               const Standard_Integer      theFrom,
+                               const Standard_Integer      theTo,
+                                     TColgp_Array1OfPnt&   thePoints,
+                                     TColgp_Array1OfVec&   theTangents) const;
+
 
   DEFINE_STANDARD_RTTIEXT(BSplCLib_Cache,Standard_Transient)
 
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplCLib_Horner_Headerfile
+#define _BSplCLib_Horner_Headerfile
+
+#include <Standard_Integer.hxx>
+#include <Standard_Real.hxx>
+
+//! Evaluation of polynomials stored in the caches of B-spline curves and surfaces
+//! (see BSplCLib_Cache and BSplSLib_Cache) by Horner scheme.
+//! The coefficients of fixed dimension are stored one after another,
+//! starting from the constant term; the loops of fixed length
+//! are unrolled and vectorized by compiler.
+struct BSplCLib_Horner
+{
+  //! Evaluates the polynomial of given degree at the parameter.
+  template<Standard_Integer Dimension>
+  static void Eval (const Standard_Real    theParameter,
+                    const Standard_Integer theDegree,
+                    const Standard_Real*   theCoeffs,
+                          Standard_Real*   theResult)
+  {
+    const Standard_Real* aCoeffs = theCoeffs + theDegree * Dimension;
+    for (Standard_Integer aDim = 0; aDim < Dimension; aDim++)
+      theResult[aDim] = aCoeffs[aDim];
+    for (Standard_Integer aDeg = theDegree; aDeg > 0; aDeg--)
+    {
+      aCoeffs -= Dimension;
+      for (Standard_Integer aDim = 0; aDim < Dimension; aDim++)
+        theResult[aDim] = theResult[aDim] * theParameter + aCoeffs[aDim];
+    }
+  }
+
+  //! Evaluates the polynomial and its first derivative
+  //! with respect to the parameter.
+  template<Standard_Integer Dimension>
+  static void EvalD1 (const Standard_Real    theParameter,
+                      const Standard_Integer theDegree,
+                      const Standard_Real*   theCoeffs,
+                            Standard_Real*   theResult,
+                            Standard_Real*   theDeriv)
+  {
+    const Standard_Real* aCoeffs = theCoeffs + theDegree * Dimension;
+    for (Standard_Integer aDim = 0; aDim < Dimension; aDim++)
+    {
+      theResult[aDim] = aCoeffs[aDim];
+      theDeriv[aDim]  = 0.0;
+    }
+    for (Standard_Integer aDeg = theDegree; aDeg > 0; aDeg--)
+    {
+      aCoeffs -= Dimension;
+      for (Standard_Integer aDim = 0; aDim < Dimension; aDim++)
+      {
+        theDeriv[aDim]  = theDeriv[aDim]  * theParameter + theResult[aDim];
+        theResult[aDim] = theResult[aDim] * theParameter + aCoeffs[aDim];
+      }
+    }
+  }
+};
+
+#endif
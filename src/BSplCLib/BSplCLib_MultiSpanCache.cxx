@@ -0,0 +1,179 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplCLib_MultiSpanCache.hxx>
+
+#include <BSplCLib.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache, Standard_Transient)
+
+namespace
+{
+  //! Returns the reference to the memory limit shared by all curves.
+  static Standard_Size& memoryLimit()
+  {
+    static Standard_Size THE_MEMORY_LIMIT = 0;
+    return THE_MEMORY_LIMIT;
+  }
+}
+
+//=======================================================================
+//function : BSplCLib_MultiSpanCache
+//purpose  :
+//=======================================================================
+
+BSplCLib_MultiSpanCache::BSplCLib_MultiSpanCache (const Standard_Integer      theDegree,
+                                                  const Standard_Boolean      thePeriodic,
+                                                  const TColStd_Array1OfReal& theFlatKnots,
+                                                  const TColgp_Array1OfPnt&   thePoles,
+                                                  const TColStd_Array1OfReal* theWeights)
+: myDegree   (theDegree),
+  myPeriodic (thePeriodic)
+{
+  myFlatKnots = new TColStd_HArray1OfReal (theFlatKnots.Lower(), theFlatKnots.Upper());
+  myFlatKnots->ChangeArray1() = theFlatKnots;
+
+  const Standard_Integer aNbSpans = SpanSlots (theDegree, theFlatKnots, mySlots);
+  if (aNbSpans == 0)
+  {
+    return;
+  }
+
+  myCaches.Resize (0, aNbSpans - 1, Standard_False);
+  for (Standard_Integer anIndex = theFlatKnots.Lower() + theDegree;
+       anIndex < theFlatKnots.Upper() - theDegree; ++anIndex)
+  {
+    if (theFlatKnots (anIndex + 1) <= theFlatKnots (anIndex))
+    {
+      continue;
+    }
+    const Standard_Real aMid = 0.5 * (theFlatKnots (anIndex) + theFlatKnots (anIndex + 1));
+    Handle(BSplCLib_Cache) aCache = new BSplCLib_Cache (theDegree, thePeriodic, theFlatKnots,
+                                                        thePoles, theWeights);
+    aCache->BuildCache (aMid, theFlatKnots, thePoles, theWeights);
+    myCaches (mySlots (anIndex)) = aCache;
+  }
+}
+
+//=======================================================================
+//function : Cache
+//purpose  :
+//=======================================================================
+
+const Handle(BSplCLib_Cache)& BSplCLib_MultiSpanCache::Cache (const Standard_Real theParameter) const
+{
+  return myCaches (mySlots (LocateSpan (myDegree, myPeriodic, myFlatKnots->Array1(), theParameter)));
+}
+
+//=======================================================================
+//function : SpanSlots
+//purpose  :
+//=======================================================================
+
+Standard_Integer BSplCLib_MultiSpanCache::SpanSlots (const Standard_Integer                theDegree,
+                                                     const TColStd_Array1OfReal&           theFlatKnots,
+                                                     NCollection_Array1<Standard_Integer>& theSlots)
+{
+  const Standard_Integer aFirst = theFlatKnots.Lower() + theDegree;
+  const Standard_Integer aLast  = theFlatKnots.Upper() - theDegree - 1;
+  theSlots.Resize (theFlatKnots.Lower(), theFlatKnots.Upper(), Standard_False);
+  theSlots.Init (-1);
+  Standard_Integer aNbSpans = 0;
+  for (Standard_Integer anIndex = aFirst; anIndex <= aLast; ++anIndex)
+  {
+    if (theFlatKnots (anIndex + 1) > theFlatKnots (anIndex))
+    {
+      theSlots (anIndex) = aNbSpans++;
+    }
+  }
+  if (aNbSpans == 0)
+  {
+    return 0;
+  }
+
+  Standard_Integer aNext = aNbSpans - 1;
+  for (Standard_Integer anIndex = theSlots.Upper(); anIndex >= theSlots.Lower(); --anIndex)
+  {
+    if (theSlots (anIndex) >= 0)
+    {
+      aNext = theSlots (anIndex);
+    }
+    else
+    {
+      theSlots (anIndex) = aNext;
+    }
+  }
+  return aNbSpans;
+}
+
+//=======================================================================
+//function : LocateSpan
+//purpose  :
+//=======================================================================
+
+Standard_Integer BSplCLib_MultiSpanCache::LocateSpan (const Standard_Integer      theDegree,
+                                                      const Standard_Boolean      thePeriodic,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const Standard_Real         theParameter)
+{
+  Standard_Integer aSpanIndex = 0;
+  Standard_Real aParameter = theParameter;
+  BSplCLib::LocateParameter (theDegree, theFlatKnots, BSplCLib::NoMults(),
+                             theParameter, thePeriodic, aSpanIndex, aParameter);
+  return aSpanIndex;
+}
+
+//=======================================================================
+//function : EstimatedSize
+//purpose  :
+//=======================================================================
+
+Standard_Size BSplCLib_MultiSpanCache::EstimatedSize (const Standard_Integer      theDegree,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const Standard_Boolean      theIsRational)
+{
+  Standard_Size aNbSpans = 0;
+  for (Standard_Integer anIndex = theFlatKnots.Lower() + theDegree;
+       anIndex < theFlatKnots.Upper() - theDegree; ++anIndex)
+  {
+    if (theFlatKnots (anIndex + 1) > theFlatKnots (anIndex))
+    {
+      ++aNbSpans;
+    }
+  }
+  const Standard_Size aNbCoeffs = (Standard_Size )(theDegree + 1) * (theIsRational ? 4 : 3);
+  const Standard_Size aSpanSize = sizeof(BSplCLib_Cache) + sizeof(TColStd_HArray2OfReal)
+                                + sizeof(Handle(BSplCLib_Cache)) + aNbCoeffs * sizeof(Standard_Real);
+  return sizeof(BSplCLib_MultiSpanCache) + aNbSpans * aSpanSize
+       + (Standard_Size )theFlatKnots.Length() * (sizeof(Standard_Real) + sizeof(Standard_Integer));
+}
+
+//=======================================================================
+//function : SetMemoryLimit
+//purpose  :
+//=======================================================================
+
+void BSplCLib_MultiSpanCache::SetMemoryLimit (const Standard_Size theLimit)
+{
+  memoryLimit() = theLimit;
+}
+
+//=======================================================================
+//function : MemoryLimit
+//purpose  :
+//=======================================================================
+
+Standard_Size BSplCLib_MultiSpanCache::MemoryLimit()
+{
+  return memoryLimit();
+}
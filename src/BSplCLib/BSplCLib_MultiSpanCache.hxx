@@ -0,0 +1,91 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplCLib_MultiSpanCache_Headerfile
+#define _BSplCLib_MultiSpanCache_Headerfile
+
+#include <BSplCLib_Cache.hxx>
+#include <NCollection_Array1.hxx>
+
+//! \brief Polynomial cache of all spans of a 3D B-spline curve.
+//!
+//! Holds one BSplCLib_Cache per non-degenerated span, so that the evaluation
+//! jumping between spans costs a span lookup instead of a cache rebuild.
+//! The object is immutable once constructed and thus can be shared between
+//! several adaptors and threads.
+class BSplCLib_MultiSpanCache : public Standard_Transient
+{
+public:
+
+  //! Builds the caches of all spans of the curve.
+  //! \param theDegree     degree of the curve
+  //! \param thePeriodic   identify whether the curve is periodic
+  //! \param theFlatKnots  knots of the curve (with repetitions)
+  //! \param thePoles      array of poles of the curve
+  //! \param theWeights    array of weights of corresponding poles
+  Standard_EXPORT BSplCLib_MultiSpanCache (const Standard_Integer      theDegree,
+                                           const Standard_Boolean      thePeriodic,
+                                           const TColStd_Array1OfReal& theFlatKnots,
+                                           const TColgp_Array1OfPnt&   thePoles,
+                                           const TColStd_Array1OfReal* theWeights = NULL);
+
+  //! Returns the cache of the span containing the parameter.
+  Standard_EXPORT const Handle(BSplCLib_Cache)& Cache (const Standard_Real theParameter) const;
+
+  //! Returns the number of cached spans.
+  Standard_Integer NbSpans() const { return myCaches.Length(); }
+
+  //! Returns the estimated memory (in bytes) needed to cache all spans
+  //! of the curve with the given parameterization.
+  Standard_EXPORT static Standard_Size EstimatedSize (const Standard_Integer      theDegree,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const Standard_Boolean      theIsRational);
+
+  //! Fills the map from flat knot index to the index (from zero) of non-degenerated span
+  //! and returns the number of such spans. Degenerated spans and indices outside
+  //! the parametric range refer to the nearest following span (the last one at the end).
+  Standard_EXPORT static Standard_Integer SpanSlots (const Standard_Integer                theDegree,
+                                                     const TColStd_Array1OfReal&           theFlatKnots,
+                                                     NCollection_Array1<Standard_Integer>& theSlots);
+
+  //! Returns the flat knot index of the span containing the parameter.
+  Standard_EXPORT static Standard_Integer LocateSpan (const Standard_Integer      theDegree,
+                                                      const Standard_Boolean      thePeriodic,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const Standard_Real         theParameter);
+
+  //! Sets the maximal memory (in bytes) that may be spent on the cache of a single curve.
+  //! Zero value (default) disables the multi-span cache for B-spline curves.
+  Standard_EXPORT static void SetMemoryLimit (const Standard_Size theLimit);
+
+  //! Returns the maximal memory (in bytes) that may be spent on the cache of a single curve.
+  Standard_EXPORT static Standard_Size MemoryLimit();
+
+  DEFINE_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache, Standard_Transient)
+
+private:
+  // copying is prohibited
+  BSplCLib_MultiSpanCache (const BSplCLib_MultiSpanCache&);
+  void operator = (const BSplCLib_MultiSpanCache&);
+
+private:
+  Standard_Integer myDegree;
+  Standard_Boolean myPeriodic;
+  Handle(TColStd_HArray1OfReal) myFlatKnots;
+  NCollection_Array1<Standard_Integer> mySlots;       //!< flat knot index -> span slot
+  NCollection_Array1<Handle(BSplCLib_Cache)> myCaches; //!< caches of spans
+};
+
+DEFINE_STANDARD_HANDLE(BSplCLib_MultiSpanCache, Standard_Transient)
+
+#endif
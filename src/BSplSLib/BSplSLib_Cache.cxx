@@ -13,6 +13,7 @@
 
 #include <BSplSLib_Cache.hxx>
 #include <BSplSLib.hxx>
+#include <BSplCLib_Horner.hxx>
 
 #include <NCollection_LocalArray.hxx>
 
@@ -31,6 +32,17 @@ static Standard_Real* ConvertArray(const Handle(TColStd_HArray2OfReal)& theHArra
   return (Standard_Real*) &(anArray(anArray.LowerRow(), anArray.LowerCol()));
 }
 
+//! Converts the parameter into the local parameter of the cached span
+static inline Standard_Real LocalParameter(const BSplCLib_CacheParams& theParams,
+                                           const Standard_Real         theParameter)
+{
+  // BSplSLib uses different convention for span parameters than BSplCLib
+  // (Start is in the middle of the span and length is half-span)
+  Standard_Real aSpanLength = 0.5 * theParams.SpanLength;
+  Standard_Real aSpanStart = theParams.SpanStart + aSpanLength;
+  return (theParams.PeriodicNormalization (theParameter) - aSpanStart) / aSpanLength;
+}
+
 BSplSLib_Cache::BSplSLib_Cache(const Standard_Integer&        theDegreeU,
                                const Standard_Boolean&        thePeriodicU,
                                const TColStd_Array1OfReal&    theFlatKnotsU,
@@ -342,3 +354,139 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   theCurvatureUV.Multiply(anInvU * anInvV);
 }
 
+
+void BSplSLib_Cache::D0Grid(const TColStd_Array1OfReal& theU,
+                            const Standard_Integer      theUFrom,
+                            const Standard_Integer      theUTo,
+                            const TColStd_Array1OfReal& theV,
+                            const Standard_Integer      theVFrom,
+                            const Standard_Integer      theVTo,
+                                  TColgp_Array2OfPnt&   thePoints) const
+{
+  // Lines of the grid go along the direction of minimal degree, so that
+  // the polynomial is reduced along the direction of maximal degree once per line
+  const Standard_Boolean isUMax = myParamsU.Degree > myParamsV.Degree;
+  const BSplCLib_CacheParams& aParamsMin = isUMax ? myParamsV : myParamsU;
+  const BSplCLib_CacheParams& aParamsMax = isUMax ? myParamsU : myParamsV;
+  const TColStd_Array1OfReal& aParsMin = isUMax ? theV : theU;
+  const TColStd_Array1OfReal& aParsMax = isUMax ? theU : theV;
+  const Standard_Integer aMinFrom = isUMax ? theVFrom : theUFrom;
+  const Standard_Integer aMinTo   = isUMax ? theVTo   : theUTo;
+  const Standard_Integer aMaxFrom = isUMax ? theUFrom : theVFrom;
+  const Standard_Integer aMaxTo   = isUMax ? theUTo   : theVTo;
+  if (aMinFrom > aMinTo || aMaxFrom > aMaxTo)
+    return;
+
+  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  Standard_Integer aCacheCols = myPolesWeights->RowLength();
+  Standard_Integer aMinDegree = aParamsMin.Degree;
+  Standard_Integer aMaxDegree = aParamsMax.Degree;
+
+  NCollection_LocalArray<Standard_Real> aLocalMin(aMinTo - aMinFrom + 1);
+  for (Standard_Integer j = aMinFrom; j <= aMinTo; j++)
+    aLocalMin[j - aMinFrom] = LocalParameter(aParamsMin, aParsMin(j));
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols); // array for intermediate results
+  Standard_Real aPoint[4];
+  for (Standard_Integer i = aMaxFrom; i <= aMaxTo; i++)
+  {
+    // Calculate intermediate value of cached polynomial along columns
+    PLib::NoDerivativeEvalPolynomial(LocalParameter(aParamsMax, aParsMax(i)), aMaxDegree,
+                                     aCacheCols, aMaxDegree * aCacheCols,
+                                     aPolesArray[0], aTransientCoeffs[0]);
+    for (Standard_Integer j = aMinFrom; j <= aMinTo; j++)
+    {
+      gp_Pnt& aPnt = isUMax ? thePoints(i, j) : thePoints(j, i);
+      if (myIsRational)
+      {
+        BSplCLib_Horner::Eval<4>(aLocalMin[j - aMinFrom], aMinDegree, aTransientCoeffs, aPoint);
+        aPnt.SetCoord(aPoint[0] / aPoint[3], aPoint[1] / aPoint[3], aPoint[2] / aPoint[3]);
+      }
+      else
+      {
+        BSplCLib_Horner::Eval<3>(aLocalMin[j - aMinFrom], aMinDegree, aTransientCoeffs, aPoint);
+        aPnt.SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+      }
+    }
+  }
+}
+
+
+void BSplSLib_Cache::D1Grid(const TColStd_Array1OfReal& theU,
+                            const Standard_Integer      theUFrom,
+                            const Standard_Integer      theUTo,
+                            const TColStd_Array1OfReal& theV,
+                            const Standard_Integer      theVFrom,
+                            const Standard_Integer      theVTo,
+                                  TColgp_Array2OfPnt&   thePoints,
+                                  TColgp_Array2OfVec&   theTangentsU,
+                                  TColgp_Array2OfVec&   theTangentsV) const
+{
+  const Standard_Boolean isUMax = myParamsU.Degree > myParamsV.Degree;
+  const BSplCLib_CacheParams& aParamsMin = isUMax ? myParamsV : myParamsU;
+  const BSplCLib_CacheParams& aParamsMax = isUMax ? myParamsU : myParamsV;
+  const TColStd_Array1OfReal& aParsMin = isUMax ? theV : theU;
+  const TColStd_Array1OfReal& aParsMax = isUMax ? theU : theV;
+  const Standard_Integer aMinFrom = isUMax ? theVFrom : theUFrom;
+  const Standard_Integer aMinTo   = isUMax ? theVTo   : theUTo;
+  const Standard_Integer aMaxFrom = isUMax ? theUFrom : theVFrom;
+  const Standard_Integer aMaxTo   = isUMax ? theUTo   : theVTo;
+  if (aMinFrom > aMinTo || aMaxFrom > aMaxTo)
+    return;
+
+  Standard_Real anInvU = 1.0 / (0.5 * myParamsU.SpanLength);
+  Standard_Real anInvV = 1.0 / (0.5 * myParamsV.SpanLength);
+
+  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  Standard_Integer aDimension = myIsRational ? 4 : 3;
+  Standard_Integer aCacheCols = myPolesWeights->RowLength();
+  Standard_Integer aMinDegree = aParamsMin.Degree;
+  Standard_Integer aMaxDegree = aParamsMax.Degree;
+
+  NCollection_LocalArray<Standard_Real> aLocalMin(aMinTo - aMinFrom + 1);
+  for (Standard_Integer j = aMinFrom; j <= aMinTo; j++)
+    aLocalMin[j - aMinFrom] = LocalParameter(aParamsMin, aParsMin(j));
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols<<1); // array for intermediate results
+  Standard_Real aPntDeriv[16]; // result storage (point and derivative coordinates)
+  Standard_Real aTempStorage[12];
+  for (Standard_Integer i = aMaxFrom; i <= aMaxTo; i++)
+  {
+    // Calculate intermediate values and derivatives of bivariate polynomial along variable with maximal degree
+    PLib::EvalPolynomial(LocalParameter(aParamsMax, aParsMax(i)), 1, aMaxDegree,
+                         aCacheCols, aPolesArray[0], aTransientCoeffs[0]);
+    for (Standard_Integer j = aMinFrom; j <= aMinTo; j++)
+    {
+      const Standard_Real aParam = aLocalMin[j - aMinFrom];
+      for (Standard_Integer k = 0; k < 16; k++) aPntDeriv[k] = 0.0;
+
+      // Calculate a point on surface and a derivative along variable with minimal degree
+      PLib::EvalPolynomial(aParam, 1, aMinDegree, aDimension, aTransientCoeffs[0], aPntDeriv[0]);
+
+      // Calculate derivative along variable with maximal degree
+      PLib::NoDerivativeEvalPolynomial(aParam, aMinDegree, aDimension,
+                                       aMinDegree * aDimension, aTransientCoeffs[aCacheCols],
+                                       aPntDeriv[aDimension<<1]);
+
+      Standard_Real* aResult = aPntDeriv;
+      Standard_Integer aResDimension = aDimension;
+      if (myIsRational) // calculate derivatives divided by weight's derivatives
+      {
+        BSplSLib::RationalDerivative(1, 1, 1, 1, aPntDeriv[0], aTempStorage[0]);
+        aResult = aTempStorage;
+        aResDimension--;
+      }
+
+      const Standard_Integer iU = isUMax ? i : j;
+      const Standard_Integer iV = isUMax ? j : i;
+      const Standard_Integer aShift = aResDimension<<1;
+      thePoints(iU, iV).SetCoord(aResult[0], aResult[1], aResult[2]);
+      gp_Vec& aTangentMin = isUMax ? theTangentsV(iU, iV) : theTangentsU(iU, iV);
+      gp_Vec& aTangentMax = isUMax ? theTangentsU(iU, iV) : theTangentsV(iU, iV);
+      aTangentMin.SetCoord(aResult[aResDimension], aResult[aResDimension + 1], aResult[aResDimension + 2]);
+      aTangentMax.SetCoord(aResult[aShift], aResult[aShift + 1], aResult[aShift + 2]);
+      theTangentsU(iU, iV).Multiply(anInvU);
+      theTangentsV(iU, iV).Multiply(anInvV);
+    }
+  }
+}
@@ -23,6 +23,7 @@
 #include <gp_Vec.hxx>
 
 #include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_HArray1OfReal.hxx>
@@ -115,6 +116,37 @@ public:
                                 gp_Vec&        theCurvatureV, 
                                 gp_Vec&        theCurvatureUV) const;
 
+  //! Calculates the points on the surface for the grid of parameters
+  //! theU(theUFrom..theUTo) x theV(theVFrom..theVTo), all of them placed in the cached span.
+  //! The polynomial is reduced along the direction of maximal degree once per grid line.
+  //! \param[in]  theU       parameters along U axis
+  //! \param[in]  theUFrom   first index of U parameter to process
+  //! \param[in]  theUTo     last index of U parameter to process
+  //! \param[in]  theV       parameters along V axis
+  //! \param[in]  theVFrom   first index of V parameter to process
+  //! \param[in]  theVTo     last index of V parameter to process
+  //! \param[out] thePoints  thePoints(i, j) receives the point of parameters theU(i), theV(j)
+  Standard_EXPORT void D0Grid(const TColStd_Array1OfReal& theU,
+                              const Standard_Integer      theUFrom,
+                              const Standard_Integer      theUTo,
+                              const TColStd_Array1OfReal& theV,
+                              const Standard_Integer      theVFrom,
+                              const Standard_Integer      theVTo,
+                                    TColgp_Array2OfPnt&   thePoints) const;
+
+  //! Calculates the points and first derivatives on the surface for the grid of parameters
+  //! theU(theUFrom..theUTo) x theV(theVFrom..theVTo), all of them placed in the cached span.
+  //! Results are stored as in D0Grid().
+  Standard_EXPORT void D1Grid(const TColStd_Array1OfReal& theU,
+                              const Standard_Integer      theUFrom,
+                              const Standard_Integer      theUTo,
+                              const TColStd_Array1OfReal& theV,
+                              const Standard_Integer      theVFrom,
+                              const Standard_Integer      theVTo,
+                                    TColgp_Array2OfPnt&   thePoints,
+                                    TColgp_Array2OfVec&   theTangentsU,
+                                    TColgp_Array2OfVec&   theTangentsV) const;
+
 
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache,Standard_Transient)
 
@@ -0,0 +1,156 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplSLib_MultiSpanCache.hxx>
+
+#include <BSplCLib_MultiSpanCache.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache, Standard_Transient)
+
+namespace
+{
+  //! Returns the reference to the memory limit shared by all surfaces.
+  static Standard_Size& memoryLimit()
+  {
+    static Standard_Size THE_MEMORY_LIMIT = 0;
+    return THE_MEMORY_LIMIT;
+  }
+
+  //! Returns the number of non-degenerated spans.
+  static Standard_Integer nbSpans (const Standard_Integer      theDegree,
+                                   const TColStd_Array1OfReal& theFlatKnots)
+  {
+    Standard_Integer aNbSpans = 0;
+    for (Standard_Integer anIndex = theFlatKnots.Lower() + theDegree;
+         anIndex < theFlatKnots.Upper() - theDegree; ++anIndex)
+    {
+      if (theFlatKnots (anIndex + 1) > theFlatKnots (anIndex))
+      {
+        ++aNbSpans;
+      }
+    }
+    return aNbSpans;
+  }
+}
+
+//=======================================================================
+//function : BSplSLib_MultiSpanCache
+//purpose  :
+//=======================================================================
+
+BSplSLib_MultiSpanCache::BSplSLib_MultiSpanCache (const Standard_Integer      theDegreeU,
+                                                  const Standard_Boolean      thePeriodicU,
+                                                  const TColStd_Array1OfReal& theFlatKnotsU,
+                                                  const Standard_Integer      theDegreeV,
+                                                  const Standard_Boolean      thePeriodicV,
+                                                  const TColStd_Array1OfReal& theFlatKnotsV,
+                                                  const TColgp_Array2OfPnt&   thePoles,
+                                                  const TColStd_Array2OfReal* theWeights)
+: myDegreeU   (theDegreeU),
+  myDegreeV   (theDegreeV),
+  myPeriodicU (thePeriodicU),
+  myPeriodicV (thePeriodicV),
+  myNbSpansU  (0)
+{
+  myFlatKnotsU = new TColStd_HArray1OfReal (theFlatKnotsU.Lower(), theFlatKnotsU.Upper());
+  myFlatKnotsU->ChangeArray1() = theFlatKnotsU;
+  myFlatKnotsV = new TColStd_HArray1OfReal (theFlatKnotsV.Lower(), theFlatKnotsV.Upper());
+  myFlatKnotsV->ChangeArray1() = theFlatKnotsV;
+
+  myNbSpansU = BSplCLib_MultiSpanCache::SpanSlots (theDegreeU, theFlatKnotsU, mySlotsU);
+  const Standard_Integer aNbSpansV = BSplCLib_MultiSpanCache::SpanSlots (theDegreeV, theFlatKnotsV, mySlotsV);
+  if (myNbSpansU == 0 || aNbSpansV == 0)
+  {
+    return;
+  }
+
+  myCaches.Resize (0, myNbSpansU * aNbSpansV - 1, Standard_False);
+  for (Standard_Integer anIndexV = theFlatKnotsV.Lower() + theDegreeV;
+       anIndexV < theFlatKnotsV.Upper() - theDegreeV; ++anIndexV)
+  {
+    if (theFlatKnotsV (anIndexV + 1) <= theFlatKnotsV (anIndexV))
+    {
+      continue;
+    }
+    const Standard_Real aMidV = 0.5 * (theFlatKnotsV (anIndexV) + theFlatKnotsV (anIndexV + 1));
+    for (Standard_Integer anIndexU = theFlatKnotsU.Lower() + theDegreeU;
+         anIndexU < theFlatKnotsU.Upper() - theDegreeU; ++anIndexU)
+    {
+      if (theFlatKnotsU (anIndexU + 1) <= theFlatKnotsU (anIndexU))
+      {
+        continue;
+      }
+      const Standard_Real aMidU = 0.5 * (theFlatKnotsU (anIndexU) + theFlatKnotsU (anIndexU + 1));
+      Handle(BSplSLib_Cache) aCache = new BSplSLib_Cache (theDegreeU, thePeriodicU, theFlatKnotsU,
+                                                          theDegreeV, thePeriodicV, theFlatKnotsV,
+                                                          theWeights);
+      aCache->BuildCache (aMidU, aMidV, theFlatKnotsU, theFlatKnotsV, thePoles, theWeights);
+      myCaches (mySlotsV (anIndexV) * myNbSpansU + mySlotsU (anIndexU)) = aCache;
+    }
+  }
+}
+
+//=======================================================================
+//function : Cache
+//purpose  :
+//=======================================================================
+
+const Handle(BSplSLib_Cache)& BSplSLib_MultiSpanCache::Cache (const Standard_Real theU,
+                                                              const Standard_Real theV) const
+{
+  const Standard_Integer aSpanU = BSplCLib_MultiSpanCache::LocateSpan (myDegreeU, myPeriodicU, myFlatKnotsU->Array1(), theU);
+  const Standard_Integer aSpanV = BSplCLib_MultiSpanCache::LocateSpan (myDegreeV, myPeriodicV, myFlatKnotsV->Array1(), theV);
+  return myCaches (mySlotsV (aSpanV) * myNbSpansU + mySlotsU (aSpanU));
+}
+
+//=======================================================================
+//function : EstimatedSize
+//purpose  :
+//=======================================================================
+
+Standard_Size BSplSLib_MultiSpanCache::EstimatedSize (const Standard_Integer      theDegreeU,
+                                                      const TColStd_Array1OfReal& theFlatKnotsU,
+                                                      const Standard_Integer      theDegreeV,
+                                                      const TColStd_Array1OfReal& theFlatKnotsV,
+                                                      const Standard_Boolean      theIsRational)
+{
+  const Standard_Size aNbSpans = (Standard_Size )nbSpans (theDegreeU, theFlatKnotsU)
+                               * (Standard_Size )nbSpans (theDegreeV, theFlatKnotsV);
+  const Standard_Size aNbCoeffs = (Standard_Size )(theDegreeU + 1) * (Standard_Size )(theDegreeV + 1)
+                                * (theIsRational ? 4 : 3);
+  const Standard_Size aSpanSize = sizeof(BSplSLib_Cache) + sizeof(TColStd_HArray2OfReal)
+                                + sizeof(Handle(BSplSLib_Cache)) + aNbCoeffs * sizeof(Standard_Real);
+  return sizeof(BSplSLib_MultiSpanCache) + aNbSpans * aSpanSize
+       + (Standard_Size )(theFlatKnotsU.Length() + theFlatKnotsV.Length())
+       * (sizeof(Standard_Real) + sizeof(Standard_Integer));
+}
+
+//=======================================================================
+//function : SetMemoryLimit
+//purpose  :
+//=======================================================================
+
+void BSplSLib_MultiSpanCache::SetMemoryLimit (const Standard_Size theLimit)
+{
+  memoryLimit() = theLimit;
+}
+
+//=======================================================================
+//function : MemoryLimit
+//purpose  :
+//=======================================================================
+
+Standard_Size BSplSLib_MultiSpanCache::MemoryLimit()
+{
+  return memoryLimit();
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplSLib_MultiSpanCache_Headerfile
+#define _BSplSLib_MultiSpanCache_Headerfile
+
+#include <BSplSLib_Cache.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+//! \brief Polynomial cache of all spans of a B-spline surface.
+//!
+//! Holds one BSplSLib_Cache per non-degenerated span, so that the evaluation
+//! jumping between spans costs a span lookup instead of a cache rebuild.
+//! The object is immutable once constructed and thus can be shared between
+//! several adaptors and threads.
+class BSplSLib_MultiSpanCache : public Standard_Transient
+{
+public:
+
+  //! Builds the caches of all spans of the surface.
+  //! \param theDegreeU    degree along U axis
+  //! \param thePeriodicU  identify whether the surface is periodic along U axis
+  //! \param theFlatKnotsU flat knots of the surface along U axis
+  //! \param theDegreeV    degree along V axis
+  //! \param thePeriodicV  identify whether the surface is periodic along V axis
+  //! \param theFlatKnotsV flat knots of the surface along V axis
+  //! \param thePoles      array of poles of the surface
+  //! \param theWeights    array of weights of corresponding poles
+  Standard_EXPORT BSplSLib_MultiSpanCache (const Standard_Integer      theDegreeU,
+                                           const Standard_Boolean      thePeriodicU,
+                                           const TColStd_Array1OfReal& theFlatKnotsU,
+                                           const Standard_Integer      theDegreeV,
+                                           const Standard_Boolean      thePeriodicV,
+                                           const TColStd_Array1OfReal& theFlatKnotsV,
+                                           const TColgp_Array2OfPnt&   thePoles,
+                                           const TColStd_Array2OfReal* theWeights = NULL);
+
+  //! Returns the cache of the span containing the point of parameters (theU, theV).
+  Standard_EXPORT const Handle(BSplSLib_Cache)& Cache (const Standard_Real theU,
+                                                       const Standard_Real theV) const;
+
+  //! Returns the number of cached spans.
+  Standard_Integer NbSpans() const { return myCaches.Length(); }
+
+  //! Returns the estimated memory (in bytes) needed to cache all spans
+  //! of the surface with the given parameterization.
+  Standard_EXPORT static Standard_Size EstimatedSize (const Standard_Integer      theDegreeU,
+                                                      const TColStd_Array1OfReal& theFlatKnotsU,
+                                                      const Standard_Integer      theDegreeV,
+                                                      const TColStd_Array1OfReal& theFlatKnotsV,
+                                                      const Standard_Boolean      theIsRational);
+
+  //! Sets the maximal memory (in bytes) that may be spent on the cache of a single surface.
+  //! Zero value (default) disables the multi-span cache for B-spline surfaces.
+  Standard_EXPORT static void SetMemoryLimit (const Standard_Size theLimit);
+
+  //! Returns the maximal memory (in bytes) that may be spent on the cache of a single surface.
+  Standard_EXPORT static Standard_Size MemoryLimit();
+
+  DEFINE_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache, Standard_Transient)
+
+private:
+  // copying is prohibited
+  BSplSLib_MultiSpanCache (const BSplSLib_MultiSpanCache&);
+  void operator = (const BSplSLib_MultiSpanCache&);
+
+private:
+  Standard_Integer myDegreeU, myDegreeV;
+  Standard_Boolean myPeriodicU, myPeriodicV;
+  Handle(TColStd_HArray1OfReal) myFlatKnotsU, myFlatKnotsV;
+  NCollection_Array1<Standard_Integer> mySlotsU;  //!< flat knot index -> span slot along U
+  NCollection_Array1<Standard_Integer> mySlotsV;  //!< flat knot index -> span slot along V
+  Standard_Integer myNbSpansU;
+  NCollection_Array1<Handle(BSplSLib_Cache)> myCaches; //!< caches of spans, U slot varies first
+};
+
+DEFINE_STANDARD_HANDLE(BSplSLib_MultiSpanCache, Standard_Transient)
+
+#endif
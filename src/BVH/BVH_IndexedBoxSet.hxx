@@ -0,0 +1,170 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BVH_IndexedBoxSet_Header
+#define _BVH_IndexedBoxSet_Header
+
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_PrimitiveSet3d.hxx>
+#include <Bnd_Box.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <vector>
+
+//! Set of axis-aligned boxes identified by integer indices
+//! (e.g. indices of triangles or vertices in external arrays).
+//! The tree is built by linear builder on the first call of BVH().
+//! Once the tree is built, Select() can be called from several threads.
+class BVH_IndexedBoxSet : public BVH_PrimitiveSet3d
+{
+public:
+
+  //! Creates empty set.
+  BVH_IndexedBoxSet()
+  {
+    myBuilder = new BVH_LinearBuilder<Standard_Real, 3> (BVH_Constants_LeafNodeSizeDefault,
+                                                         BVH_Constants_MaxTreeDepth);
+  }
+
+  //! Converts non-void Bnd_Box into BVH box.
+  static BVH_Box<Standard_Real, 3> ToBVHBox (const Bnd_Box& theBox)
+  {
+    Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
+    theBox.Get (aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+    return BVH_Box<Standard_Real, 3> (BVH_Vec3d (aXmin, aYmin, aZmin),
+                                      BVH_Vec3d (aXmax, aYmax, aZmax));
+  }
+
+  //! Adds the box with the given index.
+  void Add (const Standard_Integer theIndex, const BVH_Box<Standard_Real, 3>& theBox)
+  {
+    myBoxes.Append (theBox);
+    myIndices.Append (theIndex);
+    MarkDirty();
+  }
+
+  //! Adds the non-void box with the given index.
+  void Add (const Standard_Integer theIndex, const Bnd_Box& theBox)
+  {
+    Add (theIndex, ToBVHBox (theBox));
+  }
+
+  //! Returns number of boxes.
+  virtual Standard_Integer Size() const Standard_OVERRIDE
+  {
+    return myBoxes.Length();
+  }
+
+  //! Returns the box with the given position in the set.
+  virtual BVH_Box<Standard_Real, 3> Box (const Standard_Integer theIndex) const Standard_OVERRIDE
+  {
+    return myBoxes (theIndex);
+  }
+
+  //! Returns the center of the box along the given axis.
+  virtual Standard_Real Center (const Standard_Integer theIndex,
+                                const Standard_Integer theAxis) const Standard_OVERRIDE
+  {
+    return myBoxes (theIndex).Center (theAxis);
+  }
+
+  //! Swaps the boxes with the given positions in the set.
+  virtual void Swap (const Standard_Integer theIndex1,
+                     const Standard_Integer theIndex2) Standard_OVERRIDE
+  {
+    std::swap (myBoxes   (theIndex1), myBoxes   (theIndex2));
+    std::swap (myIndices (theIndex1), myIndices (theIndex2));
+  }
+
+  //! Appends to <theIndices> the indices of the boxes interfering with <theBox>,
+  //! in the order of the tree traversal.
+  //! The tree should be built in advance by BVH() method.
+  void Select (const BVH_Box<Standard_Real, 3>& theBox,
+               std::vector<Standard_Integer>&   theIndices) const
+  {
+    const BVH_Tree<Standard_Real, 3>* aBVH = myBVH.get();
+    if (aBVH->Length() == 0)
+    {
+      return;
+    }
+
+    const BVH_Vec3d& aMinPnt = theBox.CornerMin();
+    const BVH_Vec3d& aMaxPnt = theBox.CornerMax();
+    Standard_Integer aStack[BVH_Constants_MaxTreeDepth];
+    Standard_Integer aHead = -1;
+    Standard_Integer aNode = 0;
+    for (;;)
+    {
+      const BVH_Vec4i& aData = aBVH->NodeInfoBuffer()[aNode];
+      if (aData.x() == 0)
+      {
+        const Standard_Boolean isLeft  = !isOut (aMinPnt, aMaxPnt, aBVH->MinPoint (aData.y()), aBVH->MaxPoint (aData.y()));
+        const Standard_Boolean isRight = !isOut (aMinPnt, aMaxPnt, aBVH->MinPoint (aData.z()), aBVH->MaxPoint (aData.z()));
+        if (isLeft || isRight)
+        {
+          if (isLeft && isRight)
+          {
+            aStack[++aHead] = aData.z();
+          }
+          aNode = isLeft ? aData.y() : aData.z();
+          continue;
+        }
+      }
+      else
+      {
+        for (Standard_Integer anIdx = aData.y(); anIdx <= aData.z(); ++anIdx)
+        {
+          const BVH_Box<Standard_Real, 3>& aBox = myBoxes (anIdx);
+          if (!isOut (aMinPnt, aMaxPnt, aBox.CornerMin(), aBox.CornerMax()))
+          {
+            theIndices.push_back (myIndices (anIdx));
+          }
+        }
+      }
+
+      if (aHead < 0)
+      {
+        break;
+      }
+      aNode = aStack[aHead--];
+    }
+  }
+
+  //! Appends to <theIndices> the indices of the boxes interfering with non-void <theBox>.
+  void Select (const Bnd_Box&                 theBox,
+               std::vector<Standard_Integer>& theIndices) const
+  {
+    Select (ToBVHBox (theBox), theIndices);
+  }
+
+private:
+
+  //! Checks if the boxes given by their corners do not interfere.
+  static Standard_Boolean isOut (const BVH_Vec3d& theMinPnt1,
+                                 const BVH_Vec3d& theMaxPnt1,
+                                 const BVH_Vec3d& theMinPnt2,
+                                 const BVH_Vec3d& theMaxPnt2)
+  {
+    return theMinPnt1.x() > theMaxPnt2.x() || theMaxPnt1.x() < theMinPnt2.x()
+        || theMinPnt1.y() > theMaxPnt2.y() || theMaxPnt1.y() < theMinPnt2.y()
+        || theMinPnt1.z() > theMaxPnt2.z() || theMaxPnt1.z() < theMinPnt2.z();
+  }
+
+private:
+
+  NCollection_Vector<BVH_Box<Standard_Real, 3> > myBoxes;   //!< boxes in the order of the tree
+  NCollection_Vector<Standard_Integer>           myIndices; //!< indices of the boxes
+
+};
+
+#endif // _BVH_IndexedBoxSet_Header
@@ -28,6 +28,7 @@
 #include <FSD_BinaryFile.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <PCDM_Document.hxx>
 #include <PCDM_ReadWriter.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -37,9 +38,19 @@
 #include <Storage_Schema.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
+#include <Standard_GUID.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TColStd_SequenceOfAsciiString.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_AttributeIterator.hxx>
+#include <TDF_AttributeList.hxx>
 #include <TDF_Data.hxx>
 #include <TDF_Label.hxx>
+#include <TDF_ListIteratorOfAttributeList.hxx>
+#include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <TDocStd_Owner.hxx>
 
@@ -48,6 +59,15 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDri
 #define SHAPESECTION_POS "SHAPE_SECTION_POS:"
 #define SIZEOFSHAPELABEL  18
 
+// signature opening each journal segment and closing the file with segments
+#define JOURNAL_SIGNATURE "OCAF_BIN_JOURNAL"
+#define JOURNAL_SIGNATURE_SIZE 16
+
+// number of attributes decoded together in parallel mode
+#define DEFERRED_BATCH_SIZE 256
+// minimal length of attribute data worth deferring to the parallel stage
+#define DEFERRED_MIN_LENGTH 4096
+
 #define DATATYPE_MIGRATION
 //#define DATATYPE_MIGRATION_DEB
 //=======================================================================
@@ -56,6 +76,8 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDri
 //=======================================================================
 
 BinLDrivers_DocumentRetrievalDriver::BinLDrivers_DocumentRetrievalDriver ()
+: myNbDeferred (0),
+  myIsParallel (Standard_False)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -225,6 +247,14 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
   myRelocTable.SetHeaderData(aHeaderData);
   mySections.Clear();
   myPAtt.Init();
+  myNbDeferred = 0;
+  if (myIsParallel)
+  {
+    if (myDeferred.IsEmpty())
+      myDeferred.Resize (1, DEFERRED_BATCH_SIZE, Standard_False);
+    for (i = myDeferred.Lower(); i <= myDeferred.Upper(); i++)
+      myDeferred.ChangeValue (i).Data.Init();
+  }
   Handle(TDF_Data) aData = new TDF_Data();
   streampos aDocumentPos = -1;
 
@@ -305,6 +335,7 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
 
   // read sub-tree of the root label
   Standard_Integer nbRead = ReadSubTree (theIStream, aData->Root());
+  PasteDeferred();
   Clear();
     
   if (nbRead > 0) {
@@ -326,6 +357,296 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
       }
     }
   }
+
+  // Replay the journal of incremental saves over the base image
+  if (nbRead > 0 && aFileVer >= 3 && !ReadJournal (theIStream, aData))
+    myReaderStatus = PCDM_RS_FormatFailure;
+
+  // the next incremental save starts from the image just read
+  if (myReaderStatus == PCDM_RS_OK)
+    aDoc->ClearJournal();
+}
+
+//=======================================================================
+//function : ReadJournal
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean BinLDrivers_DocumentRetrievalDriver::ReadJournal
+                         (Standard_IStream&       theIS,
+                          const Handle(TDF_Data)& theData)
+{
+  static const TCollection_ExtendedString aMethStr
+    ("BinLDrivers_DocumentRetrievalDriver: ");
+
+  // the trailer of the file refers to the last segment
+  char aSignature[JOURNAL_SIGNATURE_SIZE];
+  const uint64_t aTrailerSize = sizeof(uint64_t) + JOURNAL_SIGNATURE_SIZE;
+  theIS.clear();
+  theIS.seekg (0, std::ios::end);
+  const uint64_t aFileSize = (uint64_t) theIS.tellg();
+  if (!theIS || aFileSize <= aTrailerSize)
+  {
+    theIS.clear();
+    return Standard_True;
+  }
+
+  uint64_t aLastSegment = 0;
+  theIS.seekg ((std::streamoff) (aFileSize - aTrailerSize));
+  theIS.read ((char*) &aLastSegment, sizeof(uint64_t));
+  theIS.read (aSignature, JOURNAL_SIGNATURE_SIZE);
+#if DO_INVERSE
+  aLastSegment = FSD_BinaryFile::InverseUint64 (aLastSegment);
+#endif
+  if (!theIS || strncmp (aSignature, JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE) != 0)
+  {
+    // no journal
+    theIS.clear();
+    return Standard_True;
+  }
+
+  // the segments are chained from the last one to the first
+  NCollection_List<uint64_t> aSegments;
+  for (uint64_t aPos = aLastSegment; aPos != 0;)
+  {
+    uint64_t aPrev = 0;
+    theIS.seekg ((std::streamoff) aPos);
+    theIS.read (aSignature, JOURNAL_SIGNATURE_SIZE);
+    theIS.read ((char*) &aPrev, sizeof(uint64_t));
+#if DO_INVERSE
+    aPrev = FSD_BinaryFile::InverseUint64 (aPrev);
+#endif
+    if (!theIS || strncmp (aSignature, JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE) != 0
+     || aPrev >= aPos)
+    {
+      myMsgDriver->Send (aMethStr + "error: journal is corrupted", Message_Fail);
+      return Standard_False;
+    }
+    aSegments.Prepend (aPos);
+    aPos = aPrev;
+  }
+
+  for (NCollection_List<uint64_t>::Iterator anIter (aSegments); anIter.More(); anIter.Next())
+  {
+    theIS.seekg ((std::streamoff) anIter.Value());
+    if (!ReadJournalSegment (theIS, theData))
+      return Standard_False;
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : getInteger, getLabel, getGUID
+//purpose  : Helpers reading the journal segment
+//=======================================================================
+
+static Standard_Integer getInteger (Standard_IStream& theIS)
+{
+  Standard_Integer aValue = 0;
+  theIS.read ((char*) &aValue, sizeof(Standard_Integer));
+#if DO_INVERSE
+  aValue = FSD_BinaryFile::InverseInt (aValue);
+#endif
+  return aValue;
+}
+
+static TDF_Label getLabel (Standard_IStream&       theIS,
+                           const Handle(TDF_Data)& theData,
+                           const Standard_Boolean  theToCreate)
+{
+  TColStd_ListOfInteger aTags;
+  const Standard_Integer aNbTags = getInteger (theIS);
+  for (Standard_Integer i = 0; i < aNbTags && theIS; i++)
+    aTags.Append (getInteger (theIS));
+
+  TDF_Label aLabel;
+  if (theIS && aNbTags > 0)
+    TDF_Tool::Label (theData, aTags, aLabel, theToCreate);
+  return aLabel;
+}
+
+static Standard_GUID getGUID (Standard_IStream& theIS)
+{
+  char aGUIDStr[Standard_GUID_SIZE_ALLOC];
+  theIS.read (aGUIDStr, Standard_GUID_SIZE);
+  aGUIDStr[Standard_GUID_SIZE] = '\0';
+  return theIS ? Standard_GUID (aGUIDStr) : Standard_GUID();
+}
+
+//=======================================================================
+//function : ReadJournalSegment
+//purpose  : Binds the attributes of the segment to the existing ones,
+//           so that they are updated in place keeping all references
+//           to them valid, then pastes the stored data
+//=======================================================================
+
+Standard_Boolean BinLDrivers_DocumentRetrievalDriver::ReadJournalSegment
+                         (Standard_IStream&       theIS,
+                          const Handle(TDF_Data)& theData)
+{
+  static const TCollection_ExtendedString aMethStr
+    ("BinLDrivers_DocumentRetrievalDriver: ");
+
+  Standard_Boolean isOK = Standard_True;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    // 1. Header and types table
+    char aSignature[JOURNAL_SIGNATURE_SIZE];
+    uint64_t aPrev = 0;
+    theIS.read (aSignature, JOURNAL_SIGNATURE_SIZE);
+    theIS.read ((char*) &aPrev, sizeof(uint64_t));
+    PropagateDocumentVersion (getInteger (theIS));
+
+    TColStd_SequenceOfAsciiString aTypeNames;
+    const Standard_Integer aNbTypes = getInteger (theIS);
+    for (Standard_Integer i = 1; i <= aNbTypes && theIS; i++)
+    {
+      const Standard_Integer aLength = getInteger (theIS);
+      if (aLength <= 0 || aLength > 1024)
+      {
+        theIS.setstate (std::ios::failbit);
+        break;
+      }
+      TCollection_AsciiString aTypeName (aLength, ' ');
+      theIS.read ((char*) aTypeName.ToCString(), aLength);
+      aTypeNames.Append (aTypeName);
+    }
+    myDrivers->AssignIds (aTypeNames);
+
+    // 2. Index of labels: bind the kept attributes, forget the removed ones
+    const Standard_Integer aNbLabels = theIS ? getInteger (theIS) : -1;
+    if (aNbLabels < 0)
+      throw Standard_Failure ("invalid journal index");
+
+    NCollection_Array1<TDF_Label> aLabels (0, aNbLabels);
+    TColStd_MapOfInteger anExisting;
+    NCollection_DataMap<Standard_Integer, Standard_GUID> anIDs;
+    for (Standard_Integer i = 1; i <= aNbLabels && theIS; i++)
+    {
+      const TDF_Label aLabel = getLabel (theIS, theData, Standard_True);
+      aLabels (i) = aLabel;
+      const Standard_Integer aNbAttr = getInteger (theIS);
+      if (aLabel.IsNull() || aNbAttr < 0)
+        throw Standard_Failure ("invalid journal index");
+
+      NCollection_Map<Standard_GUID, Standard_GUID> aKept;
+      for (Standard_Integer j = 1; j <= aNbAttr && theIS; j++)
+      {
+        const Standard_Integer anId = getInteger (theIS);
+        const Standard_GUID aGUID = getGUID (theIS);
+        Handle(TDF_Attribute) anAtt;
+        if (aLabel.FindAttribute (aGUID, anAtt))
+        {
+          myRelocTable.Bind (anId, anAtt);
+          anExisting.Add (anId);
+        }
+        anIDs.Bind (anId, aGUID);
+        aKept.Add (aGUID);
+      }
+
+      TDF_AttributeList aRemoved;
+      for (TDF_AttributeIterator anAttIter (aLabel); anAttIter.More(); anAttIter.Next())
+      {
+        Handle(BinMDF_ADriver) aDriver;
+        myDrivers->GetDriver (anAttIter.Value()->DynamicType(), aDriver);
+        if (!aDriver.IsNull() && !aKept.Contains (anAttIter.Value()->ID()))
+          aRemoved.Append (anAttIter.Value());
+      }
+      for (TDF_ListIteratorOfAttributeList anIter (aRemoved); anIter.More(); anIter.Next())
+        aLabel.ForgetAttribute (anIter.Value());
+    }
+
+    // attributes out of the segment referred by the stored ones
+    const Standard_Integer aNbExternals = theIS ? getInteger (theIS) : -1;
+    if (aNbExternals < 0)
+      throw Standard_Failure ("invalid journal index");
+    for (Standard_Integer i = 1; i <= aNbExternals && theIS; i++)
+    {
+      const Standard_Integer anId = getInteger (theIS);
+      const TDF_Label aLabel = getLabel (theIS, theData, Standard_False);
+      const Standard_GUID aGUID = getGUID (theIS);
+      Handle(TDF_Attribute) anAtt;
+      if (!aLabel.IsNull() && aLabel.FindAttribute (aGUID, anAtt))
+        myRelocTable.Bind (anId, anAtt);
+      else
+        myMsgDriver->Send (aMethStr + "warning: attribute referred by journal is not found", Message_Warning);
+    }
+
+    // 3. Shapes
+    BinLDrivers_DocumentSection aShapesSection;
+    BinLDrivers_DocumentSection::ReadTOC (aShapesSection, theIS);
+    if (!theIS || !aShapesSection.Name().IsEqual ((Standard_CString)SHAPESECTION_POS))
+      throw Standard_Failure ("shape section of journal is not found");
+    const streampos aRecordsPos = theIS.tellg();
+    theIS.seekg ((streampos) aShapesSection.Offset());
+    ReadShapeSection (aShapesSection, theIS);
+    theIS.seekg (aRecordsPos);
+
+    // 4. Attributes
+    myPAtt.Init();
+    for (Standard_Integer i = 1; i <= aNbLabels; i++)
+    {
+      theIS >> myPAtt;
+      while (theIS && myPAtt.TypeId() > 0 && myPAtt.Id() > 0)
+      {
+        Handle(BinMDF_ADriver) aDriver = myDrivers->GetDriver (myPAtt.TypeId());
+        const Standard_Integer anId = myPAtt.Id();
+        if (aDriver.IsNull() || !anIDs.IsBound (anId))
+        {
+          myMsgDriver->Send (aMethStr + "warning: type ID not registered in journal: "
+                           + myPAtt.TypeId(), Message_Warning);
+          theIS >> myPAtt;
+          continue;
+        }
+
+        const Standard_GUID& aGUID = anIDs.Find (anId);
+        const Standard_Boolean isBound = myRelocTable.IsBound (anId);
+        Handle(TDF_Attribute) tAtt = isBound
+                                   ? Handle(TDF_Attribute)::DownCast (myRelocTable.Find (anId))
+                                   : aDriver->NewEmpty();
+        if (anExisting.Contains (anId))
+        {
+          // drivers expect an empty target
+          tAtt->Restore (aDriver->NewEmpty());
+        }
+        if (tAtt->Label().IsNull())
+        {
+          try
+          {
+            aLabels (i).AddAttribute (tAtt);
+          }
+          catch (const Standard_DomainError&)
+          {
+            // see ReadSubTree()
+            static const Standard_GUID fbidGuid;
+            tAtt->SetID (fbidGuid);
+            aLabels (i).AddAttribute (tAtt);
+          }
+        }
+
+        if (!aDriver->Paste (myPAtt, tAtt, myRelocTable))
+          myMsgDriver->Send (aMethStr + "warning: failure reading attribute " +
+                             aDriver->TypeName(), Message_Warning);
+        else if (!isBound)
+          myRelocTable.Bind (anId, tAtt);
+        if (tAtt->ID() != aGUID)
+          tAtt->SetID (aGUID);
+
+        theIS >> myPAtt;
+      }
+      if (!theIS || myPAtt.TypeId() != BinLDrivers_ENDATTRLIST)
+        throw Standard_Failure ("unexpected end of journal");
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    myMsgDriver->Send (aMethStr + "error: failure reading journal: "
+                     + anException.GetMessageString(), Message_Fail);
+    isOK = Standard_False;
+  }
+  Clear();
+  return isOK;
 }
 
 //=======================================================================
@@ -342,16 +663,17 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
     ("BinLDrivers_DocumentRetrievalDriver: ");
 
   // Read attributes:
-  theIS >> myPAtt;
-  while (theIS && myPAtt.TypeId() > 0 &&             // not an end marker ?
-         myPAtt.Id() > 0 &&                          // not a garbage ?
+  BinObjMgt_Persistent* aPAtt = &attributeBuffer();
+  theIS >> *aPAtt;
+  while (theIS && aPAtt->TypeId() > 0 &&             // not an end marker ?
+         aPAtt->Id() > 0 &&                          // not a garbage ?
          !theIS.eof()) {
     // get a driver according to TypeId
-    Handle(BinMDF_ADriver) aDriver = myDrivers->GetDriver (myPAtt.TypeId());
+    Handle(BinMDF_ADriver) aDriver = myDrivers->GetDriver (aPAtt->TypeId());
     if (!aDriver.IsNull()) {
       // create transient attribute
       nbRead++;
-      Standard_Integer anID = myPAtt.Id();
+      Standard_Integer anID = aPAtt->Id();
       Handle(TDF_Attribute) tAtt;
       Standard_Boolean isBound = myRelocTable.IsBound(anID);
       if (isBound)
@@ -359,6 +681,8 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
       else
         tAtt = aDriver->NewEmpty();
 
+      // set if the label already has an attribute with the same GUID
+      Standard_Boolean isConflict = Standard_False;
       if (tAtt->Label().IsNull())
       {
         try
@@ -367,13 +691,33 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
         }
         catch (const Standard_DomainError&)
         {
-          // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
-          // will be raised in valid case if attribute of that type with default GUID is already
-          // present  on the same label; the reason is that actual GUID will be read later.
-          // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
-          static const Standard_GUID fbidGuid;
-          tAtt->SetID (fbidGuid);
-          theLabel.AddAttribute (tAtt);
+          // the conflicting attribute may be one whose GUID is not read yet
+          // because it is deferred: read the pending ones and try again
+          Standard_Boolean isAdded = Standard_False;
+          isConflict = Standard_True;
+          if (myNbDeferred > 0)
+          {
+            PasteDeferred();
+            try
+            {
+              theLabel.AddAttribute (tAtt);
+              isAdded = Standard_True;
+            }
+            catch (const Standard_DomainError&)
+            {
+              // the conflict is real, use the fall-back below
+            }
+          }
+          if (!isAdded)
+          {
+            // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
+            // will be raised in valid case if attribute of that type with default GUID is already
+            // present  on the same label; the reason is that actual GUID will be read later.
+            // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
+            static const Standard_GUID fbidGuid;
+            tAtt->SetID (fbidGuid);
+            theLabel.AddAttribute (tAtt);
+          }
         }
       }
       else
@@ -381,23 +725,42 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
                      "warning: attempt to attach attribute " +
                      aDriver->TypeName() + " to a second label", Message_Warning);
 
-      Standard_Boolean ok = aDriver->Paste (myPAtt, tAtt, myRelocTable);
-      if (!ok) {
-        // error converting persistent to transient
-        myMsgDriver->Send (aMethStr + "warning: failure reading attribute " +
-                      aDriver->TypeName(), Message_Warning);
+      // an attribute in conflict is pasted at once: after PasteDeferred() its data
+      // is no more in the batch slot, and if attached with the null GUID it has
+      // to get its actual GUID before the next attribute of its type is attached
+      if (myIsParallel && aDriver->IsPasteThreadSafe() && !isConflict
+       && aPAtt->Length() >= DEFERRED_MIN_LENGTH)
+      {
+        // keep the data in the batch slot, it is decoded by PasteDeferred()
+        DeferredAttribute& aDeferred = myDeferred.ChangeValue (++myNbDeferred);
+        aDeferred.Driver    = aDriver;
+        aDeferred.Attribute = tAtt;
+        if (!isBound)
+          myRelocTable.Bind (anID, tAtt);
+        if (myNbDeferred == myDeferred.Upper())
+          PasteDeferred();
+      }
+      else
+      {
+        Standard_Boolean ok = aDriver->Paste (*aPAtt, tAtt, myRelocTable);
+        if (!ok) {
+          // error converting persistent to transient
+          myMsgDriver->Send (aMethStr + "warning: failure reading attribute " +
+                        aDriver->TypeName(), Message_Warning);
+        }
+        else if (!isBound)
+          myRelocTable.Bind (anID, tAtt);
       }
-      else if (!isBound)
-        myRelocTable.Bind (anID, tAtt);
     }
-    else if (!myMapUnsupported.Contains(myPAtt.TypeId()))
+    else if (!myMapUnsupported.Contains(aPAtt->TypeId()))
       myMsgDriver->Send (aMethStr + "warning: type ID not registered in header: "
-                    + myPAtt.TypeId(), Message_Warning);
+                    + aPAtt->TypeId(), Message_Warning);
 
     // read next attribute
-    theIS >> myPAtt;
+    aPAtt = &attributeBuffer();
+    theIS >> *aPAtt;
   }
-  if (!theIS || myPAtt.TypeId() != BinLDrivers_ENDATTRLIST) {
+  if (!theIS || aPAtt->TypeId() != BinLDrivers_ENDATTRLIST) {
     // unexpected EOF or garbage data
     myMsgDriver->Send (aMethStr + "error: unexpected EOF or garbage data", Message_Fail);
     myReaderStatus = PCDM_RS_UnrecognizedFileFormat;
@@ -438,6 +801,74 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
   return nbRead;
 }
 
+namespace
+{
+  //! Functor decoding the deferred attributes in parallel threads.
+  template<class DeferredAttribute>
+  class DeferredPasteFunctor
+  {
+  public:
+    DeferredPasteFunctor (NCollection_Array1<DeferredAttribute>& theDeferred,
+                          BinObjMgt_RRelocationTable&            theRelocTable)
+    : myDeferred (theDeferred), myRelocTable (theRelocTable) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      DeferredAttribute& anItem = myDeferred.ChangeValue (theIndex);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        anItem.IsPasted = anItem.Driver->Paste (anItem.Data, anItem.Attribute, myRelocTable);
+      }
+      catch (const Standard_Failure&)
+      {
+        anItem.IsPasted = Standard_False;
+      }
+    }
+
+  private:
+    DeferredPasteFunctor (const DeferredPasteFunctor&);
+    DeferredPasteFunctor& operator= (const DeferredPasteFunctor&);
+
+  private:
+    NCollection_Array1<DeferredAttribute>& myDeferred;
+    // not used by the drivers which paste concurrently
+    BinObjMgt_RRelocationTable&            myRelocTable;
+  };
+}
+
+//=======================================================================
+//function : PasteDeferred
+//purpose  : Attributes are deferred only if their drivers redefine
+//           BinMDF_ADriver::IsPasteThreadSafe(): these are the arrays,
+//           lists and named data of BinMDataStd, whose retrieval just
+//           decodes the persistent data into the (already attached)
+//           attribute, so that the batch can be pasted concurrently.
+//=======================================================================
+
+void BinLDrivers_DocumentRetrievalDriver::PasteDeferred()
+{
+  if (myNbDeferred == 0)
+    return;
+
+  DeferredPasteFunctor<DeferredAttribute> aFunctor (myDeferred, myRelocTable);
+  OSD_Parallel::For (myDeferred.Lower(), myDeferred.Lower() + myNbDeferred, aFunctor);
+
+  // report in the order of the file and release the references
+  static const TCollection_ExtendedString aMethStr
+    ("BinLDrivers_DocumentRetrievalDriver: ");
+  for (Standard_Integer anIndex = myDeferred.Lower(); anIndex < myDeferred.Lower() + myNbDeferred; ++anIndex)
+  {
+    DeferredAttribute& anItem = myDeferred.ChangeValue (anIndex);
+    if (!anItem.IsPasted)
+      myMsgDriver->Send (aMethStr + "warning: failure reading attribute " +
+                         anItem.Driver->TypeName(), Message_Warning);
+    anItem.Driver.Nullify();
+    anItem.Attribute.Nullify();
+  }
+  myNbDeferred = 0;
+}
+
 //=======================================================================
 //function : AttributeDrivers
 //purpose  :
@@ -507,6 +938,8 @@ void BinLDrivers_DocumentRetrievalDriver::CheckShapeSection(
 void BinLDrivers_DocumentRetrievalDriver::Clear()
 {
   myPAtt.Destroy();    // free buffer
+  for (Standard_Integer i = myDeferred.Lower(); i <= myDeferred.Upper(); i++)
+    myDeferred.ChangeValue (i).Data.Destroy();
   myRelocTable.Clear();
   myMapUnsupported.Clear();
 }
@@ -21,6 +21,7 @@
 
 #include <BinObjMgt_Persistent.hxx>
 #include <BinObjMgt_RRelocationTable.hxx>
+#include <NCollection_Array1.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <BinLDrivers_VectorOfDocumentSection.hxx>
 #include <PCDM_RetrievalDriver.hxx>
@@ -30,13 +31,16 @@
 #include <Standard_Boolean.hxx>
 #include <Storage_Data.hxx>
 
+class BinMDF_ADriver;
 class BinMDF_ADriverTable;
 class Message_Messenger;
 class TCollection_ExtendedString;
 class PCDM_Document;
 class CDM_Document;
 class CDM_Application;
+class TDF_Attribute;
 class TDF_Label;
+class TDF_Data;
 class TCollection_AsciiString;
 class Storage_HeaderData;
 class BinLDrivers_DocumentSection;
@@ -68,6 +72,16 @@ public:
   
   Standard_EXPORT virtual Handle(BinMDF_ADriverTable) AttributeDrivers (const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Sets the flag enabling concurrent retrieval of the attributes whose
+  //! drivers report BinMDF_ADriver::IsPasteThreadSafe() (arrays, lists,
+  //! named data). Such attributes are attached to their labels during the
+  //! sequential scan of the file, while their contents are decoded later
+  //! in batches by several threads. Disabled by default.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of concurrent attribute retrieval.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
 
 
 
@@ -89,6 +103,18 @@ protected:
   //! checks the shapes section can be correctly retreived.
   Standard_EXPORT virtual void CheckShapeSection (const Storage_Position& thePos, Standard_IStream& theIS);
 
+  //! Decodes the attributes deferred by ReadSubTree() in parallel
+  //! and reports the ones that failed.
+  Standard_EXPORT void PasteDeferred();
+
+  //! Replays the journal segments appended to the document image by
+  //! BinLDrivers_DocumentStorageDriver::WriteJournal() over <theData>.
+  //! Returns False if the journal is corrupted.
+  Standard_EXPORT Standard_Boolean ReadJournal (Standard_IStream& theIS, const Handle(TDF_Data)& theData);
+
+  //! Applies the journal segment starting at the current position of <theIS>.
+  Standard_EXPORT Standard_Boolean ReadJournalSegment (Standard_IStream& theIS, const Handle(TDF_Data)& theData);
+
   //! clears the reading-cash data in drivers if any.
   Standard_EXPORT virtual void Clear();
 
@@ -108,10 +134,30 @@ protected:
 
 private:
 
+  //! Attribute waiting for the concurrent decoding of its persistent data.
+  struct DeferredAttribute
+  {
+    BinObjMgt_Persistent   Data;
+    Handle(BinMDF_ADriver) Driver;
+    Handle(TDF_Attribute)  Attribute;
+    Standard_Boolean       IsPasted;
+  };
+
+  //! Returns the buffer to read the next attribute into:
+  //! the free slot of the deferred batch in parallel mode, myPAtt otherwise.
+  BinObjMgt_Persistent& attributeBuffer()
+  {
+    return myIsParallel ? myDeferred.ChangeValue (myNbDeferred + 1).Data : myPAtt;
+  }
+
+private:
 
   BinObjMgt_Persistent myPAtt;
   TColStd_MapOfInteger myMapUnsupported;
   BinLDrivers_VectorOfDocumentSection mySections;
+  NCollection_Array1<DeferredAttribute> myDeferred;
+  Standard_Integer myNbDeferred;
+  Standard_Boolean myIsParallel;
 
 
 };
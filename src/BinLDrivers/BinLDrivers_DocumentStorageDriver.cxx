@@ -29,6 +29,7 @@
 #include <OSD_OpenFile.hxx>
 #include <PCDM_ReadWriter.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Standard_GUID.hxx>
 #include <Standard_Type.hxx>
 #include <Storage_Schema.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -36,10 +37,13 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <TColStd_ListOfInteger.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TDF_AttributeIterator.hxx>
 #include <TDF_ChildIterator.hxx>
 #include <TDF_Data.hxx>
 #include <TDF_Label.hxx>
+#include <TDF_LabelMap.hxx>
+#include <TDF_MapIteratorOfLabelMap.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 
@@ -47,12 +51,18 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentStorageDriver,PCDM_StorageDriver)
 
 #define SHAPESECTION_POS (Standard_CString)"SHAPE_SECTION_POS:"
 
+// signature opening each journal segment and closing the file with segments
+#define JOURNAL_SIGNATURE "OCAF_BIN_JOURNAL"
+#define JOURNAL_SIGNATURE_SIZE 16
+#define JOURNAL_DEFAULT_LIMIT 16
+
 //=======================================================================
 //function : BinLDrivers_DocumentStorageDriver
 //purpose  : Constructor
 //=======================================================================
 
 BinLDrivers_DocumentStorageDriver::BinLDrivers_DocumentStorageDriver ()
+: myJournalLimit (JOURNAL_DEFAULT_LIMIT)
 {
 }
 
@@ -175,6 +185,292 @@ void BinLDrivers_DocumentStorageDriver::Write (const Handle(CDM_Document)& theDo
       SetStoreStatus(PCDM_SS_WriteFailure);
     }
 
+    // the journal of the next incremental save starts from this image
+    if (!IsError())
+      aDoc->ClearJournal();
+  }
+}
+
+//=======================================================================
+//function : WriteJournal
+//purpose  :
+//=======================================================================
+
+void BinLDrivers_DocumentStorageDriver::WriteJournal
+                          (const Handle(CDM_Document)&       theDocument,
+                           const TCollection_ExtendedString& theFileName)
+{
+  SetIsError(Standard_False);
+  SetStoreStatus(PCDM_SS_OK);
+
+  {
+    std::fstream aFileStream;
+    OSD_OpenStream (aFileStream, theFileName, std::ios::in | std::ios::out | std::ios::binary);
+    if (aFileStream.is_open() && aFileStream.good()
+     && WriteJournal (theDocument, aFileStream))
+    {
+      if (!aFileStream.good())
+      {
+        SetIsError (Standard_True);
+        SetStoreStatus (PCDM_SS_WriteFailure);
+      }
+      return;
+    }
+  }
+
+  // compaction: rewrite the whole document
+  Write (theDocument, theFileName);
+}
+
+//=======================================================================
+//function : WriteJournal
+//purpose  :
+//=======================================================================
+
+Standard_Boolean BinLDrivers_DocumentStorageDriver::WriteJournal
+                          (const Handle(CDM_Document)& theDoc,
+                           std::iostream&              theStream)
+{
+  Handle(TDocStd_Document) aDoc = Handle(TDocStd_Document)::DownCast(theDoc);
+  if (aDoc.IsNull() || !aDoc->IsJournalMode())
+    return Standard_False;
+
+  // modifications missed by the journal are saved only by a full rewrite
+  if (!aDoc->IsJournalComplete())
+    return Standard_False;
+
+  // check that the stream contains a document
+  const Standard_Size aMagicSize = strlen (FSD_BinaryFile::MagicNumber());
+  char aBuffer[JOURNAL_SIGNATURE_SIZE + 1];
+  theStream.seekg (0, std::ios::end);
+  const uint64_t aFileSize = (uint64_t) theStream.tellg();
+  theStream.seekg (0, std::ios::beg);
+  if (!theStream.read (aBuffer, aMagicSize)
+   || strncmp (aBuffer, FSD_BinaryFile::MagicNumber(), aMagicSize) != 0)
+    return Standard_False;
+
+  // find the last segment in the trailer and count the segments
+  uint64_t aLastSegment = 0;
+  const uint64_t aTrailerSize = sizeof(uint64_t) + JOURNAL_SIGNATURE_SIZE;
+  if (aFileSize > aTrailerSize)
+  {
+    theStream.seekg ((std::streamoff) (aFileSize - aTrailerSize));
+    uint64_t aPos = 0;
+    theStream.read ((char*) &aPos, sizeof(uint64_t));
+    theStream.read (aBuffer, JOURNAL_SIGNATURE_SIZE);
+#if DO_INVERSE
+    aPos = FSD_BinaryFile::InverseUint64 (aPos);
+#endif
+    if (theStream && strncmp (aBuffer, JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE) == 0)
+      aLastSegment = aPos;
+  }
+
+  Standard_Integer aNbSegments = 0;
+  for (uint64_t aPos = aLastSegment; aPos != 0; ++aNbSegments)
+  {
+    if (aNbSegments >= myJournalLimit)
+      return Standard_False;
+
+    uint64_t aPrev = 0;
+    theStream.seekg ((std::streamoff) aPos);
+    theStream.read (aBuffer, JOURNAL_SIGNATURE_SIZE);
+    theStream.read ((char*) &aPrev, sizeof(uint64_t));
+#if DO_INVERSE
+    aPrev = FSD_BinaryFile::InverseUint64 (aPrev);
+#endif
+    if (!theStream || strncmp (aBuffer, JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE) != 0
+     || aPrev >= aPos)
+      return Standard_False; // broken chain, compact the document
+    aPos = aPrev;
+  }
+  if (aNbSegments >= myJournalLimit)
+    return Standard_False;
+
+  // the file is up to date
+  if (aDoc->JournalLabels().IsEmpty())
+    return Standard_True;
+
+  theStream.clear();
+  theStream.seekp (0, std::ios::end);
+  WriteJournalSegment (aDoc, theStream, aLastSegment);
+  if (!IsError())
+    aDoc->ClearJournal();
+  return Standard_True;
+}
+
+//=======================================================================
+//function : putInteger, putLabel, putGUID
+//purpose  : Helpers writing the journal segment
+//=======================================================================
+
+static void putInteger (Standard_OStream& theOS, Standard_Integer theValue)
+{
+#if DO_INVERSE
+  theValue = FSD_BinaryFile::InverseInt (theValue);
+#endif
+  theOS.write ((char*) &theValue, sizeof(Standard_Integer));
+}
+
+static void putLabel (Standard_OStream& theOS, const TDF_Label& theLabel)
+{
+  TColStd_ListOfInteger aTags;
+  TDF_Tool::TagList (theLabel, aTags);
+  putInteger (theOS, aTags.Extent());
+  for (TColStd_ListIteratorOfListOfInteger anIter (aTags); anIter.More(); anIter.Next())
+    putInteger (theOS, anIter.Value());
+}
+
+static void putGUID (Standard_OStream& theOS, const Standard_GUID& theGUID)
+{
+  char aGUIDStr[Standard_GUID_SIZE_ALLOC];
+  Standard_PCharacter aGUIDPtr = aGUIDStr;
+  theGUID.ToCString (aGUIDPtr);
+  theOS.write (aGUIDStr, Standard_GUID_SIZE);
+}
+
+//=======================================================================
+//function : WriteJournalSegment
+//purpose  : Writes the labels modified since the last save so that the
+//           retrieval driver could replay them over the saved image
+//=======================================================================
+
+void BinLDrivers_DocumentStorageDriver::WriteJournalSegment
+                          (const Handle(TDocStd_Document)& theDoc,
+                           Standard_OStream&               theOS,
+                           const uint64_t                  thePrevSegment)
+{
+  myMsgDriver = theDoc->Application()->MessageDriver();
+  myMapUnsupported.Clear();
+  if (myDrivers.IsNull())
+    myDrivers = AttributeDrivers (myMsgDriver);
+
+  // assign IDs to the types of attributes of the modified labels
+  const TDF_LabelMap& aLabels = theDoc->JournalLabels();
+  myTypesMap.Clear();
+  TDF_MapIteratorOfLabelMap aLabIter (aLabels);
+  for (; aLabIter.More(); aLabIter.Next())
+  {
+    for (TDF_AttributeIterator anAttIter (aLabIter.Key()); anAttIter.More(); anAttIter.Next())
+    {
+      Handle(BinMDF_ADriver) aDriver;
+      const Handle(Standard_Type)& aType = anAttIter.Value()->DynamicType();
+      myDrivers->GetDriver (aType, aDriver);
+      if (!aDriver.IsNull())
+        myTypesMap.Add (aType);
+    }
+  }
+  myDrivers->AssignIds (myTypesMap);
+
+  // The index lists the attributes of each label (object ID and GUID),
+  // so that the reader could bind the objects before pasting the data;
+  // the attributes themselves follow the index as in WriteSubTree()
+  Standard_SStream anIndex, aRecords;
+  TColStd_MapOfInteger aWritten;
+  myRelocTable.Clear();
+  myPAtt.Init();
+  putInteger (anIndex, aLabels.Extent());
+  for (aLabIter.Initialize (aLabels); aLabIter.More(); aLabIter.Next())
+  {
+    const TDF_Label& aLabel = aLabIter.Key();
+    putLabel (anIndex, aLabel);
+
+    Standard_Integer aNbAttr = 0;
+    TDF_AttributeIterator anAttIter (aLabel);
+    for (; anAttIter.More(); anAttIter.Next())
+    {
+      Handle(BinMDF_ADriver) aDriver;
+      if (myDrivers->GetDriver (anAttIter.Value()->DynamicType(), aDriver) > 0)
+        ++aNbAttr;
+    }
+    putInteger (anIndex, aNbAttr);
+
+    for (anAttIter.Initialize (aLabel); anAttIter.More(); anAttIter.Next())
+    {
+      const Handle(TDF_Attribute)& tAtt = anAttIter.Value();
+      Handle(BinMDF_ADriver) aDriver;
+      const Standard_Integer aTypeId = myDrivers->GetDriver (tAtt->DynamicType(), aDriver);
+      if (aTypeId <= 0)
+        continue;
+
+      const Standard_Integer anId = myRelocTable.Add (tAtt);
+      aWritten.Add (anId);
+      putInteger (anIndex, anId);
+      putGUID (anIndex, tAtt->ID());
+
+      myPAtt.SetTypeId (aTypeId);
+      myPAtt.SetId (anId);
+      aDriver->Paste (tAtt, myPAtt, myRelocTable);
+      aRecords << myPAtt;
+    }
+
+    BinLDrivers_Marker anEndAttr = BinLDrivers_ENDATTRLIST;
+#if DO_INVERSE
+    anEndAttr = (BinLDrivers_Marker) FSD_BinaryFile::InverseInt (anEndAttr);
+#endif
+    aRecords.write ((char*)&anEndAttr, sizeof(anEndAttr));
+  }
+
+  // attributes out of the segment referred by the written ones
+  TColStd_ListOfInteger anExternals;
+  for (Standard_Integer anId = 1; anId <= myRelocTable.Extent(); ++anId)
+  {
+    Handle(TDF_Attribute) anAtt = Handle(TDF_Attribute)::DownCast (myRelocTable (anId));
+    if (!aWritten.Contains (anId) && !anAtt.IsNull() && !anAtt->Label().IsNull())
+      anExternals.Append (anId);
+  }
+
+  // 1. Header and types table
+  const uint64_t aSegmentPos = (uint64_t) theOS.tellp();
+  uint64_t aPrevSegment = thePrevSegment;
+#if DO_INVERSE
+  aPrevSegment = FSD_BinaryFile::InverseUint64 (aPrevSegment);
+#endif
+  theOS.write (JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE);
+  theOS.write ((char*) &aPrevSegment, sizeof(uint64_t));
+  putInteger (theOS, BinLDrivers::StorageVersion().IntegerValue());
+  putInteger (theOS, myTypesMap.Extent());
+  for (Standard_Integer i = 1; i <= myTypesMap.Extent(); i++)
+  {
+    const TCollection_AsciiString& aTypeName = myDrivers->GetDriver(i)->TypeName();
+    putInteger (theOS, aTypeName.Length());
+    theOS.write (aTypeName.ToCString(), aTypeName.Length());
+  }
+
+  // 2. Index of labels and external references
+  const std::string anIndexData = anIndex.str();
+  theOS.write (anIndexData.c_str(), anIndexData.size());
+  putInteger (theOS, anExternals.Extent());
+  for (TColStd_ListIteratorOfListOfInteger anIter (anExternals); anIter.More(); anIter.Next())
+  {
+    Handle(TDF_Attribute) anAtt = Handle(TDF_Attribute)::DownCast (myRelocTable (anIter.Value()));
+    putInteger (theOS, anIter.Value());
+    putLabel (theOS, anAtt->Label());
+    putGUID (theOS, anAtt->ID());
+  }
+
+  // 3. Attributes and shapes
+  BinLDrivers_DocumentSection aShapesSection (SHAPESECTION_POS, Standard_False);
+  aShapesSection.WriteTOC (theOS);
+  const std::string aRecordsData = aRecords.str();
+  theOS.write (aRecordsData.c_str(), aRecordsData.size());
+  WriteShapeSection (aShapesSection, theOS);
+
+  // 4. Trailer pointing to this segment
+  uint64_t aSegmentRef = aSegmentPos;
+#if DO_INVERSE
+  aSegmentRef = FSD_BinaryFile::InverseUint64 (aSegmentRef);
+#endif
+  theOS.write ((char*) &aSegmentRef, sizeof(uint64_t));
+  theOS.write (JOURNAL_SIGNATURE, JOURNAL_SIGNATURE_SIZE);
+
+  myPAtt.Destroy();
+  myRelocTable.Clear();
+  myTypesMap.Clear();
+  myMapUnsupported.Clear();
+  if (!theOS)
+  {
+    SetIsError (Standard_True);
+    SetStoreStatus (PCDM_SS_WriteFailure);
   }
 }
 
@@ -36,6 +36,7 @@ class CDM_Document;
 class TDF_Label;
 class TCollection_AsciiString;
 class BinLDrivers_DocumentSection;
+class TDocStd_Document;
 
 
 class BinLDrivers_DocumentStorageDriver;
@@ -62,6 +63,29 @@ public:
   //! Create a section that should be written after the OCAF data
   Standard_EXPORT void AddSection (const TCollection_AsciiString& theName, const Standard_Boolean isPostRead = Standard_True);
 
+  //! Saves <theDocument> incrementally: appends to the file <theFileName>,
+  //! written before by this driver, a journal segment with the labels
+  //! recorded in the modification journal of the document
+  //! (see TDocStd_Document::SetJournalMode()).
+  //! Performs compaction, i.e. writes the whole document as Write() does,
+  //! if the file does not contain a document, the journal is not recorded
+  //! or misses some modifications (see TDocStd_Document::IsJournalComplete())
+  //! or the number of segments in the file has reached JournalLimit().
+  Standard_EXPORT virtual void WriteJournal (const Handle(CDM_Document)& theDocument, const TCollection_ExtendedString& theFileName);
+
+  //! Appends a journal segment to <theStream> containing the document written
+  //! before by this driver; nothing is written if the journal is empty.
+  //! Returns False without writing anything if the segment cannot be
+  //! appended and the document should be compacted.
+  Standard_EXPORT Standard_Boolean WriteJournal (const Handle(CDM_Document)& theDocument, std::iostream& theStream);
+
+  //! Returns the maximal number of journal segments in a file.
+  Standard_Integer JournalLimit() const { return myJournalLimit; }
+
+  //! Sets the maximal number of journal segments in a file;
+  //! the document is compacted when the limit is reached.
+  void SetJournalLimit (const Standard_Integer theLimit) { myJournalLimit = theLimit; }
+
 
 
 
@@ -79,6 +103,12 @@ protected:
   //! defines the procedure of writing a shape  section to file
   Standard_EXPORT virtual void WriteShapeSection (BinLDrivers_DocumentSection& theDocSection, Standard_OStream& theOS);
 
+  //! Writes the journal segment with the labels modified in <theDoc>;
+  //! <thePrevSegment> is the offset of the previous segment (0 if none).
+  Standard_EXPORT void WriteJournalSegment (const Handle(TDocStd_Document)& theDoc,
+                                            Standard_OStream& theOS,
+                                            const uint64_t thePrevSegment);
+
   Handle(BinMDF_ADriverTable) myDrivers;
   BinObjMgt_SRelocationTable myRelocTable;
   Handle(Message_Messenger) myMsgDriver;
@@ -103,6 +133,7 @@ private:
   TColStd_IndexedMapOfTransient myTypesMap;
   BinLDrivers_VectorOfDocumentSection mySections;
   TCollection_ExtendedString myFileName;
+  Standard_Integer myJournalLimit;
 
 
 };
@@ -63,6 +63,13 @@ public:
   //! <aRelocTable> to keep the sharings.
   Standard_EXPORT virtual void Paste (const Handle(TDF_Attribute)& aSource, BinObjMgt_Persistent& aTarget, BinObjMgt_SRelocationTable& aRelocTable) const = 0;
 
+  //! Returns true if the retrieval Paste() of this driver only decodes
+  //! the persistent data into the target attribute, i.e. it neither uses
+  //! the relocation table nor resolves labels or reports messages.
+  //! Such attributes may be pasted concurrently by the document
+  //! retrieval driver. The default implementation returns false.
+  virtual Standard_Boolean IsPasteThreadSafe() const { return Standard_False; }
+
 
   DEFINE_STANDARD_RTTIEXT(BinMDF_ADriver,Standard_Transient)
 
@@ -137,10 +137,13 @@ Standard_IStream& BinTools::GetBool(Standard_IStream& IS, Standard_Boolean& aVal
 //purpose  : 
 //=======================================================================
 
-void BinTools::Write (const TopoDS_Shape& theShape, Standard_OStream& theStream)
+void BinTools::Write (const TopoDS_Shape& theShape, Standard_OStream& theStream,
+                      const Standard_Integer theFormatNb,
+                      const Standard_Boolean theWithCompression)
 {
   BinTools_ShapeSet aShapeSet(Standard_True);
-  aShapeSet.SetFormatNb (3);
+  aShapeSet.SetFormatNb (theFormatNb);
+  aShapeSet.SetWithCompression (theWithCompression);
   aShapeSet.Add (theShape);
   aShapeSet.Write (theStream);
   aShapeSet.Write (theShape, theStream);
@@ -163,7 +166,9 @@ void BinTools::Read (TopoDS_Shape& theShape, Standard_IStream& theStream)
 //purpose  : 
 //=======================================================================
 
-Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape, const Standard_CString theFile)
+Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape, const Standard_CString theFile,
+                                  const Standard_Integer theFormatNb,
+                                  const Standard_Boolean theWithCompression)
 {
   ofstream aStream;
   aStream.precision (15);
@@ -171,7 +176,7 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape, const Standard_C
   if (!aStream.good())
     return Standard_False;
 
-  Write (theShape, aStream);
+  Write (theShape, aStream, theFormatNb, theWithCompression);
   aStream.close();
   return aStream.good();
 }
@@ -59,14 +59,20 @@ public:
   
   Standard_EXPORT static Standard_IStream& GetExtChar (Standard_IStream& IS, Standard_ExtCharacter& theValue);
   
-  //! Writes <theShape> on <theStream> in binary format.
-  Standard_EXPORT static void Write (const TopoDS_Shape& theShape, Standard_OStream& theStream);
+  //! Writes <theShape> on <theStream> in binary format of version <theFormatNb>
+  //! (see BinTools_ShapeSet::SetFormatNb()); <theWithCompression> packs
+  //! triangulations and polygons, in format 4 only.
+  Standard_EXPORT static void Write (const TopoDS_Shape& theShape, Standard_OStream& theStream,
+                                     const Standard_Integer theFormatNb = 3,
+                                     const Standard_Boolean theWithCompression = Standard_False);
   
   //! Reads a shape from <theStream> and returns it in <theShape>.
   Standard_EXPORT static void Read (TopoDS_Shape& theShape, Standard_IStream& theStream);
   
-  //! Writes <theShape> in <theFile>.
-  Standard_EXPORT static Standard_Boolean Write (const TopoDS_Shape& theShape, const Standard_CString theFile);
+  //! Writes <theShape> in <theFile> (see Write() on stream for the other parameters).
+  Standard_EXPORT static Standard_Boolean Write (const TopoDS_Shape& theShape, const Standard_CString theFile,
+                                                 const Standard_Integer theFormatNb = 3,
+                                                 const Standard_Boolean theWithCompression = Standard_False);
   
   //! Reads a shape from <theFile> and returns it in <theShape>.
   Standard_EXPORT static Standard_Boolean Read (TopoDS_Shape& theShape, const Standard_CString theFile);
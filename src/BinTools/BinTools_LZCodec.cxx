@@ -0,0 +1,228 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_LZCodec.hxx>
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  static const Standard_Size THE_MIN_MATCH   = 4;
+  static const Standard_Size THE_MAX_OFFSET  = 65535;
+  static const Standard_Size THE_HASH_BITS   = 14;
+  // bytes at the end of the input always stored as literals
+  static const Standard_Size THE_LAST_LITERALS = 5;
+
+  //! Reads 4 bytes at the given position.
+  inline unsigned int read32 (const unsigned char* theData)
+  {
+    unsigned int aValue;
+    memcpy (&aValue, theData, sizeof(aValue));
+    return aValue;
+  }
+
+  //! Hash of 4 bytes used to find match candidates.
+  inline Standard_Size hash32 (const unsigned int theValue)
+  {
+    return (Standard_Size )((theValue * 2654435761U) >> (32 - THE_HASH_BITS));
+  }
+
+  //! Appends length continuation bytes.
+  inline void putLength (std::string& theResult, Standard_Size theLength)
+  {
+    for (; theLength >= 255; theLength -= 255)
+    {
+      theResult.push_back ((char )255);
+    }
+    theResult.push_back ((char )theLength);
+  }
+
+  //! Reads length continuation bytes; returns FALSE on overrun.
+  inline Standard_Boolean getLength (const unsigned char* theData,
+                                     const Standard_Size  theSize,
+                                     Standard_Size&       thePos,
+                                     Standard_Size&       theLength)
+  {
+    for (;;)
+    {
+      if (thePos >= theSize)
+      {
+        return Standard_False;
+      }
+      const unsigned char aByte = theData[thePos++];
+      theLength += aByte;
+      if (aByte != 255)
+      {
+        return Standard_True;
+      }
+    }
+  }
+
+  //! Appends a block with literals [theFrom, theTo) and optional match.
+  inline void putBlock (std::string&         theResult,
+                        const unsigned char* theData,
+                        const Standard_Size  theFrom,
+                        const Standard_Size  theTo,
+                        const Standard_Size  theOffset,
+                        const Standard_Size  theMatchLength)
+  {
+    const Standard_Size aNbLiterals = theTo - theFrom;
+    const Standard_Size aMatchCode  = theMatchLength != 0 ? theMatchLength - THE_MIN_MATCH : 0;
+    const unsigned char aToken = (unsigned char )(((aNbLiterals < 15 ? aNbLiterals : 15) << 4)
+                                                 | (aMatchCode  < 15 ? aMatchCode  : 15));
+    theResult.push_back ((char )aToken);
+    if (aNbLiterals >= 15)
+    {
+      putLength (theResult, aNbLiterals - 15);
+    }
+    theResult.append ((const char* )theData + theFrom, aNbLiterals);
+    if (theMatchLength == 0)
+    {
+      return;
+    }
+
+    theResult.push_back ((char )(theOffset & 0xFF));
+    theResult.push_back ((char )(theOffset >> 8));
+    if (aMatchCode >= 15)
+    {
+      putLength (theResult, aMatchCode - 15);
+    }
+  }
+}
+
+//=======================================================================
+//function : Compress
+//purpose  :
+//=======================================================================
+
+Standard_Boolean BinTools_LZCodec::Compress (const std::string& theData,
+                                             std::string&       theResult)
+{
+  const Standard_Size aSize = theData.size();
+  theResult.clear();
+  if (aSize <= THE_LAST_LITERALS + THE_MIN_MATCH)
+  {
+    return Standard_False;
+  }
+
+  const unsigned char* aData = (const unsigned char* )theData.data();
+  theResult.reserve (aSize);
+
+  // positions are stored shifted by 1 so that 0 means empty slot
+  std::vector<Standard_Size> aTable ((Standard_Size )1 << THE_HASH_BITS, 0);
+  const Standard_Size aMatchLimit = aSize - THE_LAST_LITERALS;
+  Standard_Size anAnchor = 0;
+  for (Standard_Size aPos = 0; aPos + THE_MIN_MATCH <= aMatchLimit;)
+  {
+    const unsigned int  aSeq  = read32 (aData + aPos);
+    Standard_Size&      aSlot = aTable[hash32 (aSeq)];
+    const Standard_Size aCand = aSlot;
+    aSlot = aPos + 1;
+    if (aCand == 0
+     || aPos + 1 - aCand > THE_MAX_OFFSET
+     || read32 (aData + aCand - 1) != aSeq)
+    {
+      ++aPos;
+      continue;
+    }
+
+    const Standard_Size aRef = aCand - 1;
+    Standard_Size aLength = THE_MIN_MATCH;
+    while (aPos + aLength < aMatchLimit
+        && aData[aRef + aLength] == aData[aPos + aLength])
+    {
+      ++aLength;
+    }
+
+    putBlock (theResult, aData, anAnchor, aPos, aPos - aRef, aLength);
+    if (theResult.size() >= aSize)
+    {
+      return Standard_False;
+    }
+    aPos    += aLength;
+    anAnchor = aPos;
+  }
+
+  putBlock (theResult, aData, anAnchor, aSize, 0, 0);
+  return theResult.size() < aSize;
+}
+
+//=======================================================================
+//function : Decompress
+//purpose  :
+//=======================================================================
+
+Standard_Boolean BinTools_LZCodec::Decompress (const std::string&  theData,
+                                               const Standard_Size theRawSize,
+                                               std::string&        theResult)
+{
+  const unsigned char* aData = (const unsigned char* )theData.data();
+  const Standard_Size  aSize = theData.size();
+  theResult.resize (theRawSize);
+  char* aResult = theRawSize != 0 ? &theResult[0] : NULL;
+
+  Standard_Size aPos = 0, anOutPos = 0;
+  while (aPos < aSize)
+  {
+    const unsigned char aToken = aData[aPos++];
+    Standard_Size aNbLiterals = aToken >> 4;
+    if (aNbLiterals == 15
+    && !getLength (aData, aSize, aPos, aNbLiterals))
+    {
+      return Standard_False;
+    }
+    if (aNbLiterals > aSize - aPos
+     || aNbLiterals > theRawSize - anOutPos)
+    {
+      return Standard_False;
+    }
+    memcpy (aResult + anOutPos, aData + aPos, aNbLiterals);
+    aPos     += aNbLiterals;
+    anOutPos += aNbLiterals;
+    if (aPos == aSize)
+    {
+      break;
+    }
+
+    if (aSize - aPos < 2)
+    {
+      return Standard_False;
+    }
+    const Standard_Size anOffset = (Standard_Size )aData[aPos] | ((Standard_Size )aData[aPos + 1] << 8);
+    aPos += 2;
+    Standard_Size aLength = aToken & 0x0F;
+    if (aLength == 15
+    && !getLength (aData, aSize, aPos, aLength))
+    {
+      return Standard_False;
+    }
+    aLength += THE_MIN_MATCH;
+    if (anOffset == 0
+     || anOffset > anOutPos
+     || aLength > theRawSize - anOutPos)
+    {
+      return Standard_False;
+    }
+
+    // byte-wise copy, source and target ranges may overlap
+    const char* aFrom = aResult + anOutPos - anOffset;
+    char*       aTo   = aResult + anOutPos;
+    for (Standard_Size anIter = 0; anIter < aLength; ++anIter)
+    {
+      aTo[anIter] = aFrom[anIter];
+    }
+    anOutPos += aLength;
+  }
+  return anOutPos == theRawSize;
+}
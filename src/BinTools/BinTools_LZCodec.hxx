@@ -0,0 +1,52 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_LZCodec_HeaderFile
+#define _BinTools_LZCodec_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Boolean.hxx>
+
+#include <string>
+
+//! Lossless byte-oriented LZ77 codec used by the binary shape format
+//! to pack triangulation and polygon sections.
+//!
+//! The stream is a sequence of blocks, each consisting of a token byte
+//! (high nibble - number of literals, low nibble - match length minus 4,
+//! value 15 meaning that the length continues in the following bytes),
+//! the literals and a 2-byte little-endian back-reference offset.
+//! The last block carries only literals.
+//! The codec favours decoding speed over compression ratio.
+class BinTools_LZCodec
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Compresses <theData> into <theResult>.
+  //! Returns FALSE (leaving <theResult> undefined) if the packed data
+  //! would not be smaller than the original one.
+  Standard_EXPORT static Standard_Boolean Compress (const std::string& theData,
+                                                    std::string&       theResult);
+
+  //! Restores <theRawSize> bytes packed by Compress() into <theResult>.
+  //! Returns FALSE if <theData> is corrupted.
+  Standard_EXPORT static Standard_Boolean Decompress (const std::string& theData,
+                                                      const Standard_Size theRawSize,
+                                                      std::string&       theResult);
+
+};
+
+#endif // _BinTools_LZCodec_HeaderFile
@@ -17,6 +17,7 @@
 #include <BinTools.hxx>
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_CurveSet.hxx>
+#include <BinTools_LZCodec.hxx>
 #include <BinTools_LocationSet.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
@@ -38,12 +39,16 @@
 #include <BRep_TVertex.hxx>
 #include <BRepTools.hxx>
 #include <gp_Trsf.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly_Polygon2D.hxx>
 #include <Poly_Polygon3D.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfReal.hxx>
@@ -57,6 +62,7 @@
 const char* Version_1  = "Open CASCADE Topology V1 (c)";
 const char* Version_2  = "Open CASCADE Topology V2 (c)";
 const char* Version_3  = "Open CASCADE Topology V3 (c)";
+const char* Version_4  = "Open CASCADE Topology V4 (c)";
 //=======================================================================
 //function : operator << (gp_Pnt)
 //purpose  : 
@@ -69,13 +75,570 @@ static Standard_OStream& operator <<(Standard_OStream& OS, const gp_Pnt P)
   BinTools::PutReal(OS, P.Z());
   return OS;
 }
+
+namespace
+{
+  //! Number of geometry sections of format 4; the order of sections is
+  //! 2D curves, 3D curves, 3D polygons, polygons on triangulation,
+  //! surfaces and triangulations.
+  static const Standard_Integer THE_NB_SECTIONS = 6;
+
+  //! Layouts of triangulation record in format 4.
+  enum
+  {
+    THE_LAYOUT_PLAIN = 0, //!< same as in previous formats
+    THE_LAYOUT_DELTA = 1  //!< planar delta encoding, to be compressed
+  };
+
+  //! Writes block of bytes prefixed by its original and stored size.
+  static void putBlock (Standard_OStream&       OS,
+                        const std::string&      theData,
+                        const Standard_Integer  theRawSize)
+  {
+    BinTools::PutInteger (OS, theRawSize);
+    BinTools::PutInteger (OS, (Standard_Integer )theData.size());
+    OS.write (theData.data(), theData.size());
+  }
+
+  //! Reads block written by putBlock(), without unpacking it.
+  static void getBlock (Standard_IStream&  IS,
+                        std::string&       theData,
+                        Standard_Integer&  theRawSize)
+  {
+    Standard_Integer aSize = 0;
+    BinTools::GetInteger (IS, theRawSize);
+    BinTools::GetInteger (IS, aSize);
+    if (theRawSize < 0 || aSize < 0 || aSize > theRawSize)
+    {
+      throw Standard_Failure ("BinTools_ShapeSet: Invalid size of geometry section");
+    }
+    theData.resize (aSize);
+    if (aSize != 0
+    && !IS.read (&theData[0], aSize))
+    {
+      throw Storage_StreamTypeMismatchError();
+    }
+  }
+
+  //! Compresses the data if requested and worth it; returns the original size.
+  //! Sizes of blocks are written as 32-bit integers, thus larger blocks are rejected.
+  static Standard_Integer packBlock (std::string&           theData,
+                                     const Standard_Boolean theToCompress)
+  {
+    if (theData.size() > (Standard_Size )IntegerLast())
+    {
+      throw Standard_Failure ("BinTools_ShapeSet: Geometry section exceeds the size limit of format 4 (2 GB)");
+    }
+    const Standard_Integer aRawSize = (Standard_Integer )theData.size();
+    std::string aPacked;
+    if (theToCompress
+     && BinTools_LZCodec::Compress (theData, aPacked))
+    {
+      theData.swap (aPacked);
+    }
+    return aRawSize;
+  }
+
+  //! Decompresses the data read by getBlock() if it was packed.
+  static void unpackBlock (std::string&           theData,
+                           const Standard_Integer theRawSize)
+  {
+    if ((Standard_Integer )theData.size() == theRawSize)
+    {
+      return;
+    }
+
+    std::string aRaw;
+    if (!BinTools_LZCodec::Decompress (theData, theRawSize, aRaw))
+    {
+      throw Standard_Failure ("BinTools_ShapeSet: Corrupted compressed geometry section");
+    }
+    theData.swap (aRaw);
+  }
+
+  //! Raises the first error reported by parallel workers, if any.
+  static void raiseFirstError (const NCollection_Array1<TCollection_AsciiString>& theErrors)
+  {
+    for (NCollection_Array1<TCollection_AsciiString>::Iterator anIter (theErrors); anIter.More(); anIter.Next())
+    {
+      if (!anIter.Value().IsEmpty())
+      {
+        throw Standard_Failure (anIter.Value().ToCString());
+      }
+    }
+  }
+
+  //! Writes the triangulation as in formats 1-3.
+  static void writeTriangulationPlain (Standard_OStream& OS,
+                                       const Handle(Poly_Triangulation)& T)
+  {
+    Standard_Integer j, n1, n2, n3;
+    BinTools::PutInteger(OS, T->NbNodes());
+    BinTools::PutInteger(OS, T->NbTriangles());
+    BinTools::PutBool(OS, T->HasUVNodes()? 1:0);
+    // write the deflection
+    BinTools::PutReal(OS, T->Deflection());
+
+    // write the 3d nodes
+    const Standard_Integer nbNodes = T->NbNodes();
+    const TColgp_Array1OfPnt& Nodes = T->Nodes();
+    for (j = 1; j <= nbNodes; j++) {
+      BinTools::PutReal(OS, Nodes(j).X());
+      BinTools::PutReal(OS, Nodes(j).Y());
+      BinTools::PutReal(OS, Nodes(j).Z());
+    }
+
+    if (T->HasUVNodes()) {
+      const TColgp_Array1OfPnt2d& UVNodes = T->UVNodes();
+      for (j = 1; j <= nbNodes; j++) {
+        BinTools::PutReal(OS, UVNodes(j).X());
+        BinTools::PutReal(OS, UVNodes(j).Y());
+      }
+    }
+    const Standard_Integer nbTriangles = T->NbTriangles();
+    const Poly_Array1OfTriangle& Triangles = T->Triangles();
+    for (j = 1; j <= nbTriangles; j++) {
+      Triangles(j).Get(n1, n2, n3);
+      BinTools::PutInteger(OS, n1);
+      BinTools::PutInteger(OS, n2);
+      BinTools::PutInteger(OS, n3);
+    }
+  }
+
+  //! Reads the triangulation written by writeTriangulationPlain().
+  static Handle(Poly_Triangulation) readTriangulationPlain (Standard_IStream& IS)
+  {
+    Standard_Integer j, nbNodes = 0, nbTriangles = 0;
+    Standard_Boolean hasUV = Standard_False;
+    Standard_Real d, x, y, z;
+    BinTools::GetInteger(IS, nbNodes);
+    BinTools::GetInteger(IS, nbTriangles);
+    BinTools::GetBool(IS, hasUV);
+    BinTools::GetReal(IS, d); //deflection
+
+    Handle(Poly_Triangulation) T = new Poly_Triangulation (nbNodes, nbTriangles, hasUV);
+    TColgp_Array1OfPnt& Nodes = T->ChangeNodes();
+    for (j = 1; j <= nbNodes; j++) {
+      BinTools::GetReal(IS, x);
+      BinTools::GetReal(IS, y);
+      BinTools::GetReal(IS, z);
+      Nodes(j).SetCoord(x,y,z);
+    }
+
+    if (hasUV) {
+      TColgp_Array1OfPnt2d& UVNodes = T->ChangeUVNodes();
+      for (j = 1; j <= nbNodes; j++) {
+        BinTools::GetReal(IS, x);
+        BinTools::GetReal(IS, y);
+        UVNodes(j).SetCoord(x,y);
+      }
+    }
+
+    // read the triangles
+    Standard_Integer n1,n2,n3;
+    Poly_Array1OfTriangle& Triangles = T->ChangeTriangles();
+    for (j = 1; j <= nbTriangles; j++) {
+      BinTools::GetInteger(IS, n1);
+      BinTools::GetInteger(IS, n2);
+      BinTools::GetInteger(IS, n3);
+      Triangles(j).Set(n1,n2,n3);
+    }
+    T->Deflection(d);
+    return T;
+  }
+
+  //! Appends 32-bit value, most significant byte first.
+  inline void putUInt32 (std::string& theData, const uint32_t theValue)
+  {
+    for (Standard_Integer aShift = 24; aShift >= 0; aShift -= 8)
+    {
+      theData.push_back ((char )((theValue >> aShift) & 0xFF));
+    }
+  }
+
+  //! Appends bits of real value, most significant byte first.
+  inline void putBits (std::string& theData, const uint64_t theValue)
+  {
+    for (Standard_Integer aShift = 56; aShift >= 0; aShift -= 8)
+    {
+      theData.push_back ((char )((theValue >> aShift) & 0xFF));
+    }
+  }
+
+  //! Appends unsigned value as a sequence of 7-bit groups.
+  inline void putVarUInt (std::string& theData, uint32_t theValue)
+  {
+    for (; theValue >= 0x80; theValue >>= 7)
+    {
+      theData.push_back ((char )((theValue & 0x7F) | 0x80));
+    }
+    theData.push_back ((char )theValue);
+  }
+
+  inline uint64_t realToBits (const Standard_Real theValue)
+  {
+    uint64_t aBits;
+    memcpy (&aBits, &theValue, sizeof(aBits));
+    return aBits;
+  }
+
+  inline Standard_Real bitsToReal (const uint64_t theBits)
+  {
+    Standard_Real aValue;
+    memcpy (&aValue, &theBits, sizeof(aValue));
+    return aValue;
+  }
+
+  //! Sequential reader of the delta-encoded triangulation record.
+  class DeltaReader
+  {
+  public:
+    DeltaReader (const std::string& theData, const Standard_Size theOffset)
+    : myData ((const unsigned char* )theData.data()),
+      mySize (theData.size()),
+      myPos  (theOffset) {}
+
+    Standard_Boolean GetByte()
+    {
+      check (1);
+      return myData[myPos++] != 0;
+    }
+
+    uint32_t GetUInt32()
+    {
+      check (4);
+      uint32_t aValue = 0;
+      for (Standard_Integer anIter = 0; anIter < 4; ++anIter)
+      {
+        aValue = (aValue << 8) | myData[myPos++];
+      }
+      return aValue;
+    }
+
+    uint64_t GetBits()
+    {
+      check (8);
+      uint64_t aValue = 0;
+      for (Standard_Integer anIter = 0; anIter < 8; ++anIter)
+      {
+        aValue = (aValue << 8) | myData[myPos++];
+      }
+      return aValue;
+    }
+
+    uint32_t GetVarUInt()
+    {
+      uint32_t aValue = 0;
+      for (Standard_Integer aShift = 0; aShift < 35; aShift += 7)
+      {
+        check (1);
+        const unsigned char aByte = myData[myPos++];
+        aValue |= (uint32_t )(aByte & 0x7F) << aShift;
+        if ((aByte & 0x80) == 0)
+        {
+          return aValue;
+        }
+      }
+      throw Storage_StreamTypeMismatchError();
+    }
+
+  private:
+    void check (const Standard_Size theNbBytes) const
+    {
+      if (mySize - myPos < theNbBytes)
+      {
+        throw Storage_StreamTypeMismatchError();
+      }
+    }
+
+  private:
+    const unsigned char* myData;
+    Standard_Size        mySize;
+    Standard_Size        myPos;
+  };
+
+  //! Writes the triangulation with coordinates stored per component as XOR
+  //! with the previous value and triangle indices as zigzag varint deltas,
+  //! which makes the record well compressible by BinTools_LZCodec.
+  static void writeTriangulationDelta (std::string& theData,
+                                       const Handle(Poly_Triangulation)& T)
+  {
+    const Standard_Integer aNbNodes = T->NbNodes();
+    const Standard_Integer aNbTris  = T->NbTriangles();
+    putUInt32 (theData, (uint32_t )aNbNodes);
+    putUInt32 (theData, (uint32_t )aNbTris);
+    theData.push_back (T->HasUVNodes() ? 1 : 0);
+    putBits (theData, realToBits (T->Deflection()));
+    theData.reserve (theData.size() + aNbNodes * (T->HasUVNodes() ? 40 : 24) + aNbTris * 6);
+
+    const TColgp_Array1OfPnt& aNodes = T->Nodes();
+    for (Standard_Integer aCoord = 1; aCoord <= 3; ++aCoord)
+    {
+      uint64_t aPrev = 0;
+      for (Standard_Integer aNodeIter = aNodes.Lower(); aNodeIter <= aNodes.Upper(); ++aNodeIter)
+      {
+        const uint64_t aBits = realToBits (aNodes (aNodeIter).Coord (aCoord));
+        putBits (theData, aBits ^ aPrev);
+        aPrev = aBits;
+      }
+    }
+    if (T->HasUVNodes())
+    {
+      const TColgp_Array1OfPnt2d& aUVNodes = T->UVNodes();
+      for (Standard_Integer aCoord = 1; aCoord <= 2; ++aCoord)
+      {
+        uint64_t aPrev = 0;
+        for (Standard_Integer aNodeIter = aUVNodes.Lower(); aNodeIter <= aUVNodes.Upper(); ++aNodeIter)
+        {
+          const uint64_t aBits = realToBits (aUVNodes (aNodeIter).Coord (aCoord));
+          putBits (theData, aBits ^ aPrev);
+          aPrev = aBits;
+        }
+      }
+    }
+
+    const Poly_Array1OfTriangle& aTriangles = T->Triangles();
+    for (Standard_Integer aCorner = 1; aCorner <= 3; ++aCorner)
+    {
+      Standard_Integer aPrev = 0;
+      for (Standard_Integer aTriIter = aTriangles.Lower(); aTriIter <= aTriangles.Upper(); ++aTriIter)
+      {
+        const Standard_Integer aNode  = aTriangles (aTriIter).Value (aCorner);
+        const int32_t          aDelta = (int32_t )((uint32_t )aNode - (uint32_t )aPrev);
+        putVarUInt (theData, ((uint32_t )aDelta << 1) ^ (uint32_t )(aDelta >> 31));
+        aPrev = aNode;
+      }
+    }
+  }
+
+  //! Reads the triangulation written by writeTriangulationDelta().
+  static Handle(Poly_Triangulation) readTriangulationDelta (const std::string& theData,
+                                                            const Standard_Size theOffset)
+  {
+    DeltaReader aReader (theData, theOffset);
+    const Standard_Integer aNbNodes = (Standard_Integer )aReader.GetUInt32();
+    const Standard_Integer aNbTris  = (Standard_Integer )aReader.GetUInt32();
+    const Standard_Boolean hasUV    = aReader.GetByte();
+    const Standard_Real    aDefl    = bitsToReal (aReader.GetBits());
+    if (aNbNodes < 0 || aNbTris < 0)
+    {
+      throw Storage_StreamTypeMismatchError();
+    }
+
+    Handle(Poly_Triangulation) T = new Poly_Triangulation (aNbNodes, aNbTris, hasUV);
+    TColgp_Array1OfPnt& aNodes = T->ChangeNodes();
+    for (Standard_Integer aCoord = 1; aCoord <= 3; ++aCoord)
+    {
+      uint64_t aBits = 0;
+      for (Standard_Integer aNodeIter = aNodes.Lower(); aNodeIter <= aNodes.Upper(); ++aNodeIter)
+      {
+        aBits ^= aReader.GetBits();
+        aNodes.ChangeValue (aNodeIter).SetCoord (aCoord, bitsToReal (aBits));
+      }
+    }
+    if (hasUV)
+    {
+      TColgp_Array1OfPnt2d& aUVNodes = T->ChangeUVNodes();
+      for (Standard_Integer aCoord = 1; aCoord <= 2; ++aCoord)
+      {
+        uint64_t aBits = 0;
+        for (Standard_Integer aNodeIter = aUVNodes.Lower(); aNodeIter <= aUVNodes.Upper(); ++aNodeIter)
+        {
+          aBits ^= aReader.GetBits();
+          aUVNodes.ChangeValue (aNodeIter).SetCoord (aCoord, bitsToReal (aBits));
+        }
+      }
+    }
+
+    Poly_Array1OfTriangle& aTriangles = T->ChangeTriangles();
+    for (Standard_Integer aCorner = 1; aCorner <= 3; ++aCorner)
+    {
+      uint32_t aNode = 0;
+      for (Standard_Integer aTriIter = aTriangles.Lower(); aTriIter <= aTriangles.Upper(); ++aTriIter)
+      {
+        const uint32_t aZigZag = aReader.GetVarUInt();
+        aNode += (aZigZag >> 1) ^ (0U - (aZigZag & 1));
+        aTriangles.ChangeValue (aTriIter).ChangeValue (aCorner) = (Standard_Integer )aNode;
+      }
+    }
+    T->Deflection (aDefl);
+    return T;
+  }
+
+  //! Functor encoding triangulations of format 4 into separate blocks.
+  class TriangulationEncoder
+  {
+  public:
+    TriangulationEncoder (const TColStd_IndexedMapOfTransient&         theTriangulations,
+                          const Standard_Boolean                       theToCompress,
+                          NCollection_Array1<std::string>&             theData,
+                          NCollection_Array1<Standard_Integer>&        theRawSizes,
+                          NCollection_Array1<TCollection_AsciiString>& theErrors)
+    : myTriangulations (theTriangulations),
+      myToCompress (theToCompress),
+      myData (theData),
+      myRawSizes (theRawSizes),
+      myErrors (theErrors) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        const Handle(Poly_Triangulation) T = Handle(Poly_Triangulation)::DownCast (myTriangulations (theIndex));
+        std::string& aData = myData.ChangeValue (theIndex);
+        if (myToCompress)
+        {
+          aData.push_back ((char )THE_LAYOUT_DELTA);
+          writeTriangulationDelta (aData, T);
+        }
+        else
+        {
+          Standard_SStream aStream;
+          aStream.put ((char )THE_LAYOUT_PLAIN);
+          writeTriangulationPlain (aStream, T);
+          aData = aStream.str();
+        }
+        myRawSizes.ChangeValue (theIndex) = packBlock (aData, myToCompress);
+      }
+      catch (Standard_Failure const& anException)
+      {
+        myErrors.ChangeValue (theIndex) = TCollection_AsciiString ("EXCEPTION in BinTools_ShapeSet::WriteTriangulation(..): ")
+                                        + anException.GetMessageString();
+      }
+    }
+
+  private:
+    TriangulationEncoder& operator= (const TriangulationEncoder& );
+
+  private:
+    const TColStd_IndexedMapOfTransient&         myTriangulations;
+    Standard_Boolean                             myToCompress;
+    NCollection_Array1<std::string>&             myData;
+    NCollection_Array1<Standard_Integer>&        myRawSizes;
+    NCollection_Array1<TCollection_AsciiString>& myErrors;
+  };
+
+  //! Functor decoding triangulation blocks of format 4.
+  class TriangulationDecoder
+  {
+  public:
+    TriangulationDecoder (NCollection_Array1<std::string>&                  theData,
+                          const NCollection_Array1<Standard_Integer>&       theRawSizes,
+                          NCollection_Array1<Handle(Poly_Triangulation)>&   theResult,
+                          NCollection_Array1<TCollection_AsciiString>&      theErrors)
+    : myData (theData),
+      myRawSizes (theRawSizes),
+      myResult (theResult),
+      myErrors (theErrors) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        std::string& aData = myData.ChangeValue (theIndex);
+        unpackBlock (aData, myRawSizes (theIndex));
+        if (aData.empty())
+        {
+          throw Storage_StreamTypeMismatchError();
+        }
+
+        if (aData[0] == (char )THE_LAYOUT_DELTA)
+        {
+          myResult.ChangeValue (theIndex) = readTriangulationDelta (aData, 1);
+        }
+        else
+        {
+          Standard_SStream aStream (aData);
+          aStream.get();
+          myResult.ChangeValue (theIndex) = readTriangulationPlain (aStream);
+        }
+        // release the memory as soon as possible
+        std::string().swap (aData);
+      }
+      catch (Standard_Failure const& anException)
+      {
+        myErrors.ChangeValue (theIndex) = TCollection_AsciiString ("EXCEPTION in BinTools_ShapeSet::ReadTriangulation(..): ")
+                                        + anException.GetMessageString();
+      }
+    }
+
+  private:
+    TriangulationDecoder& operator= (const TriangulationDecoder& );
+
+  private:
+    NCollection_Array1<std::string>&                myData;
+    const NCollection_Array1<Standard_Integer>&     myRawSizes;
+    NCollection_Array1<Handle(Poly_Triangulation)>& myResult;
+    NCollection_Array1<TCollection_AsciiString>&    myErrors;
+  };
+}
+
+//! Functor encoding or decoding the geometry sections of format 4.
+class BinTools_ShapeSet::SectionFunctor
+{
+public:
+
+  //! Constructor for writing.
+  SectionFunctor (const BinTools_ShapeSet&                     theSet,
+                  NCollection_Array1<std::string>&             theData,
+                  NCollection_Array1<TCollection_AsciiString>& theErrors)
+  : myWriter (&theSet),
+    myReader (NULL),
+    myData (theData),
+    myErrors (theErrors) {}
+
+  //! Constructor for reading.
+  SectionFunctor (BinTools_ShapeSet&                           theSet,
+                  NCollection_Array1<std::string>&             theData,
+                  NCollection_Array1<TCollection_AsciiString>& theErrors)
+  : myWriter (NULL),
+    myReader (&theSet),
+    myData (theData),
+    myErrors (theErrors) {}
+
+  void operator() (const Standard_Integer theSection) const
+  {
+    try
+    {
+      OCC_CATCH_SIGNALS
+      std::string& aData = myData.ChangeValue (theSection);
+      if (myWriter != NULL)
+      {
+        Standard_SStream aStream;
+        myWriter->writeSection (theSection, aStream);
+        aData = aStream.str();
+      }
+      else
+      {
+        Standard_SStream aStream (aData);
+        myReader->readSection (theSection, aStream);
+        std::string().swap (aData);
+      }
+    }
+    catch (Standard_Failure const& anException)
+    {
+      myErrors.ChangeValue (theSection) = anException.GetMessageString();
+    }
+  }
+
+private:
+  SectionFunctor& operator= (const SectionFunctor& );
+
+private:
+  const BinTools_ShapeSet*                     myWriter;
+  BinTools_ShapeSet*                           myReader;
+  NCollection_Array1<std::string>&             myData;
+  NCollection_Array1<TCollection_AsciiString>& myErrors;
+};
 //=======================================================================
 //function : BinTools_ShapeSet
 //purpose  : 
 //=======================================================================
 
 BinTools_ShapeSet::BinTools_ShapeSet(const Standard_Boolean isWithTriangles)
-     :myFormatNb(3), myWithTriangles(isWithTriangles)
+     :myFormatNb(3), myWithTriangles(isWithTriangles), myWithCompression(Standard_False)
 {}
 
 //=======================================================================
@@ -296,12 +859,77 @@ void BinTools_ShapeSet::AddGeometry(const TopoDS_Shape& S)
 
 void  BinTools_ShapeSet::WriteGeometry(Standard_OStream& OS)const 
 {
-  myCurves2d.Write(OS); 
-  myCurves.Write(OS);
-  WritePolygon3D(OS);
-  WritePolygonOnTriangulation(OS);
-  mySurfaces.Write(OS);
-  WriteTriangulation(OS);
+  if (myFormatNb < 4)
+  {
+    myCurves2d.Write(OS); 
+    myCurves.Write(OS);
+    WritePolygon3D(OS);
+    WritePolygonOnTriangulation(OS);
+    mySurfaces.Write(OS);
+    WriteTriangulation(OS);
+    return;
+  }
+
+  // sections are encoded independently and written with their sizes;
+  // triangulations are encoded in parallel within their own section
+  const Standard_Integer aTriSection = THE_NB_SECTIONS - 1;
+  NCollection_Array1<std::string> aData (0, aTriSection);
+  NCollection_Array1<TCollection_AsciiString> anErrors (0, aTriSection);
+  SectionFunctor aFunctor (*this, aData, anErrors);
+  OSD_Parallel::For (0, aTriSection, aFunctor);
+  raiseFirstError (anErrors);
+  {
+    Standard_SStream aStream;
+    WriteTriangulation (aStream);
+    aData (aTriSection) = aStream.str();
+  }
+
+  OS << "Sections " << THE_NB_SECTIONS << "\n";
+  for (Standard_Integer aSection = 0; aSection < THE_NB_SECTIONS; ++aSection)
+  {
+    // polygons are compressed as a whole, triangulations item by item
+    const Standard_Boolean toCompress = myWithCompression && (aSection == 2 || aSection == 3);
+    const Standard_Integer aRawSize = packBlock (aData (aSection), toCompress);
+    putBlock (OS, aData (aSection), aRawSize);
+  }
+}
+
+//=======================================================================
+//function : writeSection
+//purpose  : 
+//=======================================================================
+
+void BinTools_ShapeSet::writeSection (const Standard_Integer theSection,
+                                      Standard_OStream& OS) const
+{
+  switch (theSection)
+  {
+    case 0: myCurves2d.Write(OS); break;
+    case 1: myCurves.Write(OS); break;
+    case 2: WritePolygon3D(OS); break;
+    case 3: WritePolygonOnTriangulation(OS); break;
+    case 4: mySurfaces.Write(OS); break;
+    default: WriteTriangulation(OS); break;
+  }
+}
+
+//=======================================================================
+//function : readSection
+//purpose  : 
+//=======================================================================
+
+void BinTools_ShapeSet::readSection (const Standard_Integer theSection,
+                                     Standard_IStream& IS)
+{
+  switch (theSection)
+  {
+    case 0: myCurves2d.Read(IS); break;
+    case 1: myCurves.Read(IS); break;
+    case 2: ReadPolygon3D(IS); break;
+    case 3: ReadPolygonOnTriangulation(IS); break;
+    case 4: mySurfaces.Read(IS); break;
+    default: ReadTriangulation(IS); break;
+  }
 }
 
 //=======================================================================
@@ -313,7 +941,9 @@ void  BinTools_ShapeSet::Write(Standard_OStream& OS)const
 {
 
   // write the copyright
-  if (myFormatNb == 3)
+  if (myFormatNb == 4)
+    OS << "\n" << Version_4 << "\n";
+  else if (myFormatNb == 3)
     OS << "\n" << Version_3 << "\n";
   else if (myFormatNb == 2)
     OS << "\n" << Version_2 << "\n";
@@ -395,13 +1025,14 @@ void  BinTools_ShapeSet::Read(Standard_IStream& IS)
     }
     
   } while ( ! IS.fail() && strcmp(vers,Version_1) && strcmp(vers,Version_2) &&
-	   strcmp(vers,Version_3));
+	   strcmp(vers,Version_3) && strcmp(vers,Version_4));
   if (IS.fail()) {
     cout << "BinTools_ShapeSet::Read: File was not written with this version of the topology"<<endl;
      return;
   }
 
-  if (strcmp(vers,Version_3) == 0) SetFormatNb(3);
+  if (strcmp(vers,Version_4) == 0) SetFormatNb(4);
+  else if (strcmp(vers,Version_3) == 0) SetFormatNb(3);
   else  if (strcmp(vers,Version_2) == 0) SetFormatNb(2);    
   else SetFormatNb(1);
 
@@ -533,12 +1164,42 @@ void  BinTools_ShapeSet::Read(TopoDS_Shape& S, Standard_IStream& IS,
 
 void  BinTools_ShapeSet::ReadGeometry(Standard_IStream& IS)
 {
-  myCurves2d.Read(IS);
-  myCurves.Read(IS);
-  ReadPolygon3D(IS);
-  ReadPolygonOnTriangulation(IS);
-  mySurfaces.Read(IS);
-  ReadTriangulation(IS);
+  if (myFormatNb < 4)
+  {
+    myCurves2d.Read(IS);
+    myCurves.Read(IS);
+    ReadPolygon3D(IS);
+    ReadPolygonOnTriangulation(IS);
+    mySurfaces.Read(IS);
+    ReadTriangulation(IS);
+    return;
+  }
+
+  char buffer[255];
+  Standard_Integer aNbSections = 0;
+  IS >> buffer >> aNbSections;
+  if (IS.fail() || strcmp(buffer,"Sections") || aNbSections != THE_NB_SECTIONS) {
+    throw Standard_Failure("BinTools_ShapeSet::ReadGeometry: Not a geometry section");
+  }
+  IS.get();// remove LF
+
+  // read all sections at once, then decode them concurrently
+  const Standard_Integer aTriSection = THE_NB_SECTIONS - 1;
+  NCollection_Array1<std::string> aData (0, aTriSection);
+  NCollection_Array1<TCollection_AsciiString> anErrors (0, aTriSection);
+  for (Standard_Integer aSection = 0; aSection < THE_NB_SECTIONS; ++aSection)
+  {
+    Standard_Integer aRawSize = 0;
+    getBlock (IS, aData (aSection), aRawSize);
+    unpackBlock (aData (aSection), aRawSize);
+  }
+
+  SectionFunctor aFunctor (*this, aData, anErrors);
+  OSD_Parallel::For (0, aTriSection, aFunctor);
+  raiseFirstError (anErrors);
+
+  Standard_SStream aStream (aData (aTriSection));
+  ReadTriangulation (aStream);
 }
 
 //=======================================================================
@@ -1385,44 +2046,29 @@ void BinTools_ShapeSet::ReadPolygon3D(Standard_IStream& IS)
 
 void BinTools_ShapeSet::WriteTriangulation(Standard_OStream& OS) const
 {
-  Standard_Integer i, j, nbNodes, nbtri = myTriangulations.Extent();
-  Standard_Integer nbTriangles = 0, n1, n2, n3;
+  Standard_Integer i, nbtri = myTriangulations.Extent();
     OS << "Triangulations " << nbtri << "\n";
-  Handle(Poly_Triangulation) T;
+  if (myFormatNb >= 4)
+  {
+    // each triangulation is encoded into a separate block
+    if (nbtri == 0)
+      return;
+
+    NCollection_Array1<std::string> aData (1, nbtri);
+    NCollection_Array1<Standard_Integer> aRawSizes (1, nbtri);
+    NCollection_Array1<TCollection_AsciiString> anErrors (1, nbtri);
+    TriangulationEncoder anEncoder (myTriangulations, myWithCompression, aData, aRawSizes, anErrors);
+    OSD_Parallel::For (1, nbtri + 1, anEncoder);
+    raiseFirstError (anErrors);
+    for (i = 1; i <= nbtri; i++)
+      putBlock (OS, aData (i), aRawSizes (i));
+    return;
+  }
+
   try {
     OCC_CATCH_SIGNALS
     for (i = 1; i <= nbtri; i++) {
-      T = Handle(Poly_Triangulation)::DownCast(myTriangulations(i));
-      BinTools::PutInteger(OS, T->NbNodes());
-      BinTools::PutInteger(OS, T->NbTriangles());
-      BinTools::PutBool(OS, T->HasUVNodes()? 1:0);
-    // write the deflection
-      BinTools::PutReal(OS, T->Deflection());
-
-    // write the 3d nodes
-      nbNodes = T->NbNodes();
-      const TColgp_Array1OfPnt& Nodes = T->Nodes();
-      for (j = 1; j <= nbNodes; j++) {
-	BinTools::PutReal(OS, Nodes(j).X());
-	BinTools::PutReal(OS, Nodes(j).Y());
-	BinTools::PutReal(OS, Nodes(j).Z());
-      }
-    
-      if (T->HasUVNodes()) {
-	const TColgp_Array1OfPnt2d& UVNodes = T->UVNodes();
-	for (j = 1; j <= nbNodes; j++) {
-	  BinTools::PutReal(OS, UVNodes(j).X());
-	  BinTools::PutReal(OS, UVNodes(j).Y());
-	}
-      }
-      nbTriangles = T->NbTriangles();
-      const Poly_Array1OfTriangle& Triangles = T->Triangles();
-      for (j = 1; j <= nbTriangles; j++) {
-	Triangles(j).Get(n1, n2, n3);
-	BinTools::PutInteger(OS, n1);
-	BinTools::PutInteger(OS, n2);
-	BinTools::PutInteger(OS, n3);
-      }
+      writeTriangulationPlain (OS, Handle(Poly_Triangulation)::DownCast(myTriangulations(i)));
     }
   }
   catch(Standard_Failure const& anException) {
@@ -1441,12 +2087,8 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream& OS) const
 void BinTools_ShapeSet::ReadTriangulation(Standard_IStream& IS)
 {
   char buffer[255];
-  Standard_Integer i, j, nbtri =0;
-  Standard_Real d, x, y, z;
-  Standard_Integer nbNodes =0, nbTriangles=0;
-  Standard_Boolean hasUV = Standard_False;
+  Standard_Integer i, nbtri =0;
 
-  Handle(Poly_Triangulation) T;
   IS >> buffer;
 
   if (IS.fail() || (strstr(buffer,"Triangulations") == NULL)) {
@@ -1455,44 +2097,30 @@ void BinTools_ShapeSet::ReadTriangulation(Standard_IStream& IS)
   IS >> nbtri;
   IS.get();// remove LF 
 
+  if (myFormatNb >= 4)
+  {
+    if (nbtri <= 0)
+      return;
+
+    NCollection_Array1<std::string> aData (1, nbtri);
+    NCollection_Array1<Standard_Integer> aRawSizes (1, nbtri);
+    NCollection_Array1<TCollection_AsciiString> anErrors (1, nbtri);
+    NCollection_Array1<Handle(Poly_Triangulation)> aResult (1, nbtri);
+    for (i = 1; i <= nbtri; i++)
+      getBlock (IS, aData (i), aRawSizes (i));
+
+    TriangulationDecoder aDecoder (aData, aRawSizes, aResult, anErrors);
+    OSD_Parallel::For (1, nbtri + 1, aDecoder);
+    raiseFirstError (anErrors);
+    for (i = 1; i <= nbtri; i++)
+      myTriangulations.Add (aResult (i));
+    return;
+  }
+
   try {
     OCC_CATCH_SIGNALS
     for (i=1; i<=nbtri; i++) {
-      BinTools::GetInteger(IS, nbNodes);
-      BinTools::GetInteger(IS, nbTriangles);
-      TColgp_Array1OfPnt Nodes(1, nbNodes);
-      BinTools::GetBool(IS, hasUV);
-      TColgp_Array1OfPnt2d UVNodes(1, nbNodes);
-      BinTools::GetReal(IS, d); //deflection
-      for (j = 1; j <= nbNodes; j++) {
-	BinTools::GetReal(IS, x);
-	BinTools::GetReal(IS, y);
-	BinTools::GetReal(IS, z);
-	Nodes(j).SetCoord(x,y,z);
-      }
-      
-      if (hasUV) {
-	for (j = 1; j <= nbNodes; j++) {
-	  BinTools::GetReal(IS, x);
-	  BinTools::GetReal(IS, y);
-	  UVNodes(j).SetCoord(x,y);
-	}
-      }
-      
-      // read the triangles
-      Standard_Integer n1,n2,n3;
-      Poly_Array1OfTriangle Triangles(1, nbTriangles);
-      for (j = 1; j <= nbTriangles; j++) {
-	BinTools::GetInteger(IS, n1);
-	BinTools::GetInteger(IS, n2);
-	BinTools::GetInteger(IS, n3);
-	Triangles(j).Set(n1,n2,n3);
-      }
-      
-      if (hasUV) T =  new Poly_Triangulation(Nodes,UVNodes,Triangles);
-      else T = new Poly_Triangulation(Nodes,Triangles);      
-      T->Deflection(d);      
-      myTriangulations.Add(T);
+      myTriangulations.Add (readTriangulationPlain (IS));
     }
   }
   catch(Standard_Failure const& anException) {
@@ -57,12 +57,24 @@ public:
   //! Ignored (always written) if face defines only triangulation (no surface).
   void SetWithTriangles (const Standard_Boolean isWithTriangles) { myWithTriangles = isWithTriangles; }
 
+  //! Return true if triangulations and polygons should be compressed.
+  Standard_Boolean IsWithCompression() const { return myWithCompression; }
+
+  //! Define if triangulations and polygons will be stored compressed
+  //! (delta encoding followed by BinTools_LZCodec).
+  //! Taken into account only by format version 4; reading detects compression automatically.
+  void SetWithCompression (const Standard_Boolean isWithCompression) { myWithCompression = isWithCompression; }
+
   Standard_EXPORT void SetFormatNb (const Standard_Integer theFormatNb);
   
-  //! two formats available for the moment:
+  //! four formats available for the moment:
   //! First: does not write CurveOnSurface UV Points into the file
   //! on reading calls Check() method.
   //! Second: stores CurveOnSurface UV Points.
+  //! Third: stores the flags of edge polygons on triangulation.
+  //! Fourth: stores the geometry in sections prefixed by their size,
+  //! which are encoded and decoded in parallel, with optional compression
+  //! of triangulations and polygons (see SetWithCompression()).
   //! On reading format is recognized from Version string.
   Standard_EXPORT Standard_Integer FormatNb() const;
   
@@ -182,7 +194,14 @@ protected:
 
 private:
 
+  //! Functor encoding or decoding the geometry sections of format 4.
+  class SectionFunctor;
+
+  //! Writes the geometry section of index <theSection> (format 4).
+  void writeSection (const Standard_Integer theSection, Standard_OStream& OS) const;
 
+  //! Reads the geometry section of index <theSection> (format 4).
+  void readSection (const Standard_Integer theSection, Standard_IStream& IS);
 
   TopTools_IndexedMapOfShape myShapes;
   BinTools_LocationSet myLocations;
@@ -196,6 +215,7 @@ private:
   TColStd_IndexedMapOfTransient myTriangulations;
   TColStd_IndexedMapOfTransient myNodes;
   Standard_Boolean myWithTriangles;
+  Standard_Boolean myWithCompression;
 
 
 };
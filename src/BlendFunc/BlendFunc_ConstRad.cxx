@@ -67,6 +67,8 @@ BlendFunc_ConstRad::BlendFunc_ConstRad(const Handle(Adaptor3d_HSurface)& S1,
   xval.Init(-9.876e100);
   myXOrder = -1;
   myTOrder = -1;
+  invnormtg  = 0.;
+  dinvnormtg = 0.;
 }
 
 //=======================================================================
@@ -147,12 +149,6 @@ Standard_Boolean BlendFunc_ConstRad::ComputeValues(const math_Vector& X,
                                                    const Standard_Boolean byParam,
                                                    const Standard_Real Param)
 {
- // static declaration to avoid systematic reallocation
- 
- static gp_Vec d3u1,d3v1,d3uuv1,d3uvv1,d3u2,d3v2,d3uuv2,d3uvv2; 
- static gp_Vec d1gui, d2gui, d3gui;
- static gp_Pnt ptgui;
- static Standard_Real invnormtg, dinvnormtg;
  Standard_Real T =  Param, aux;
 
  // Case of implicite parameter
@@ -127,7 +127,9 @@ BlendFunc_EvolRad::BlendFunc_EvolRad(const Handle(Adaptor3d_HSurface)& S1,
   tval = -9.876e100;
   xval.Init(-9.876e100);
   myXOrder = -1;
-  myTOrder = -1;  
+  myTOrder = -1;
+  invnormtg  = 0.;
+  dinvnormtg = 0.;
 }
 
 //=======================================================================
@@ -208,12 +210,6 @@ Standard_Boolean BlendFunc_EvolRad::ComputeValues(const math_Vector& X,
 						   const Standard_Boolean byParam,
 						   const Standard_Real Param)
 {
- // static declaration to avoid systematic realloc 
- 
- static gp_Vec d3u1,d3v1,d3uuv1,d3uvv1,d3u2,d3v2,d3uuv2,d3uvv2; 
- static gp_Vec d1gui, d2gui, d3gui;
- static gp_Pnt ptgui;
- static Standard_Real invnormtg, dinvnormtg;
  Standard_Real T =  Param, aux;
 
  // Case of implicit parameter
@@ -251,6 +251,20 @@ private:
   gp_Vec d2ndtu2;
   gp_Vec d2ndtv1;
   gp_Vec d2ndtv2;
+  gp_Vec d3u1;
+  gp_Vec d3v1;
+  gp_Vec d3uuv1;
+  gp_Vec d3uvv1;
+  gp_Vec d3u2;
+  gp_Vec d3v2;
+  gp_Vec d3uuv2;
+  gp_Vec d3uvv2;
+  gp_Pnt ptgui;
+  gp_Vec d1gui;
+  gp_Vec d2gui;
+  gp_Vec d3gui;
+  Standard_Real invnormtg;
+  Standard_Real dinvnormtg;
   math_Vector E;
   math_Matrix DEDX;
   math_Vector DEDT;
@@ -257,24 +257,26 @@ void  ChFi3d_Builder::Compute()
 #endif
   
   // Construction of the stripe of fillet on each stripe.
-  for (itel.Initialize(myListStripe);itel.More(); itel.Next()) {
-    itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
-    try {
-      OCC_CATCH_SIGNALS
-      PerformSetOfSurf(itel.Value());
-    }
-    catch(Standard_Failure const& anException) {
+  if (!myRunParallel || !PerformSetOfSurfParallel()) {
+    for (itel.Initialize(myListStripe);itel.More(); itel.Next()) {
+      itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
+      try {
+        OCC_CATCH_SIGNALS
+        PerformSetOfSurf(itel.Value());
+      }
+      catch(Standard_Failure const& anException) {
 #ifdef OCCT_DEBUG
-      cout <<"EXCEPTION Stripe compute " << anException << endl;
+        cout <<"EXCEPTION Stripe compute " << anException << endl;
 #endif
-      (void)anException;
-      badstripes.Append(itel.Value());
+        (void)anException;
+        badstripes.Append(itel.Value());
+        done = Standard_True;
+        if (itel.Value()->Spine()->ErrorStatus()==ChFiDS_Ok) 
+        itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
+      }
+      if (!done) badstripes.Append(itel.Value());
       done = Standard_True;
-      if (itel.Value()->Spine()->ErrorStatus()==ChFiDS_Ok) 
-      itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
     }
-    if (!done) badstripes.Append(itel.Value());
-    done = Standard_True;
   }
   done = (badstripes.IsEmpty());
   
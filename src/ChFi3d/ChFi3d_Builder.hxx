@@ -69,6 +69,7 @@ class ChFiDS_CommonPoint;
 class TopoDS_Face;
 class AppBlend_Approx;
 class Geom2d_Curve;
+class ChFi3d_StripeFunctor;
 
 
 //! Root  class  for calculation of  surfaces (fillets,
@@ -86,6 +87,15 @@ public:
   
   Standard_EXPORT void SetContinuity (const GeomAbs_Shape InternalContinuity, const Standard_Real AngularTolerance);
   
+  //! Sets the flag of parallel computation of the surfaces of
+  //! the contours. The corners and the reconstruction of the
+  //! shape are always computed sequentially, so the result does
+  //! not depend on this flag. By default the flag is False.
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theFlag);
+  
+  //! Returns the flag of parallel computation.
+  Standard_EXPORT Standard_Boolean RunParallel() const;
+  
   //! extracts from  the list the contour containing edge E.
   Standard_EXPORT void Remove (const TopoDS_Edge& E);
   
@@ -201,6 +211,18 @@ protected:
   
   Standard_EXPORT ChFi3d_Builder(const TopoDS_Shape& S, const Standard_Real Ta);
   
+  //! Creates a copy of <theOther> sharing with it only the
+  //! shape and the maps of its subshapes: the data structure,
+  //! the topological builder and the contours are new and empty.
+  Standard_EXPORT ChFi3d_Builder(const ChFi3d_Builder& theOther);
+  
+  //! Returns a new copy of the builder (see the copy constructor)
+  //! used to compute the surfaces of a contour in a separate
+  //! thread, or NULL if the builder can not be copied (the contours
+  //! are then computed sequentially). The caller is responsible
+  //! for deleting it.
+  Standard_EXPORT virtual ChFi3d_Builder* Copy() const;
+  
   Standard_EXPORT virtual void SimulKPart (const Handle(ChFiDS_SurfData)& SD) const = 0;
   
   Standard_EXPORT virtual Standard_Boolean SimulSurf (Handle(ChFiDS_SurfData)& Data, const Handle(ChFiDS_HElSpine)& Guide, const Handle(ChFiDS_Spine)& Spine, const Standard_Integer Choix, const Handle(BRepAdaptor_HSurface)& S1, const Handle(Adaptor3d_TopolTool)& I1, const Handle(BRepAdaptor_HSurface)& S2, const Handle(Adaptor3d_TopolTool)& I2, const Standard_Real TolGuide, Standard_Real& First, Standard_Real& Last, const Standard_Boolean Inside, const Standard_Boolean Appro, const Standard_Boolean Forward, const Standard_Boolean RecOnS1, const Standard_Boolean RecOnS2, const math_Vector& Soldep, Standard_Integer& Intf, Standard_Integer& Intl) = 0;
@@ -229,6 +251,16 @@ protected:
   
   Standard_EXPORT void PerformSetOfKGen (Handle(ChFiDS_Stripe)& S, const Standard_Boolean Simul = Standard_False);
   
+  //! Computes the surfaces of all the stripes of myListStripe
+  //! in parallel, each thread using its own copy of the builder
+  //! and its own data structure. The data structures are then
+  //! merged into myDS in the order of the stripes, so that the
+  //! indices are the same as in sequential mode, and the
+  //! extremities of the stripes are built sequentially.
+  //! The failed stripes are appended to badstripes.
+  //! Returns False if nothing has been computed.
+  Standard_EXPORT Standard_Boolean PerformSetOfSurfParallel();
+  
   Standard_EXPORT void Trunc (const Handle(ChFiDS_SurfData)& SD, const Handle(ChFiDS_Spine)& Spine, const Handle(Adaptor3d_HSurface)& S1, const Handle(Adaptor3d_HSurface)& S2, const Standard_Integer iedge, const Standard_Boolean isfirst, const Standard_Integer cntlFiOnS);
   
   Standard_EXPORT void CallPerformSurf (Handle(ChFiDS_Stripe)& Stripe, const Standard_Boolean Simul, ChFiDS_SequenceOfSurfData& SeqSD, Handle(ChFiDS_SurfData)& SD, const Handle(ChFiDS_HElSpine)& Guide, const Handle(ChFiDS_Spine)& Spine, const Handle(BRepAdaptor_HSurface)& HS1, const Handle(BRepAdaptor_HSurface)& HS3, const gp_Pnt2d& P1, const gp_Pnt2d& P3, const Handle(Adaptor3d_TopolTool)& I1, const Handle(BRepAdaptor_HSurface)& HS2, const Handle(BRepAdaptor_HSurface)& HS4, const gp_Pnt2d& P2, const gp_Pnt2d& P4, const Handle(Adaptor3d_TopolTool)& I2, const Standard_Real MaxStep, const Standard_Real Fleche, const Standard_Real TolGuide, Standard_Real& First, Standard_Real& Last, const Standard_Boolean Inside, const Standard_Boolean Appro, const Standard_Boolean Forward, const Standard_Boolean RecOnS1, const Standard_Boolean RecOnS2, math_Vector& Soldep, Standard_Integer& Intf, Standard_Integer& Intl, Handle(BRepAdaptor_HSurface)& Surf1, Handle(BRepAdaptor_HSurface)& Surf2);
@@ -313,6 +345,7 @@ protected:
   TopTools_DataMapOfShapeListOfInteger myEVIMap;
   Standard_Boolean done;
   Standard_Boolean hasresult;
+  Standard_Boolean myRunParallel;
 
 
 private:
@@ -349,6 +382,8 @@ private:
   Standard_EXPORT void ConexFaces (const Handle(ChFiDS_Spine)& Sp, const Standard_Integer IEdge, const Standard_Integer RefChoix, Handle(BRepAdaptor_HSurface)& HS1, Handle(BRepAdaptor_HSurface)& HS2) const;
 
 
+  friend class ChFi3d_StripeFunctor;
+
   TopoDS_Shape myShape;
   Standard_Real angular;
   TopTools_ListOfShape myGenerated;
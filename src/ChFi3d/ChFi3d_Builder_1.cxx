@@ -96,7 +96,7 @@ static TopOpeBRepDS_BuildTool mkbuildtool()
 //=======================================================================
 ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S,
 			       const Standard_Real Ta) :  
-   done(Standard_False), myShape(S)
+   done(Standard_False), myRunParallel(Standard_False), myShape(S)
 {
   myDS = new TopOpeBRepDS_HDataStructure();
   myCoup = new TopOpeBRepBuild_HBuilder(mkbuildtool());
@@ -109,6 +109,33 @@ ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S,
   SetContinuity(GeomAbs_C1, Ta);
 }
 
+//=======================================================================
+//function : ChFi3d_Builder
+//purpose  : 
+//=======================================================================
+ChFi3d_Builder::ChFi3d_Builder(const ChFi3d_Builder& theOther) :
+   tolappangle(theOther.tolappangle),
+   tolesp(theOther.tolesp),
+   tol2d(theOther.tol2d),
+   tolapp3d(theOther.tolapp3d),
+   tolapp2d(theOther.tolapp2d),
+   fleche(theOther.fleche),
+   myConti(theOther.myConti),
+   myEFMap(theOther.myEFMap),
+   myESoMap(theOther.myESoMap),
+   myEShMap(theOther.myEShMap),
+   myVFMap(theOther.myVFMap),
+   myVEMap(theOther.myVEMap),
+   done(Standard_False),
+   hasresult(Standard_False),
+   myRunParallel(theOther.myRunParallel),
+   myShape(theOther.myShape),
+   angular(theOther.angular)
+{
+  myDS = new TopOpeBRepDS_HDataStructure();
+  myCoup = new TopOpeBRepBuild_HBuilder(mkbuildtool());
+}
+
 //=======================================================================
 //function : SetParams
 //purpose  : 
@@ -141,6 +168,36 @@ void ChFi3d_Builder::SetContinuity(const GeomAbs_Shape InternalContinuity,
   tolappangle = AngularTolerance;
 }
 
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+
+void ChFi3d_Builder::SetRunParallel(const Standard_Boolean theFlag)
+{
+  myRunParallel = theFlag;
+}
+
+//=======================================================================
+//function : RunParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ChFi3d_Builder::RunParallel() const
+{
+  return myRunParallel;
+}
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+ChFi3d_Builder* ChFi3d_Builder::Copy() const
+{
+  return NULL;
+}
+
 //=======================================================================
 //function : IsDone
 //purpose  : 
@@ -49,6 +49,7 @@
 #include <ChFiDS_FilSpine.hxx>
 #include <ChFiDS_HData.hxx>
 #include <ChFiDS_HElSpine.hxx>
+#include <ChFiDS_ListIteratorOfListOfStripe.hxx>
 #include <ChFiDS_ListIteratorOfListOfHElSpine.hxx>
 #include <ChFiDS_ListOfHElSpine.hxx>
 #include <ChFiDS_SequenceOfSurfData.hxx>
@@ -78,8 +79,12 @@
 #include <gp_Vec.hxx>
 #include <gp_XYZ.hxx>
 #include <math_Vector.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_ConstructionError.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -87,6 +92,7 @@
 #include <TColgp_Array1OfVec.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <TColStd_ListOfInteger.hxx>
 #include <TopAbs.hxx>
 #include <TopAbs_Orientation.hxx>
@@ -100,7 +106,10 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopOpeBRepBuild_HBuilder.hxx>
+#include <TopOpeBRepDS_Curve.hxx>
 #include <TopOpeBRepDS_HDataStructure.hxx>
+#include <TopOpeBRepDS_Surface.hxx>
+#include <TopTools_DataMapIteratorOfDataMapOfShapeListOfInteger.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
 
 #ifdef OCCT_DEBUG
@@ -2985,3 +2994,237 @@ void ChFi3d_Builder::PerformSetOfSurf(Handle(ChFiDS_Stripe)& Stripe,
   ChFi3d_ResultChron(ch, t_makextremities); // result perf t_makextremities
 #endif
 }
+
+//=======================================================================
+//struct   : ChFi3d_StripeData
+//purpose  : Result of the computation of the surfaces of a stripe
+//           in a separate data structure
+//=======================================================================
+
+struct ChFi3d_StripeData
+{
+  Handle(ChFiDS_Stripe)                Stripe;
+  Handle(TopOpeBRepDS_HDataStructure)  DS;
+  TopTools_DataMapOfShapeListOfInteger EVIMap;
+  Standard_Boolean                     IsDone;
+  Standard_Boolean                     IsFailed;
+
+  ChFi3d_StripeData() : IsDone (Standard_False), IsFailed (Standard_False) {}
+};
+
+//=======================================================================
+//class    : ChFi3d_StripeFunctor
+//purpose  : Computes the surfaces of the stripes with the same index
+//           modulo the number of builders on one copy of the builder
+//=======================================================================
+
+class ChFi3d_StripeFunctor
+{
+public:
+
+  ChFi3d_StripeFunctor (const NCollection_Array1<ChFi3d_Builder*>& theBuilders,
+                        NCollection_Array1<ChFi3d_StripeData>&     theStripes)
+  : myBuilders (theBuilders),
+    myStripes  (theStripes)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    ChFi3d_Builder* aBuilder = myBuilders (theIndex);
+    for (Standard_Integer i = myStripes.Lower() + theIndex;
+         i <= myStripes.Upper(); i += myBuilders.Length())
+    {
+      ChFi3d_StripeData& aData = myStripes (i);
+      aBuilder->myDS = new TopOpeBRepDS_HDataStructure();
+      aBuilder->myEVIMap.Clear();
+      aBuilder->done = Standard_True;
+      const Handle(ChFiDS_Spine)& aSpine = aData.Stripe->Spine();
+      try
+      {
+        OCC_CATCH_SIGNALS
+        TopOpeBRepDS_DataStructure& aDStr = aBuilder->myDS->ChangeDS();
+        aData.Stripe->SetSolidIndex (ChFi3d_SolidIndex (aSpine, aDStr,
+                                                        aBuilder->myESoMap,
+                                                        aBuilder->myEShMap));
+        if (!aSpine->SplitDone())
+        {
+          aBuilder->PerformSetOfKPart (aData.Stripe);
+        }
+        aBuilder->PerformSetOfKGen (aData.Stripe);
+      }
+      catch (Standard_Failure const&)
+      {
+        aData.IsFailed = Standard_True;
+      }
+      aData.IsDone = aBuilder->done;
+      aData.DS = aBuilder->myDS;
+      aData.EVIMap.Exchange (aBuilder->myEVIMap);
+    }
+  }
+
+private:
+  ChFi3d_StripeFunctor& operator= (const ChFi3d_StripeFunctor&);
+
+private:
+  const NCollection_Array1<ChFi3d_Builder*>& myBuilders;
+  NCollection_Array1<ChFi3d_StripeData>&     myStripes;
+};
+
+//=======================================================================
+//function : ChFi3d_MergeDS
+//purpose  : Appends the geometry of the data structure <theFrom> built
+//           for the stripe <theStripe> to <theDS> and updates the
+//           indices referenced by the stripe and by <theEVIMap>.
+//=======================================================================
+
+static void ChFi3d_MergeDS (TopOpeBRepDS_DataStructure&                 theDS,
+                            const TopOpeBRepDS_DataStructure&           theFrom,
+                            const Handle(ChFiDS_Stripe)&                theStripe,
+                            const TopTools_DataMapOfShapeListOfInteger& theFromEVIMap,
+                            TopTools_DataMapOfShapeListOfInteger&       theEVIMap)
+{
+  // the entities are added in the order of their creation, which gives
+  // them the same indices as if the stripe were computed in <theDS>
+  TColStd_Array1OfInteger aShapes (0, theFrom.NbShapes());
+  aShapes.Init (0);
+  for (Standard_Integer i = 1; i <= theFrom.NbShapes(); ++i)
+  {
+    aShapes (i) = theDS.AddShape (theFrom.Shape (i, Standard_False));
+  }
+  TColStd_Array1OfInteger aSurfaces (0, theFrom.NbSurfaces());
+  aSurfaces.Init (0);
+  for (Standard_Integer i = 1; i <= theFrom.NbSurfaces(); ++i)
+  {
+    aSurfaces (i) = theDS.AddSurface (theFrom.Surface (i));
+  }
+  TColStd_Array1OfInteger aCurves (0, theFrom.NbCurves());
+  aCurves.Init (0);
+  for (Standard_Integer i = 1; i <= theFrom.NbCurves(); ++i)
+  {
+    aCurves (i) = theDS.AddCurve (theFrom.Curve (i));
+  }
+
+  theStripe->SetSolidIndex (aShapes (theStripe->SolidIndex()));
+  const Handle(ChFiDS_HData)& aHData = theStripe->SetOfSurfData();
+  if (!aHData.IsNull())
+  {
+    for (Standard_Integer i = 1; i <= aHData->Length(); ++i)
+    {
+      const Handle(ChFiDS_SurfData)& aSD = aHData->Value (i);
+      aSD->ChangeIndexOfS1 (aShapes (aSD->IndexOfS1()));
+      aSD->ChangeIndexOfS2 (aShapes (aSD->IndexOfS2()));
+      if (aSD->IsOnCurve1())
+      {
+        aSD->SetIndexOfC1 (aShapes (aSD->IndexOfC1()));
+      }
+      if (aSD->IsOnCurve2())
+      {
+        aSD->SetIndexOfC2 (aShapes (aSD->IndexOfC2()));
+      }
+      aSD->ChangeSurf (aSurfaces (aSD->Surf()));
+      for (Standard_Integer anOnS = 1; anOnS <= 2; ++anOnS)
+      {
+        ChFiDS_FaceInterference& anInterf = aSD->ChangeInterference (anOnS);
+        anInterf.SetLineIndex (aCurves (anInterf.LineIndex()));
+      }
+    }
+  }
+
+  for (TopTools_DataMapIteratorOfDataMapOfShapeListOfInteger anIt (theFromEVIMap);
+       anIt.More(); anIt.Next())
+  {
+    if (!theEVIMap.IsBound (anIt.Key()))
+    {
+      theEVIMap.Bind (anIt.Key(), TColStd_ListOfInteger());
+    }
+    TColStd_ListOfInteger& aList = theEVIMap.ChangeFind (anIt.Key());
+    for (TColStd_ListIteratorOfListOfInteger anItS (anIt.Value()); anItS.More(); anItS.Next())
+    {
+      aList.Append (aSurfaces (anItS.Value()));
+    }
+  }
+}
+
+//=======================================================================
+//function : PerformSetOfSurfParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ChFi3d_Builder::PerformSetOfSurfParallel()
+{
+  const Standard_Integer aNbStripes = myListStripe.Extent();
+  const Standard_Integer aNbBuilders = Min (aNbStripes, OSD_Parallel::NbLogicalProcessors());
+  if (aNbBuilders < 2)
+  {
+    return Standard_False;
+  }
+
+  // each thread works on its own copy of the builder, as the surfaces
+  // are computed by the methods storing their results in myDS
+  NCollection_Array1<ChFi3d_Builder*> aBuilders (0, aNbBuilders - 1);
+  aBuilders.Init (NULL);
+  Standard_Boolean isCopied = Standard_True;
+  for (Standard_Integer i = 0; i < aNbBuilders && isCopied; ++i)
+  {
+    aBuilders (i) = Copy();
+    isCopied = (aBuilders (i) != NULL);
+  }
+  if (!isCopied)
+  {
+    for (Standard_Integer i = 0; i < aNbBuilders; ++i)
+    {
+      delete aBuilders (i);
+    }
+    return Standard_False;
+  }
+
+  NCollection_Array1<ChFi3d_StripeData> aStripes (0, aNbStripes - 1);
+  ChFiDS_ListIteratorOfListOfStripe itel (myListStripe);
+  for (Standard_Integer i = 0; itel.More(); itel.Next(), ++i)
+  {
+    aStripes (i).Stripe = itel.Value();
+    itel.Value()->Spine()->SetErrorStatus (ChFiDS_Ok);
+  }
+
+  ChFi3d_StripeFunctor aFunctor (aBuilders, aStripes);
+  OSD_Parallel::For (0, aNbBuilders, aFunctor);
+  for (Standard_Integer i = 0; i < aNbBuilders; ++i)
+  {
+    delete aBuilders (i);
+  }
+
+  TopOpeBRepDS_DataStructure& DStr = myDS->ChangeDS();
+  for (Standard_Integer i = 0; i < aNbStripes; ++i)
+  {
+    ChFi3d_StripeData& aData = aStripes (i);
+    ChFi3d_MergeDS (DStr, aData.DS->DS(), aData.Stripe, aData.EVIMap, myEVIMap);
+    aData.DS.Nullify();
+    if (!aData.IsFailed)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        ChFi3d_MakeExtremities (aData.Stripe, DStr, myEFMap, tolesp, tol2d);
+      }
+      catch (Standard_Failure const&)
+      {
+        aData.IsFailed = Standard_True;
+      }
+    }
+
+    if (aData.IsFailed)
+    {
+      badstripes.Append (aData.Stripe);
+      if (aData.Stripe->Spine()->ErrorStatus() == ChFiDS_Ok)
+      {
+        aData.Stripe->Spine()->SetErrorStatus (ChFiDS_Error);
+      }
+    }
+    else if (!aData.IsDone)
+    {
+      badstripes.Append (aData.Stripe);
+    }
+  }
+  done = Standard_True;
+  return Standard_True;
+}
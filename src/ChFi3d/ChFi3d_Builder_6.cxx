@@ -656,8 +656,7 @@ Standard_Boolean ChFi3d_Builder::StoreData(Handle(ChFiDS_SurfData)& Data,
 					   const Standard_Boolean Reversed)
 {
   // Small control tools.
-  static Handle(GeomAdaptor_HCurve) checkcurve;
-  if(checkcurve.IsNull()) checkcurve = new GeomAdaptor_HCurve();
+  Handle(GeomAdaptor_HCurve) checkcurve = new GeomAdaptor_HCurve();
   GeomAdaptor_Curve& chc = checkcurve->ChangeCurve();
   Standard_Real tolget3d, tolget2d, tolaux, tolC1,  tolcheck;
   Standard_Real  tolC2 = 0.;
@@ -182,6 +182,16 @@ ChFi3d_ChBuilder::ChFi3d_ChBuilder(const TopoDS_Shape& S,
 {
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+ChFi3d_Builder* ChFi3d_ChBuilder::Copy() const
+{
+  return new ChFi3d_ChBuilder (*this);
+}
+
 
 //=======================================================================
 //function : Add
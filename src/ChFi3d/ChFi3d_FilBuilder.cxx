@@ -148,6 +148,16 @@ ChFi3d_FilBuilder::ChFi3d_FilBuilder(const TopoDS_Shape& S,
   SetFilletShape(FShape);
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+ChFi3d_Builder* ChFi3d_FilBuilder::Copy() const
+{
+  return new ChFi3d_FilBuilder (*this);
+}
+
 //=======================================================================
 //function : SetFilletShape
 //purpose  : 
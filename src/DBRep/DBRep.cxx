@@ -1375,7 +1375,34 @@ static Standard_Integer binsave(Draw_Interpretor& di, Standard_Integer n, const
     return 1;
   }
 
-  if (!BinTools::Write (aShape, a[2]))
+  Standard_Integer aFormatNb = 3;
+  Standard_Boolean isCompressed = Standard_False;
+  for (Standard_Integer anArgIter = 3; anArgIter < n; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (a[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-version"
+     && anArgIter + 1 < n)
+    {
+      aFormatNb = Draw::Atoi (a[++anArgIter]);
+      if (aFormatNb < 1 || aFormatNb > 4)
+      {
+        di << "Syntax error: unsupported format version " << aFormatNb;
+        return 1;
+      }
+    }
+    else if (anArg == "-compress")
+    {
+      isCompressed = Standard_True;
+    }
+    else
+    {
+      di << "Syntax error at '" << a[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  if (!BinTools::Write (aShape, a[2], aFormatNb, isCompressed))
   {
     di << "Cannot write to the file " << a[2];
     return 1;
@@ -1464,8 +1491,9 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
   // Add command for DRAW-specific ProgressIndicator
   theCommands.Add ( "XProgress","XProgress [+|-t] [+|-g]: switch on/off textual and graphical mode of Progress Indicator",XProgress,"DE: General");
 
-  theCommands.Add("binsave", "binsave shape filename\n"
-                  "\t\tsave the shape in the binary format file",
+  theCommands.Add("binsave", "binsave shape filename [-version {1|2|3|4}=3] [-compress]\n"
+                  "\t\tsave the shape in the binary format file;\n"
+                  "\t\t-compress packs triangulations and polygons (version 4 only)",
                   __FILE__, binsave, g);
   theCommands.Add("binrestore", "binrestore filename shape\n"
                   "\t\trestore the shape from the binary format file",
@@ -35,6 +35,11 @@
 #include <OSD_OpenFile.hxx>
 #include <TDocStd_PathParser.hxx>
 #include <XmlLDrivers.hxx>
+#include <BinLDrivers_DocumentRetrievalDriver.hxx>
+#include <BinLDrivers_DocumentStorageDriver.hxx>
+#include <XmlLDrivers_DocumentRetrievalDriver.hxx>
+#include <PCDM_ReadWriter.hxx>
+#include <Standard_ErrorHandler.hxx>
 
 #include <AIS_InteractiveContext.hxx>
 #include <TPrsStd_AISViewer.hxx>
@@ -140,14 +145,61 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     }
     PCDM_ReaderStatus theStatus;
 
-    Standard_Boolean anUseStream = Standard_False;
+    Standard_Boolean anUseStream = Standard_False, isParallel = Standard_False, isStreaming = Standard_False;
     for ( Standard_Integer i = 3; i < nb; i++ )
     {
       if (!strcmp (a[i], "-stream"))
       {
         di << "standard SEEKABLE stream is used\n";
         anUseStream = Standard_True;
-        break;
+      }
+      else if (!strcmp (a[i], "-parallel"))
+      {
+        isParallel = Standard_True;
+      }
+      else if (!strcmp (a[i], "-streaming"))
+      {
+        isStreaming = Standard_True;
+      }
+    }
+
+    // retrieval modes are the properties of the driver shared by all documents of the format,
+    // so they are set just for this call
+    Handle(PCDM_Reader) aReader;
+    if (isParallel || isStreaming)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aReader = A->ReaderFromFormat (PCDM_ReadWriter::FileFormat (path));
+      }
+      catch (Standard_Failure const&)
+      {
+        // no driver, reported by Open() below
+      }
+    }
+    Handle(BinLDrivers_DocumentRetrievalDriver) aBinReader = Handle(BinLDrivers_DocumentRetrievalDriver)::DownCast (aReader);
+    Handle(XmlLDrivers_DocumentRetrievalDriver) anXmlReader = Handle(XmlLDrivers_DocumentRetrievalDriver)::DownCast (aReader);
+    if (isParallel)
+    {
+      if (aBinReader.IsNull())
+      {
+        di << "Warning: -parallel is ignored, the document is not in binary format\n";
+      }
+      else
+      {
+        aBinReader->SetRunParallel (Standard_True);
+      }
+    }
+    if (isStreaming)
+    {
+      if (anXmlReader.IsNull())
+      {
+        di << "Warning: -streaming is ignored, the document is not in XML format\n";
+      }
+      else
+      {
+        anXmlReader->SetStreamingMode (Standard_True);
       }
     }
 
@@ -162,6 +214,14 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     {
       theStatus = A->Open(path,D);
     }
+    if (!aBinReader.IsNull())
+    {
+      aBinReader->SetRunParallel (Standard_False);
+    }
+    if (!anXmlReader.IsNull())
+    {
+      anXmlReader->SetStreamingMode (Standard_False);
+    }
     if (theStatus == PCDM_RS_OK && !D.IsNull()) {
       Handle(DDocStd_DrawDocument) DD = new DDocStd_DrawDocument(D);
       TDataStd_Name::Set(D->GetData()->Root(),a[2]);
@@ -211,7 +271,7 @@ static Standard_Integer DDocStd_Save (Draw_Interpretor& di,
 				      Standard_Integer nb,
 				      const char** a)
 {  
-  if (nb == 2) {
+  if (nb == 2 || (nb == 3 && !strcmp (a[2], "-journal"))) {
     Handle(TDocStd_Document) D;    
     if (!DDocStd::GetDocument(a[1],D)) return 1;
     Handle(TDocStd_Application) A = DDocStd::GetApplication();
@@ -219,7 +279,24 @@ static Standard_Integer DDocStd_Save (Draw_Interpretor& di,
       di << "this document has never been saved\n";
       return 0;
     }
-    A->Save(D);
+    if (nb == 2) {
+      A->Save(D);
+      return 0;
+    }
+
+    // incremental save: append the journal of modifications to the file
+    Handle(BinLDrivers_DocumentStorageDriver) aWriter =
+      Handle(BinLDrivers_DocumentStorageDriver)::DownCast (A->WriterFromFormat (D->StorageFormat()));
+    if (aWriter.IsNull()) {
+      di << "Error: -journal is supported only by binary formats\n";
+      return 1;
+    }
+    aWriter->WriteJournal (D, D->GetPath());
+    if (aWriter->IsError()) {
+      di << "Error: the document is not saved\n";
+      return 1;
+    }
+    D->SetSaved();
     return 0; 
   }
   di << "DDocStd_Save : Error\n";
@@ -529,7 +606,9 @@ void DDocStd::ApplicationCommands(Draw_Interpretor& theCommands)
 		  __FILE__, DDocStd_NewDocument, g);  
 
   theCommands.Add("Open",
-		  "Open path docname [-stream]",
+		  "Open path docname [-stream] [-parallel] [-streaming]"
+		  "\n\t\t: -parallel decodes arrays and lists of binary document in parallel threads"
+		  "\n\t\t: -streaming reads XML document element by element without building the DOM tree",
 		  __FILE__, DDocStd_Open, g);   
 
   theCommands.Add("SaveAs",
@@ -537,7 +616,8 @@ void DDocStd::ApplicationCommands(Draw_Interpretor& theCommands)
 		  __FILE__, DDocStd_SaveAs, g);  
 
   theCommands.Add("Save",
-		  "Save",
+		  "Save DOC [-journal]"
+		  "\n\t\t: -journal appends modifications of the document in journal mode to its binary file",
 		  __FILE__, DDocStd_Save, g);  
 
   theCommands.Add("Close",
@@ -201,6 +201,54 @@ static Standard_Integer DDocStd_UndoLimit (Draw_Interpretor& di,Standard_Integer
   return 0;
 }
 
+//=======================================================================
+//function : JournalMode
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer DDocStd_JournalMode (Draw_Interpretor& di,Standard_Integer n, const char** a)
+{
+  if (n < 2) return 1;
+  
+  Handle(TDocStd_Document) D;
+  if (!DDocStd::GetDocument(a[1],D)) return 1;
+  
+  if (n > 2) {
+    D->SetJournalMode (Draw::Atoi(a[2]) != 0);
+  }
+  
+  // display current values
+  di << (D->IsJournalMode() ? 1 : 0) << " ";
+  di << (D->IsJournalComplete() ? 1 : 0) << " ";
+  di << D->JournalLabels().Extent();
+  return 0;
+}
+
+//=======================================================================
+//function : UndoMemoryLimit
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer DDocStd_UndoMemoryLimit (Draw_Interpretor& di,Standard_Integer n, const char** a)
+{
+  if (n < 2) return 1;
+  
+  Handle(TDocStd_Document) D;
+  if (!DDocStd::GetDocument(a[1],D)) return 1;
+  
+  if (n > 2) {
+    // parsed as real to accept limits beyond the range of Standard_Integer
+    const Standard_Real lim = Draw::Atof(a[2]);
+    D->SetUndoMemoryLimit(lim > 0.0 ? (Standard_Size )lim : 0);
+  }
+  
+  // display current values
+  di << Standard_Real (D->GetUndoMemoryLimit()) << " ";
+  di << Standard_Real (D->GetUndoMemorySize()) << " ";
+  di << D->GetAvailableUndos();
+  return 0;
+}
+
 //=======================================================================
 //function : Undo, Redo
 //purpose  : Undo (DOC)
@@ -500,6 +548,12 @@ void DDocStd::DocumentCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add("UndoLimit","UndoLimit DOC (Value), return UndoLimit Undos Redos",
 		  __FILE__, DDocStd_UndoLimit, g);
+
+  theCommands.Add("UndoMemoryLimit","UndoMemoryLimit DOC (Bytes), return UndoMemoryLimit UndoMemorySize Undos",
+		  __FILE__, DDocStd_UndoMemoryLimit, g);
+  
+  theCommands.Add("JournalMode","JournalMode DOC (0|1), return JournalMode IsJournalComplete NbJournalLabels",
+		  __FILE__, DDocStd_JournalMode, g);
   
   theCommands.Add("Undo","Undo DOC (steps = 1)",
 		  __FILE__, DDocStd_Undo, g);
@@ -543,12 +543,13 @@ void Extrema_GenExtPS::BuildGrid(const gp_Pnt &thePoint)
     myPoints = new Extrema_HArray2OfPOnSurfParams
       (0, myusample + 1, 0, myvsample + 1);
     // Calculation of distances
+    TColgp_Array2OfPnt aGridPnts (1, myusample, 1, myvsample);
+    myS->D0Grid (myUParams->Array1(), myVParams->Array1(), aGridPnts);
   
     for ( NoU = 1 ; NoU <= myusample; NoU++ ) {
       for ( NoV = 1 ; NoV <= myvsample; NoV++) {
-        gp_Pnt aP1 = myS->Value(myUParams->Value(NoU), myVParams->Value(NoV));
         Extrema_POnSurfParams aParam
-          (myUParams->Value(NoU), myVParams->Value(NoV), aP1);
+          (myUParams->Value(NoU), myVParams->Value(NoV), aGridPnts(NoU, NoV));
 
         aParam.SetElementType(Extrema_Node);
         aParam.SetIndices(NoU, NoV);
@@ -750,10 +751,12 @@ void Extrema_GenExtPS::BuildTree()
   Standard_Integer i = 0;
   
   mySphereArray = new Bnd_HArray1OfSphere(0, myusample * myvsample);
+  TColgp_Array2OfPnt aGridPnts (1, myusample, 1, myvsample);
+  myS->D0Grid (myUParams->Array1(), myVParams->Array1(), aGridPnts);
  
   for ( NoU = 1; NoU <= myusample; NoU++ ) {
     for ( NoV = 1; NoV <= myvsample; NoV++) {
-      P1 = myS->Value(myUParams->Value(NoU), myVParams->Value(NoV));
+      P1 = aGridPnts (NoU, NoV);
       Bnd_Sphere aSph(P1.XYZ(), 0/*mytolu < mytolv ? mytolu : mytolv*/, NoU, NoV);
       aFiller.Add(i, aSph);
       mySphereArray->SetValue( i, aSph );
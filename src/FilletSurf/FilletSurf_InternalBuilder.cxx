@@ -167,6 +167,16 @@ FilletSurf_InternalBuilder::FilletSurf_InternalBuilder
   SetContinuity(GeomAbs_C2,Ta);
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+ChFi3d_Builder* FilletSurf_InternalBuilder::Copy() const
+{
+  return new FilletSurf_InternalBuilder (*this);
+}
+
 //=======================================================================
 //function : Add
 //purpose  : creation of spine on a set of edges
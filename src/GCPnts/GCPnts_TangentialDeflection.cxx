@@ -26,6 +26,8 @@
 #include <Precision.hxx>
 #include <Standard_ConstructionError.hxx>
 #include <Standard_OutOfRange.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 inline static void D0 (const Adaptor3d_Curve& C, const Standard_Real U, gp_Pnt& P)
@@ -33,6 +35,12 @@ inline static void D0 (const Adaptor3d_Curve& C, const Standard_Real U, gp_Pnt&
   C.D0 (U, P);
 }
 
+inline static void D0Array (const Adaptor3d_Curve& C, const TColStd_Array1OfReal& U,
+                            TColgp_Array1OfPnt& P)
+{
+  C.D0Array (U, P);
+}
+
 inline static void D2 (const Adaptor3d_Curve& C, const Standard_Real U, 
                        gp_Pnt& P, gp_Vec& V1, gp_Vec& V2)
 {
@@ -49,6 +57,15 @@ static void D0 (const Adaptor2d_Curve2d& C, const Standard_Real U, gp_Pnt& PP)
   PP.SetCoord (X, Y, 0.0);
 }
 
+static void D0Array (const Adaptor2d_Curve2d& C, const TColStd_Array1OfReal& U,
+                     TColgp_Array1OfPnt& PP)
+{
+  TColgp_Array1OfPnt2d P (U.Lower(), U.Upper());
+  C.D0Array (U, P);
+  for (Standard_Integer i = U.Lower(); i <= U.Upper(); i++)
+    PP (i).SetCoord (P (i).X(), P (i).Y(), 0.0);
+}
+
 static void D2 (const Adaptor2d_Curve2d& C, const Standard_Real U,
 	        gp_Pnt& PP, gp_Vec& VV1, gp_Vec& VV2)
 {
@@ -44,6 +44,7 @@
 #include <Standard_ConstructionError.hxx>
 #include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -119,6 +120,47 @@ Handle(Geom_Geometry) Geom_BSplineCurve::Copy() const
   return C;
 }
 
+//=======================================================================
+//function : MultiSpanCache
+//purpose  : 
+//=======================================================================
+
+Handle(BSplCLib_MultiSpanCache) Geom_BSplineCurve::MultiSpanCache() const
+{
+  const Standard_Size aLimit = BSplCLib_MultiSpanCache::MemoryLimit();
+  if (aLimit == 0)
+  {
+    return Handle(BSplCLib_MultiSpanCache)();
+  }
+
+  // same scheme as in Geom_BSplineSurface::MultiSpanCache()
+  static Standard_Mutex THE_MUTEX;
+  {
+    Standard_Mutex::Sentry aSentry (THE_MUTEX);
+    if (!multispancache.IsNull())
+    {
+      return multispancache;
+    }
+    if (multispancachesize == 0)
+    {
+      multispancachesize = BSplCLib_MultiSpanCache::EstimatedSize (deg, flatknots->Array1(), rational);
+    }
+    if (multispancachesize > aLimit)
+    {
+      return Handle(BSplCLib_MultiSpanCache)();
+    }
+  }
+
+  Handle(BSplCLib_MultiSpanCache) aCache =
+    new BSplCLib_MultiSpanCache (deg, periodic, flatknots->Array1(), poles->Array1(), Weights());
+  Standard_Mutex::Sentry aSentry (THE_MUTEX);
+  if (multispancache.IsNull())
+  {
+    multispancache = aCache;
+  }
+  return multispancache;
+}
+
 //=======================================================================
 //function : Geom_BSplineCurve
 //purpose  : 
@@ -133,7 +175,8 @@ Geom_BSplineCurve::Geom_BSplineCurve
  rational(Standard_False),
  periodic(Periodic),
  deg(Degree),
- maxderivinvok(Standard_False)
+ maxderivinvok(Standard_False),
+ multispancachesize(0)
 {
   // check
   
@@ -174,7 +217,8 @@ Geom_BSplineCurve::Geom_BSplineCurve
  rational(Standard_True),
  periodic(Periodic),
  deg(Degree),
- maxderivinvok(Standard_False)
+ maxderivinvok(Standard_False),
+ multispancachesize(0)
 
 {
 
@@ -976,6 +1020,7 @@ void Geom_BSplineCurve::SetPole
   if (Index < 1 || Index > poles->Length()) throw Standard_OutOfRange();
   poles->SetValue (Index, P);
   maxderivinvok = 0;
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1024,6 +1069,7 @@ void Geom_BSplineCurve::SetWeight
     rational = !weights.IsNull();
   }
   maxderivinvok = 0;
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1052,6 +1098,7 @@ void Geom_BSplineCurve::MovePoint(const Standard_Real U,
   if (FirstModifiedPole) {
     poles->ChangeArray1() = npoles;
     maxderivinvok = 0;
+    InvalidateCache();
   }
 }
 
@@ -1102,6 +1149,7 @@ void Geom_BSplineCurve::MovePointAndTangent(const Standard_Real    U,
   if (!ErrorStatus) {
     poles->ChangeArray1() = new_poles;
     maxderivinvok = 0;
+    InvalidateCache();
   }
 }
 
@@ -1112,6 +1160,7 @@ void Geom_BSplineCurve::MovePointAndTangent(const Standard_Real    U,
 
 void Geom_BSplineCurve::UpdateKnots()
 {
+  InvalidateCache();
   rational = !weights.IsNull();
 
   Standard_Integer MaxKnotMult = 0;
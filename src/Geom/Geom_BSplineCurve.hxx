@@ -32,6 +32,7 @@
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array1OfInteger.hxx>
+#include <BSplCLib_MultiSpanCache.hxx>
 class Standard_ConstructionError;
 class Standard_DimensionError;
 class Standard_DomainError;
@@ -776,6 +777,14 @@ public:
   
   //! Creates a new object which is a copy of this BSpline curve.
   Standard_EXPORT Handle(Geom_Geometry) Copy() const Standard_OVERRIDE;
+
+  //! Returns the polynomial cache of all spans of this curve,
+  //! shared by the adaptors evaluating it.
+  //! The cache is built on the first call and released by any modification of the curve.
+  //! Returns a null handle if the size of the cache would exceed
+  //! BSplCLib_MultiSpanCache::MemoryLimit().
+  //! The method can be called concurrently from several threads.
+  Standard_EXPORT Handle(BSplCLib_MultiSpanCache) MultiSpanCache() const;
   
   //! Comapare two Bspline curve on identity;
   Standard_EXPORT Standard_Boolean IsEqual (const Handle(Geom_BSplineCurve)& theOther, const Standard_Real thePreci) const;
@@ -796,6 +805,9 @@ private:
   //! Recompute  the  flatknots,  the knotsdistribution, the continuity.
   Standard_EXPORT void UpdateKnots();
 
+  //! Releases the multi-span cache after modification of the curve.
+  void InvalidateCache() { multispancache.Nullify(); multispancachesize = 0; }
+
   Standard_Boolean rational;
   Standard_Boolean periodic;
   GeomAbs_BSplKnotDistribution knotSet;
@@ -808,6 +820,8 @@ private:
   Handle(TColStd_HArray1OfInteger) mults;
   Standard_Real maxderivinv;
   Standard_Boolean maxderivinvok;
+  mutable Handle(BSplCLib_MultiSpanCache) multispancache;
+  mutable Standard_Size multispancachesize;
 
 
 };
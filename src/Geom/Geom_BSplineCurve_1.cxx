@@ -767,6 +767,7 @@ void Geom_BSplineCurve::Transform
   for (Standard_Integer I = 1; I <= CPoles.Length(); I++)  
     CPoles (I).Transform (T);
   maxderivinvok = 0;
+  InvalidateCache();
 }
 
 //=======================================================================
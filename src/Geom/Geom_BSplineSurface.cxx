@@ -37,6 +37,7 @@
 #include <Standard_ConstructionError.hxx>
 #include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -151,6 +152,52 @@ Handle(Geom_Geometry) Geom_BSplineSurface::Copy () const
   return S;
 }
 
+//=======================================================================
+//function : MultiSpanCache
+//purpose  : 
+//=======================================================================
+
+Handle(BSplSLib_MultiSpanCache) Geom_BSplineSurface::MultiSpanCache() const
+{
+  const Standard_Size aLimit = BSplSLib_MultiSpanCache::MemoryLimit();
+  if (aLimit == 0)
+  {
+    return Handle(BSplSLib_MultiSpanCache)();
+  }
+
+  // the cache is built outside of the lock to let distinct surfaces be processed in parallel;
+  // a cache built concurrently by another thread is preferred to keep a single shared instance
+  static Standard_Mutex THE_MUTEX;
+  {
+    Standard_Mutex::Sentry aSentry (THE_MUTEX);
+    if (!multispancache.IsNull())
+    {
+      return multispancache;
+    }
+    // the size is estimated once per parameterization, it is reset with the cache
+    if (multispancachesize == 0)
+    {
+      multispancachesize = BSplSLib_MultiSpanCache::EstimatedSize (udeg, ufknots->Array1(), vdeg, vfknots->Array1(),
+                                                                   urational || vrational);
+    }
+    if (multispancachesize > aLimit)
+    {
+      return Handle(BSplSLib_MultiSpanCache)();
+    }
+  }
+
+  Handle(BSplSLib_MultiSpanCache) aCache =
+    new BSplSLib_MultiSpanCache (udeg, uperiodic, ufknots->Array1(),
+                                 vdeg, vperiodic, vfknots->Array1(),
+                                 poles->Array2(), Weights());
+  Standard_Mutex::Sentry aSentry (THE_MUTEX);
+  if (multispancache.IsNull())
+  {
+    multispancache = aCache;
+  }
+  return multispancache;
+}
+
 //=======================================================================
 //function : Geom_BSplineSurface
 //purpose  : 
@@ -173,7 +220,8 @@ Geom_BSplineSurface::Geom_BSplineSurface
  vperiodic(VPeriodic),
  udeg(UDegree),
  vdeg(VDegree),
- maxderivinvok(0)
+ maxderivinvok(0),
+ multispancachesize(0)
 
 {
 
@@ -232,7 +280,8 @@ Geom_BSplineSurface::Geom_BSplineSurface
  vperiodic(VPeriodic),
  udeg(UDegree),
  vdeg(VDegree),
- maxderivinvok(0)
+ maxderivinvok(0),
+ multispancachesize(0)
 {
   // check weights
 
@@ -1237,6 +1286,7 @@ void  Geom_BSplineSurface::IncrementVMultiplicity
 
 void Geom_BSplineSurface::UpdateUKnots()
 {
+  InvalidateCache();
 
   Standard_Integer MaxKnotMult = 0;
   BSplCLib::KnotAnalysis (udeg, uperiodic,
@@ -1276,6 +1326,7 @@ void Geom_BSplineSurface::UpdateUKnots()
 
 void Geom_BSplineSurface::UpdateVKnots()
 {
+  InvalidateCache();
   Standard_Integer MaxKnotMult = 0;
   BSplCLib::KnotAnalysis (vdeg, vperiodic,
 		vknots->Array1(), 
@@ -1376,6 +1427,7 @@ void Geom_BSplineSurface::SetWeight (const Standard_Integer UIndex,
   }
   Weights (UIndex+Weights.LowerRow()-1, VIndex+Weights.LowerCol()-1) = Weight;
   Rational(Weights, urational, vrational);
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1408,6 +1460,7 @@ void Geom_BSplineSurface::SetWeightCol
   }
   // Verifie si c'est rationnel
   Rational(Weights, urational, vrational);
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1442,5 +1495,6 @@ void Geom_BSplineSurface::SetWeightRow
   }
   // Verifie si c'est rationnel
   Rational(Weights, urational, vrational);
+  InvalidateCache();
 }
 
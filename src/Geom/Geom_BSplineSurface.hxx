@@ -35,6 +35,7 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array2OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <BSplSLib_MultiSpanCache.hxx>
 class Standard_ConstructionError;
 class Standard_DimensionError;
 class Standard_DomainError;
@@ -1177,6 +1178,14 @@ public:
   //! Creates a new object which is a copy of this BSpline surface.
   Standard_EXPORT Handle(Geom_Geometry) Copy() const Standard_OVERRIDE;
 
+  //! Returns the polynomial cache of all spans of this surface,
+  //! shared by the adaptors evaluating it.
+  //! The cache is built on the first call and released by any modification of the surface.
+  //! Returns a null handle if the size of the cache would exceed
+  //! BSplSLib_MultiSpanCache::MemoryLimit().
+  //! The method can be called concurrently from several threads.
+  Standard_EXPORT Handle(BSplSLib_MultiSpanCache) MultiSpanCache() const;
+
 
 
 
@@ -1198,6 +1207,9 @@ private:
   //! continuity for V.
   Standard_EXPORT void UpdateVKnots();
 
+  //! Releases the multi-span cache after modification of the surface.
+  void InvalidateCache() { multispancache.Nullify(); multispancachesize = 0; }
+
   Standard_Boolean urational;
   Standard_Boolean vrational;
   Standard_Boolean uperiodic;
@@ -1219,6 +1231,8 @@ private:
   Standard_Real umaxderivinv;
   Standard_Real vmaxderivinv;
   Standard_Boolean maxderivinvok;
+  mutable Handle(BSplSLib_MultiSpanCache) multispancache;
+  mutable Standard_Size multispancachesize;
 
 
 };
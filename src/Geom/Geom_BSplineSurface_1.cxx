@@ -787,6 +787,7 @@ void Geom_BSplineSurface::Transform (const gp_Trsf& T)
       VPoles (i, j).Transform (T);
     }
   }
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1501,6 +1502,7 @@ void Geom_BSplineSurface::SetPoleCol (const Standard_Integer      VIndex,
   for (Standard_Integer I = CPoles.Lower(); I <= CPoles.Upper(); I++) {
     Poles (I+Poles.LowerRow()-1, VIndex+Poles.LowerCol()-1) = CPoles(I);
   }
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1537,6 +1539,7 @@ void Geom_BSplineSurface::SetPoleRow (const Standard_Integer    UIndex,
   for (Standard_Integer I = CPoles.Lower(); I <= CPoles.Upper(); I++) {
     Poles (UIndex+Poles.LowerRow()-1, I+Poles.LowerCol()-1) = CPoles (I);
   }
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1562,6 +1565,7 @@ void Geom_BSplineSurface::SetPole (const Standard_Integer UIndex,
 				   const gp_Pnt&          P)
 {
   poles->SetValue (UIndex+poles->LowerRow()-1, VIndex+poles->LowerCol()-1, P);
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -1617,6 +1621,7 @@ void Geom_BSplineSurface::MovePoint(const Standard_Real U,
     poles->ChangeArray2() = npoles;
   }
   maxderivinvok = 0;
+  InvalidateCache();
 }
 
 //=======================================================================
@@ -687,6 +687,142 @@ void Geom2dAdaptor_Curve::D1(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void Geom2dAdaptor_Curve::D0Array (const TColStd_Array1OfReal& theParams,
+                                   TColgp_Array1OfPnt2d&       thePoints) const
+{
+  switch (myTypeCurve)
+  {
+  case GeomAbs_BezierCurve:
+  case GeomAbs_BSplineCurve:
+  {
+    // process the parameters by runs covered by one span of the cache
+    Standard_Integer aStart = 0, aFinish = 0;
+    for (Standard_Integer i = theParams.Lower(), anEnd = i; i <= theParams.Upper(); i = anEnd + 1)
+    {
+      anEnd = i;
+      if (IsBoundary (theParams (i), aStart, aFinish))
+      {
+        myBSplineCurve->LocalD0 (theParams (i), aStart, aFinish, thePoints (i));
+        continue;
+      }
+      if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid (theParams (i)))
+        RebuildCache (theParams (i));
+      for (; anEnd < theParams.Upper() && myCurveCache->IsCacheValid (theParams (anEnd + 1))
+          && (myBSplineCurve.IsNull()
+           || (theParams (anEnd + 1) != myFirst && theParams (anEnd + 1) != myLast)); ++anEnd) {}
+      myCurveCache->D0Array (theParams, i, anEnd, thePoints);
+    }
+    break;
+  }
+
+  case GeomAbs_Line:
+  {
+    const gp_Lin2d aLin = Line();
+    const gp_XY& aLoc = aLin.Location().XY();
+    const gp_XY& aDir = aLin.Direction().XY();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      thePoints (i).SetXY (aLoc + aDir * theParams (i));
+    break;
+  }
+
+  case GeomAbs_Circle:
+  {
+    const gp_Circ2d aCirc = Circle();
+    const gp_XY& aLoc = aCirc.Location().XY();
+    const gp_XY aXDir = aCirc.Position().XDirection().XY() * aCirc.Radius();
+    const gp_XY aYDir = aCirc.Position().YDirection().XY() * aCirc.Radius();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      thePoints (i).SetXY (aLoc + aXDir * Cos (theParams (i)) + aYDir * Sin (theParams (i)));
+    break;
+  }
+
+  case GeomAbs_OffsetCurve:
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      myNestedEvaluator->D0 (theParams (i), thePoints (i));
+    break;
+
+  default:
+    Adaptor2d_Curve2d::D0Array (theParams, thePoints);
+  }
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void Geom2dAdaptor_Curve::D1Array (const TColStd_Array1OfReal& theParams,
+                                   TColgp_Array1OfPnt2d&       thePoints,
+                                   TColgp_Array1OfVec2d&       theD1) const
+{
+  switch (myTypeCurve)
+  {
+  case GeomAbs_BezierCurve:
+  case GeomAbs_BSplineCurve:
+  {
+    // derivatives on the bounds are computed on the bounding spans, see D1()
+    Standard_Integer aStart = 0, aFinish = 0;
+    for (Standard_Integer i = theParams.Lower(), anEnd = i; i <= theParams.Upper(); i = anEnd + 1)
+    {
+      anEnd = i;
+      if (IsBoundary (theParams (i), aStart, aFinish))
+      {
+        myBSplineCurve->LocalD1 (theParams (i), aStart, aFinish, thePoints (i), theD1 (i));
+        continue;
+      }
+      if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid (theParams (i)))
+        RebuildCache (theParams (i));
+      for (; anEnd < theParams.Upper() && myCurveCache->IsCacheValid (theParams (anEnd + 1))
+          && (myBSplineCurve.IsNull()
+           || (theParams (anEnd + 1) != myFirst && theParams (anEnd + 1) != myLast)); ++anEnd) {}
+      myCurveCache->D1Array (theParams, i, anEnd, thePoints, theD1);
+    }
+    break;
+  }
+
+  case GeomAbs_Line:
+  {
+    const gp_Lin2d aLin = Line();
+    const gp_XY& aLoc = aLin.Location().XY();
+    const gp_Vec2d aDir (aLin.Direction());
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+    {
+      thePoints (i).SetXY (aLoc + aDir.XY() * theParams (i));
+      theD1 (i) = aDir;
+    }
+    break;
+  }
+
+  case GeomAbs_Circle:
+  {
+    const gp_Circ2d aCirc = Circle();
+    const gp_XY& aLoc = aCirc.Location().XY();
+    const gp_XY aXDir = aCirc.Position().XDirection().XY() * aCirc.Radius();
+    const gp_XY aYDir = aCirc.Position().YDirection().XY() * aCirc.Radius();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+    {
+      const Standard_Real aCos = Cos (theParams (i)), aSin = Sin (theParams (i));
+      thePoints (i).SetXY (aLoc + aXDir * aCos + aYDir * aSin);
+      theD1 (i).SetXY (aYDir * aCos - aXDir * aSin);
+    }
+    break;
+  }
+
+  case GeomAbs_OffsetCurve:
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      myNestedEvaluator->D1 (theParams (i), thePoints (i), theD1 (i));
+    break;
+
+  default:
+    Adaptor2d_Curve2d::D1Array (theParams, thePoints, theD1);
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
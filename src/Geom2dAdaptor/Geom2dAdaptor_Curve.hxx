@@ -118,6 +118,15 @@ public:
   //! is not C1.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt2d& P, gp_Vec2d& V) const Standard_OVERRIDE;
   
+  //! Computes the points of parameters <theParams>, see Adaptor2d_Curve2d::D0Array().
+  //! B-spline and Bezier curves are evaluated by runs of parameters
+  //! falling into one span, so that the cache is built once per run.
+  Standard_EXPORT void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of parameters
+  //! <theParams>, see D0Array().
+  Standard_EXPORT void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt2d& thePoints, TColgp_Array1OfVec2d& theD1) const Standard_OVERRIDE;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
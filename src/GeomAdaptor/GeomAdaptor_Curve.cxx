@@ -182,6 +182,10 @@ void GeomAdaptor_Curve::load(const Handle(Geom_Curve)& C,
       myTypeCurve = GeomAbs_OtherCurve;
     }
   }
+
+  // fetched on each load as the curve might be modified since the previous one
+  myMultiSpanCache = !myBSplineCurve.IsNull() ? myBSplineCurve->MultiSpanCache()
+                                              : Handle(BSplCLib_MultiSpanCache)();
 }
 
 //    --
@@ -543,6 +547,12 @@ void GeomAdaptor_Curve::RebuildCache(const Standard_Real theParameter) const
 }
   else if (myTypeCurve == GeomAbs_BSplineCurve)
 {
+    if (!myMultiSpanCache.IsNull())
+    {
+      // take the prebuilt cache of the span, it is shared and must not be rebuilt
+      myCurveCache = myMultiSpanCache->Cache (theParameter);
+      return;
+    }
     // Create cache for B-spline
     if (myCurveCache.IsNull())
       myCurveCache = new BSplCLib_Cache(myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
@@ -667,6 +677,142 @@ void GeomAdaptor_Curve::D1(const Standard_Real U, gp_Pnt& P, gp_Vec& V) const
 }
 }
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D0Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt&         thePoints) const
+{
+  switch (myTypeCurve)
+  {
+  case GeomAbs_BezierCurve:
+  case GeomAbs_BSplineCurve:
+  {
+    // process the parameters by runs covered by one span of the cache
+    Standard_Integer aStart = 0, aFinish = 0;
+    for (Standard_Integer i = theParams.Lower(), anEnd = i; i <= theParams.Upper(); i = anEnd + 1)
+    {
+      anEnd = i;
+      if (IsBoundary (theParams (i), aStart, aFinish))
+      {
+        myBSplineCurve->LocalD0 (theParams (i), aStart, aFinish, thePoints (i));
+        continue;
+      }
+      if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid (theParams (i)))
+        RebuildCache (theParams (i));
+      for (; anEnd < theParams.Upper() && myCurveCache->IsCacheValid (theParams (anEnd + 1))
+          && (myBSplineCurve.IsNull()
+           || (theParams (anEnd + 1) != myFirst && theParams (anEnd + 1) != myLast)); ++anEnd) {}
+      myCurveCache->D0Array (theParams, i, anEnd, thePoints);
+    }
+    break;
+  }
+
+  case GeomAbs_Line:
+  {
+    const gp_Lin aLin = Line();
+    const gp_XYZ& aLoc = aLin.Location().XYZ();
+    const gp_XYZ& aDir = aLin.Direction().XYZ();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      thePoints (i).SetXYZ (aLoc + aDir * theParams (i));
+    break;
+  }
+
+  case GeomAbs_Circle:
+  {
+    const gp_Circ aCirc = Circle();
+    const gp_XYZ& aLoc = aCirc.Location().XYZ();
+    const gp_XYZ aXDir = aCirc.Position().XDirection().XYZ() * aCirc.Radius();
+    const gp_XYZ aYDir = aCirc.Position().YDirection().XYZ() * aCirc.Radius();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      thePoints (i).SetXYZ (aLoc + aXDir * Cos (theParams (i)) + aYDir * Sin (theParams (i)));
+    break;
+  }
+
+  case GeomAbs_OffsetCurve:
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      myNestedEvaluator->D0 (theParams (i), thePoints (i));
+    break;
+
+  default:
+    Adaptor3d_Curve::D0Array (theParams, thePoints);
+  }
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D1Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt&         thePoints,
+                                 TColgp_Array1OfVec&         theD1) const
+{
+  switch (myTypeCurve)
+  {
+  case GeomAbs_BezierCurve:
+  case GeomAbs_BSplineCurve:
+  {
+    // derivatives on the bounds are computed on the bounding spans, see D1()
+    Standard_Integer aStart = 0, aFinish = 0;
+    for (Standard_Integer i = theParams.Lower(), anEnd = i; i <= theParams.Upper(); i = anEnd + 1)
+    {
+      anEnd = i;
+      if (IsBoundary (theParams (i), aStart, aFinish))
+      {
+        myBSplineCurve->LocalD1 (theParams (i), aStart, aFinish, thePoints (i), theD1 (i));
+        continue;
+      }
+      if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid (theParams (i)))
+        RebuildCache (theParams (i));
+      for (; anEnd < theParams.Upper() && myCurveCache->IsCacheValid (theParams (anEnd + 1))
+          && (myBSplineCurve.IsNull()
+           || (theParams (anEnd + 1) != myFirst && theParams (anEnd + 1) != myLast)); ++anEnd) {}
+      myCurveCache->D1Array (theParams, i, anEnd, thePoints, theD1);
+    }
+    break;
+  }
+
+  case GeomAbs_Line:
+  {
+    const gp_Lin aLin = Line();
+    const gp_XYZ& aLoc = aLin.Location().XYZ();
+    const gp_Vec aDir (aLin.Direction());
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+    {
+      thePoints (i).SetXYZ (aLoc + aDir.XYZ() * theParams (i));
+      theD1 (i) = aDir;
+    }
+    break;
+  }
+
+  case GeomAbs_Circle:
+  {
+    const gp_Circ aCirc = Circle();
+    const gp_XYZ& aLoc = aCirc.Location().XYZ();
+    const gp_XYZ aXDir = aCirc.Position().XDirection().XYZ() * aCirc.Radius();
+    const gp_XYZ aYDir = aCirc.Position().YDirection().XYZ() * aCirc.Radius();
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+    {
+      const Standard_Real aCos = Cos (theParams (i)), aSin = Sin (theParams (i));
+      thePoints (i).SetXYZ (aLoc + aXDir * aCos + aYDir * aSin);
+      theD1 (i).SetXYZ (aYDir * aCos - aXDir * aSin);
+    }
+    break;
+  }
+
+  case GeomAbs_OffsetCurve:
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+      myNestedEvaluator->D1 (theParams (i), thePoints (i), theD1 (i));
+    break;
+
+  default:
+    Adaptor3d_Curve::D1Array (theParams, thePoints, theD1);
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
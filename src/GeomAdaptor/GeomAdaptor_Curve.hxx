@@ -24,6 +24,7 @@
 #include <GeomAbs_CurveType.hxx>
 #include <Standard_Real.hxx>
 #include <BSplCLib_Cache.hxx>
+#include <BSplCLib_MultiSpanCache.hxx>
 #include <Adaptor3d_Curve.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
@@ -125,6 +126,15 @@ public:
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const Standard_OVERRIDE;
   
+  //! Computes the points of parameters <theParams>, see Adaptor3d_Curve::D0Array().
+  //! B-spline and Bezier curves are evaluated by runs of parameters
+  //! falling into one span, so that the cache is built once per run.
+  Standard_EXPORT void D0Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of parameters
+  //! <theParams>, see D0Array().
+  Standard_EXPORT void D1Array (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1) const Standard_OVERRIDE;
+  
 
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
@@ -240,6 +250,7 @@ private:
   
   Handle(Geom_BSplineCurve) myBSplineCurve; ///< B-spline representation to prevent castings
   mutable Handle(BSplCLib_Cache) myCurveCache; ///< Cached data for B-spline or Bezier curve
+  Handle(BSplCLib_MultiSpanCache) myMultiSpanCache; ///< Cached data for all spans of B-spline curve shared with other adaptors
   Handle(GeomEvaluator_Curve) myNestedEvaluator; ///< Calculates value of offset curve
 
 
@@ -200,6 +200,10 @@ void GeomAdaptor_Surface::load(const Handle(Geom_Surface)& S,
     else
       mySurfaceType = GeomAbs_OtherSurface;
   }
+
+  // fetched on each load as the surface might be modified since the previous one
+  myMultiSpanCache = !myBSplineSurface.IsNull() ? myBSplineSurface->MultiSpanCache()
+                                                : Handle(BSplSLib_MultiSpanCache)();
 }
 
 //    --
@@ -572,6 +576,22 @@ Handle(Adaptor3d_HSurface) GeomAdaptor_Surface::VTrim(const Standard_Real First,
     (new GeomAdaptor_HSurface(mySurface,myUFirst,myULast,First,Last,myTolU,Tol));
 }
 
+//=======================================================================
+//function : ShallowCopy
+//purpose  : 
+//=======================================================================
+
+Handle(Adaptor3d_HSurface) GeomAdaptor_Surface::ShallowCopy() const
+{
+  if (mySurface.IsNull())
+  {
+    return new GeomAdaptor_HSurface();
+  }
+  // loading creates new adaptors for the nested curves and surfaces
+  // and leaves the span cache empty; the shared multi-span cache is reused
+  return new GeomAdaptor_HSurface (mySurface, myUFirst, myULast, myVFirst, myVLast, myTolU, myTolV);
+}
+
 //=======================================================================
 //function : IsUClosed
 //purpose  : 
@@ -676,6 +696,12 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU,
   }
   else if (mySurfaceType == GeomAbs_BSplineSurface)
   {
+    if (!myMultiSpanCache.IsNull())
+    {
+      // take the prebuilt cache of the span, it is shared and must not be rebuilt
+      mySurfaceCache = myMultiSpanCache->Cache (theU, theV);
+      return;
+    }
     // Create cache for B-spline
     if (mySurfaceCache.IsNull())
       mySurfaceCache = new BSplSLib_Cache(
@@ -778,6 +804,180 @@ void GeomAdaptor_Surface::D1(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt&         thePoints) const
+{
+  if (theU.IsEmpty() || theV.IsEmpty())
+    return;
+
+  switch (mySurfaceType)
+  {
+  case GeomAbs_BezierSurface:
+  case GeomAbs_BSplineSurface:
+  {
+    // process the grid by patches covered by one span of the cache
+    for (Standard_Integer i = theU.Lower(), anUEnd = i; i <= theU.Upper(); i = anUEnd + 1)
+    {
+      for (Standard_Integer j = theV.Lower(), aVEnd = j; j <= theV.Upper(); j = aVEnd + 1)
+      {
+        if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (theU (i), theV (j)))
+          RebuildCache (theU (i), theV (j));
+        for (anUEnd = i; anUEnd < theU.Upper()
+          && mySurfaceCache->IsCacheValid (theU (anUEnd + 1), theV (j)); ++anUEnd) {}
+        for (aVEnd = j; aVEnd < theV.Upper()
+          && mySurfaceCache->IsCacheValid (theU (i), theV (aVEnd + 1)); ++aVEnd) {}
+        mySurfaceCache->D0Grid (theU, i, anUEnd, theV, j, aVEnd, thePoints);
+      }
+    }
+    break;
+  }
+
+  case GeomAbs_Plane:
+  {
+    const gp_Ax3 aPos = Handle(Geom_Plane)::DownCast (mySurface)->Position();
+    const gp_XYZ& aYDir = aPos.YDirection().XYZ();
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    {
+      const gp_XYZ aLine = aPos.Location().XYZ() + aPos.XDirection().XYZ() * theU (i);
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+        thePoints (i, j).SetXYZ (aLine + aYDir * theV (j));
+    }
+    break;
+  }
+
+  case GeomAbs_Cylinder:
+  {
+    const gp_Cylinder aCyl = Handle(Geom_CylindricalSurface)::DownCast (mySurface)->Cylinder();
+    const gp_Ax3& aPos = aCyl.Position();
+    const gp_XYZ& aZDir = aPos.Direction().XYZ();
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    {
+      const gp_XYZ aLine = aPos.Location().XYZ()
+                         + (aPos.XDirection().XYZ() * Cos (theU (i))
+                          + aPos.YDirection().XYZ() * Sin (theU (i))) * aCyl.Radius();
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+        thePoints (i, j).SetXYZ (aLine + aZDir * theV (j));
+    }
+    break;
+  }
+
+  case GeomAbs_OffsetSurface:
+  case GeomAbs_SurfaceOfExtrusion:
+  case GeomAbs_SurfaceOfRevolution:
+    Standard_NoSuchObject_Raise_if(myNestedEvaluator.IsNull(),
+        "GeomAdaptor_Surface::D0Grid: evaluator is not initialized");
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+        myNestedEvaluator->D0 (theU (i), theV (j), thePoints (i, j));
+    break;
+
+  default:
+    Adaptor3d_Surface::D0Grid (theU, theV, thePoints);
+  }
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt&         thePoints,
+                                  TColgp_Array2OfVec&         theD1U,
+                                  TColgp_Array2OfVec&         theD1V) const
+{
+  if (theU.IsEmpty() || theV.IsEmpty())
+    return;
+
+  switch (mySurfaceType)
+  {
+  case GeomAbs_BezierSurface:
+  case GeomAbs_BSplineSurface:
+  {
+    for (Standard_Integer i = theU.Lower(), anUEnd = i; i <= theU.Upper(); i = anUEnd + 1)
+    {
+      for (Standard_Integer j = theV.Lower(), aVEnd = j; j <= theV.Upper(); j = aVEnd + 1)
+      {
+        if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (theU (i), theV (j)))
+          RebuildCache (theU (i), theV (j));
+        for (anUEnd = i; anUEnd < theU.Upper()
+          && mySurfaceCache->IsCacheValid (theU (anUEnd + 1), theV (j)); ++anUEnd) {}
+        for (aVEnd = j; aVEnd < theV.Upper()
+          && mySurfaceCache->IsCacheValid (theU (i), theV (aVEnd + 1)); ++aVEnd) {}
+        mySurfaceCache->D1Grid (theU, i, anUEnd, theV, j, aVEnd, thePoints, theD1U, theD1V);
+      }
+    }
+    if (myBSplineSurface.IsNull())
+      break;
+
+    // derivatives on the bounds are computed on the bounding spans, see D1()
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    {
+      const Standard_Boolean isUBound = Abs (theU (i) - myUFirst) <= myTolU
+                                     || Abs (theU (i) - myULast)  <= myTolU;
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+      {
+        if (isUBound
+         || Abs (theV (j) - myVFirst) <= myTolV
+         || Abs (theV (j) - myVLast)  <= myTolV)
+          D1 (theU (i), theV (j), thePoints (i, j), theD1U (i, j), theD1V (i, j));
+      }
+    }
+    break;
+  }
+
+  case GeomAbs_Plane:
+  {
+    const gp_Ax3 aPos = Handle(Geom_Plane)::DownCast (mySurface)->Position();
+    const gp_Vec aXDir (aPos.XDirection()), aYDir (aPos.YDirection());
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    {
+      const gp_XYZ aLine = aPos.Location().XYZ() + aXDir.XYZ() * theU (i);
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+      {
+        thePoints (i, j).SetXYZ (aLine + aYDir.XYZ() * theV (j));
+        theD1U (i, j) = aXDir;
+        theD1V (i, j) = aYDir;
+      }
+    }
+    break;
+  }
+
+  case GeomAbs_Cylinder:
+  {
+    const gp_Cylinder aCyl = Handle(Geom_CylindricalSurface)::DownCast (mySurface)->Cylinder();
+    const gp_Ax3& aPos = aCyl.Position();
+    const gp_Vec aZDir (aPos.Direction());
+    for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+    {
+      const Standard_Real aCos = Cos (theU (i)), aSin = Sin (theU (i));
+      const gp_XYZ aLine = aPos.Location().XYZ()
+                         + (aPos.XDirection().XYZ() * aCos
+                          + aPos.YDirection().XYZ() * aSin) * aCyl.Radius();
+      const gp_Vec aTangent ((aPos.YDirection().XYZ() * aCos
+                            - aPos.XDirection().XYZ() * aSin) * aCyl.Radius());
+      for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+      {
+        thePoints (i, j).SetXYZ (aLine + aZDir.XYZ() * theV (j));
+        theD1U (i, j) = aTangent;
+        theD1V (i, j) = aZDir;
+      }
+    }
+    break;
+  }
+
+  default:
+    Adaptor3d_Surface::D1Grid (theU, theV, thePoints, theD1U, theD1V);
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -24,6 +24,7 @@
 #include <GeomAbs_SurfaceType.hxx>
 #include <Standard_Real.hxx>
 #include <BSplSLib_Cache.hxx>
+#include <BSplSLib_MultiSpanCache.hxx>
 #include <Adaptor3d_Surface.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
@@ -120,6 +121,13 @@ public:
   //! If <First> >= <Last>
   Standard_EXPORT Handle(Adaptor3d_HSurface) VTrim (const Standard_Real First, const Standard_Real Last, const Standard_Real Tol) const Standard_OVERRIDE;
   
+  //! Returns a new adaptor on the same surface and bounds
+  //! with its own evaluation cache.
+  Standard_EXPORT Handle(Adaptor3d_HSurface) ShallowCopy() const Standard_OVERRIDE;
+  
+  //! Returns True.
+  virtual Standard_Boolean CanShallowCopy() const Standard_OVERRIDE { return Standard_True; }
+  
   Standard_EXPORT Standard_Boolean IsUClosed() const Standard_OVERRIDE;
   
   Standard_EXPORT Standard_Boolean IsVClosed() const Standard_OVERRIDE;
@@ -147,6 +155,16 @@ public:
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
   
+  //! Computes the points of the grid of parameters <theU> x <theV>.
+  //! B-spline and Bezier surfaces are evaluated by patches of
+  //! the grid placed in the same span, planes and cylinders
+  //! share the terms common for a grid line.
+  Standard_EXPORT void D0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints) const Standard_OVERRIDE;
+  
+  //! Computes the points and the first derivatives of the grid
+  //! of parameters <theU> x <theV>, see D0Grid().
+  Standard_EXPORT void D1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const Standard_OVERRIDE;
+  
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //!
@@ -273,6 +291,7 @@ private:
   
   Handle(Geom_BSplineSurface) myBSplineSurface; ///< B-spline representation to prevent downcasts
   mutable Handle(BSplSLib_Cache) mySurfaceCache; ///< Cached data for B-spline or Bezier surface
+  Handle(BSplSLib_MultiSpanCache) myMultiSpanCache; ///< Cached data for all spans of B-spline surface shared with other adaptors
 
 protected:
   GeomAbs_SurfaceType mySurfaceType;
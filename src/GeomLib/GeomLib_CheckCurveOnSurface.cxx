@@ -32,6 +32,7 @@
 #include <math_PSOParticlesPool.hxx>
 #include <OSD_Parallel.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 
@@ -107,6 +108,37 @@ class GeomLib_CheckCurveOnSurface_TargetFunc :
     return Standard_True;
   }
 
+  //returns values of the one-dimension-function for the array
+  //of parameters theX evaluating the curves at all of them at once;
+  //returns false if any of the values cannot be computed
+  Standard_Boolean Values(const TColStd_Array1OfReal& theX,
+                          TColStd_Array1OfReal& theFVal) const
+  {
+    for (Standard_Integer i = theX.Lower(); i <= theX.Upper(); i++)
+    {
+      if (!CheckParameter(theX(i)))
+        return Standard_False;
+    }
+
+    try
+    {
+      OCC_CATCH_SIGNALS
+      TColgp_Array1OfPnt aP1(theX.Lower(), theX.Upper()),
+                         aP2(theX.Lower(), theX.Upper());
+      myCurve1.D0Array(theX, aP1);
+      myCurve2.D0Array(theX, aP2);
+      for (Standard_Integer i = theX.Lower(); i <= theX.Upper(); i++)
+      {
+        theFVal(i) = -1.0*aP1(i).SquareDistance(aP2(i));
+      }
+    }
+    catch(Standard_Failure) {
+      return Standard_False;
+    }
+    //
+    return Standard_True;
+  }
+
   //see analogical method for abstract owner class math_MultipleVarFunction
   virtual Standard_Integer GetStateNumber()
   {
@@ -714,12 +746,23 @@ Standard_Boolean PSO_Perform(GeomLib_CheckCurveOnSurface_TargetFunc& theFunction
   const Standard_Integer aNbControlPoints = 3*theNbParticles;
 
   const Standard_Real aStep = aDeltaParam/(aNbControlPoints-1);
+  TColStd_Array1OfReal aParams(1, aNbControlPoints), aValues(1, aNbControlPoints);
   Standard_Integer aCount = 1;
   for(Standard_Real aPrm = theParInf(1); aCount <= aNbControlPoints; aCount++,
     aPrm = (aCount == aNbControlPoints)? theParSup(1) : aPrm+aStep)
   {
+    aParams(aCount) = aPrm;
+  }
+
+  // evaluate the control points at once, point by point if it fails
+  const Standard_Boolean isComputed = theFunction.Values(aParams, aValues);
+  for(aCount = 1; aCount <= aNbControlPoints; aCount++)
+  {
+    const Standard_Real aPrm = aParams(aCount);
     Standard_Real aVal = RealLast();
-    if(!theFunction.Value(aPrm, aVal))
+    if (isComputed)
+      aVal = aValues(aCount);
+    else if(!theFunction.Value(aPrm, aVal))
       continue;
 
     PSO_Particle* aParticle = aParticles.GetWorstParticle();
@@ -50,6 +50,8 @@
 #include <GeomAdaptor_HSurface.hxx>
 #include <GeomAdaptor_Curve.hxx>
 #include <Geom2dAdaptor_Curve.hxx>
+#include <BSplCLib_MultiSpanCache.hxx>
+#include <BSplSLib_MultiSpanCache.hxx>
 
 #include <TColGeom_Array2OfBezierSurface.hxx>
 #include <TColgp_Array1OfPnt.hxx>
@@ -1425,6 +1427,57 @@ static Standard_Integer compBsplSur (Draw_Interpretor& , Standard_Integer n, con
   return 0;
 }
 
+//=======================================================================
+//function : multispancache
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer multispancache (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n == 3 && !strcmp (a[1], "-nbspans"))
+  {
+    // the cache is built by this call if the limit allows it
+    Handle(Geom_BSplineCurve)   aCurve   = DrawTrSurf::GetBSplineCurve (a[2]);
+    Handle(Geom_BSplineSurface) aSurface = DrawTrSurf::GetBSplineSurface (a[2]);
+    Standard_Integer aNbSpans = 0;
+    if (!aCurve.IsNull())
+    {
+      Handle(BSplCLib_MultiSpanCache) aCache = aCurve->MultiSpanCache();
+      aNbSpans = aCache.IsNull() ? 0 : aCache->NbSpans();
+    }
+    else if (!aSurface.IsNull())
+    {
+      Handle(BSplSLib_MultiSpanCache) aCache = aSurface->MultiSpanCache();
+      aNbSpans = aCache.IsNull() ? 0 : aCache->NbSpans();
+    }
+    else
+    {
+      di << "Syntax error: " << a[2] << " is not a B-spline curve or surface\n";
+      return 1;
+    }
+    di << aNbSpans;
+    return 0;
+  }
+  else if (n > 3)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  if (n > 1)
+  {
+    // parsed as real to accept limits beyond the range of Standard_Integer
+    const Standard_Real aCurveLimit   = Draw::Atof (a[1]);
+    const Standard_Real aSurfaceLimit = n > 2 ? Draw::Atof (a[2]) : aCurveLimit;
+    BSplCLib_MultiSpanCache::SetMemoryLimit (aCurveLimit   > 0.0 ? (Standard_Size )aCurveLimit   : 0);
+    BSplSLib_MultiSpanCache::SetMemoryLimit (aSurfaceLimit > 0.0 ? (Standard_Size )aSurfaceLimit : 0);
+  }
+
+  di << Standard_Real (BSplCLib_MultiSpanCache::MemoryLimit()) << " "
+     << Standard_Real (BSplSLib_MultiSpanCache::MemoryLimit());
+  return 0;
+}
+
 //=======================================================================
 //function : setuvorigin
 //purpose  : 
@@ -1820,6 +1873,17 @@ void  GeomliteTest::SurfaceCommands(Draw_Interpretor& theCommands)
                   __FILE__,
 		  surface_radius,g);
   theCommands.Add("compBsplSur","BsplSurf1 BSplSurf2",__FILE__,compBsplSur,g);
+
+  theCommands.Add("multispancache",
+                  "multispancache [curveLimit [surfaceLimit]]"
+                  "\n\t\t: Sets the memory limits (in bytes) of the polynomial cache of all spans"
+                  "\n\t\t: of a B-spline curve and surface shared by adaptors; zero disables the cache."
+                  "\n\t\t: Returns the current limits."
+                  "\nmultispancache -nbspans name"
+                  "\n\t\t: Returns the number of spans cached for the B-spline curve or surface,"
+                  "\n\t\t: zero if the cache is disabled or exceeds the limit.",
+                  __FILE__,
+                  multispancache,g);
   
   
 }
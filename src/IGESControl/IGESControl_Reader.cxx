@@ -25,17 +25,31 @@
 #include <IGESToBRep_Actor.hxx>
 #include <Interface_Check.hxx>
 #include <Interface_CheckIterator.hxx>
+#include <Interface_EntityIterator.hxx>
+#include <Interface_Graph.hxx>
+#include <Interface_HGraph.hxx>
 #include <Interface_InterfaceModel.hxx>
 #include <Interface_Macros.hxx>
+#include <Interface_MSG.hxx>
 #include <Interface_ShareFlags.hxx>
 #include <Interface_Static.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_Msg.hxx>
+#include <Message_Printer.hxx>
+#include <Message_ProgressSentry.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TCollection_ExtendedString.hxx>
+#include <TCollection_HAsciiString.hxx>
 #include <TColStd_HSequenceOfInteger.hxx>
+#include <TColStd_ListIteratorOfListOfInteger.hxx>
+#include <TColStd_ListOfInteger.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Transfer_Binder.hxx>
@@ -43,6 +57,8 @@
 #include <Transfer_TransferOutput.hxx>
 #include <Transfer_TransientProcess.hxx>
 #include <TransferBRep.hxx>
+#include <XSAlgo.hxx>
+#include <XSAlgo_AlgoContainer.hxx>
 #include <XSControl_Controller.hxx>
 #include <XSControl_TransferReader.hxx>
 #include <XSControl_WorkSession.hxx>
@@ -62,6 +78,7 @@ IGESControl_Reader::IGESControl_Reader ()
   SetNorm("IGES");
   Standard_Integer onlyvisible = Interface_Static::IVal("read.iges.onlyvisible");
   theReadOnlyVisible = (onlyvisible == 1);
+  theRunParallel = (Interface_Static::IVal("read.iges.parallel.mode") == 1);
 }
 
 
@@ -78,6 +95,7 @@ IGESControl_Reader::IGESControl_Reader
   SetNorm ("IGES");
   Standard_Integer onlyvisible = Interface_Static::IVal("read.iges.onlyvisible");
   theReadOnlyVisible = (onlyvisible == 1);
+  theRunParallel = (Interface_Static::IVal("read.iges.parallel.mode") == 1);
  }
 
 
@@ -129,6 +147,288 @@ Standard_Integer  IGESControl_Reader::NbRootsForTransfer()
   return theroots.Length();
 }
 
+namespace
+{
+  //! Distributes the roots into clusters of roots sharing translatable entities.
+  //! A shared entity is translated once and its result is reused by the next
+  //! roots, thus the roots of one cluster are to be translated in one process.
+  //! The clusters and their roots are sorted in the order of roots.
+  static void IGESControl_ClusterRoots (const TColStd_SequenceOfTransient&        theRoots,
+                                        const Interface_Graph&                    theGraph,
+                                        const Handle(IGESToBRep_Actor)&           theActor,
+                                        NCollection_Vector<TColStd_ListOfInteger>& theClusters)
+  {
+    const Standard_Integer aNbRoots = theRoots.Length();
+    const Standard_Integer aNbEnts  = theGraph.Size();
+    // first root of the cluster of each root (set of roots united by shared entities)
+    NCollection_Array1<Standard_Integer> aFirstRoots (1, aNbRoots);
+    // root which has reached the entity first, and the last root which has visited it
+    NCollection_Array1<Standard_Integer> anOwners (1, aNbEnts), aVisits (1, aNbEnts);
+    anOwners.Init (0);
+    aVisits.Init (0);
+
+    for (Standard_Integer i = 1; i <= aNbRoots; i ++) {
+      aFirstRoots (i) = i;
+      TColStd_SequenceOfTransient aStack;
+      aStack.Append (theRoots.Value (i));
+      aVisits (theGraph.EntityNumber (theRoots.Value (i))) = i;
+      while (!aStack.IsEmpty()) {
+        Handle(Standard_Transient) anEnt = aStack.Last();
+        aStack.Remove (aStack.Length());
+        const Standard_Integer aNum = theGraph.EntityNumber (anEnt);
+        if (theActor->Recognize (anEnt)) {
+          if (anOwners (aNum) == 0)
+            anOwners (aNum) = i;
+          else {
+            // unite the clusters keeping the first root as the representative
+            Standard_Integer aFirst1 = anOwners (aNum), aFirst2 = i;
+            while (aFirstRoots (aFirst1) != aFirst1) aFirst1 = aFirstRoots (aFirst1);
+            while (aFirstRoots (aFirst2) != aFirst2) aFirst2 = aFirstRoots (aFirst2);
+            aFirstRoots (Max (aFirst1, aFirst2)) = Min (aFirst1, aFirst2);
+          }
+        }
+        for (Interface_EntityIterator anIter = theGraph.Shareds (anEnt); anIter.More(); anIter.Next()) {
+          const Standard_Integer aSharedNum = theGraph.EntityNumber (anIter.Value());
+          if (aSharedNum == 0 || aVisits (aSharedNum) == i) continue;
+          aVisits (aSharedNum) = i;
+          aStack.Append (anIter.Value());
+        }
+      }
+    }
+
+    NCollection_Array1<Standard_Integer> aClusterOfRoot (1, aNbRoots);
+    for (Standard_Integer i = 1; i <= aNbRoots; i ++) {
+      Standard_Integer aFirst = i;
+      while (aFirstRoots (aFirst) != aFirst) aFirst = aFirstRoots (aFirst);
+      if (aFirst == i) {
+        aClusterOfRoot (i) = theClusters.Length();
+        theClusters.Append (TColStd_ListOfInteger());
+      }
+      else
+        aClusterOfRoot (i) = aClusterOfRoot (aFirst);
+      theClusters.ChangeValue (aClusterOfRoot (i)).Append (i);
+    }
+  }
+
+  //! Printer keeping the messages sent by the translation of roots in a
+  //! parallel thread, to pass them to the session messenger in the order of roots.
+  class IGESControl_MessageRecorder : public Message_Printer
+  {
+  public:
+
+    IGESControl_MessageRecorder() { myTraceLevel = Message_Trace; }
+
+    virtual void Send (const TCollection_ExtendedString& theString,
+                       const Message_Gravity             theGravity,
+                       const Standard_Boolean            theToPutEol) const Standard_OVERRIDE
+    {
+      RecordedMessage& aMsg = myMessages.Appended();
+      aMsg.Text     = theString;
+      aMsg.Gravity  = theGravity;
+      aMsg.ToPutEol = theToPutEol;
+    }
+
+    //! Returns the number of recorded messages.
+    Standard_Integer NbMessages() const { return myMessages.Length(); }
+
+    //! Sends the recorded messages from theFirst to theLast (0-based) to the messenger.
+    void Replay (const Handle(Message_Messenger)& theMessenger,
+                 const Standard_Integer           theFirst,
+                 const Standard_Integer           theLast) const
+    {
+      for (Standard_Integer i = theFirst; i <= theLast; i ++) {
+        const RecordedMessage& aMsg = myMessages.Value (i);
+        if (aMsg.Text.IsAscii())
+          theMessenger->Send (TCollection_AsciiString (aMsg.Text), aMsg.Gravity, aMsg.ToPutEol);
+        else
+          theMessenger->Send (aMsg.Text, aMsg.Gravity, aMsg.ToPutEol);
+      }
+    }
+
+  private:
+
+    struct RecordedMessage
+    {
+      TCollection_ExtendedString Text;
+      Message_Gravity            Gravity;
+      Standard_Boolean           ToPutEol;
+    };
+
+    mutable NCollection_Vector<RecordedMessage> myMessages;
+  };
+
+  //! Sends the header of the translation of a root, as
+  //! XSControl_TransferReader::TransferOne() does for trace levels above 1.
+  void IGESControl_TraceRoot (const Handle(Message_Messenger)&   sout,
+                              const Handle(IGESData_IGESModel)&  theModel,
+                              const Handle(Standard_Transient)& ent)
+  {
+    Standard_Integer num = theModel->Number(ent);
+    Handle(TCollection_HAsciiString) lab = theModel->StringLabel(ent);
+    sout<<"\n*******************************************************************\n";
+    sout << "******           Transferring one Entity                     ******"<<endl;
+    if (!lab.IsNull())
+      sout<<"******    N0 in file : "<<Interface_MSG::Blanks(num,5)<<num
+          <<"      Ident : "<<lab->ToCString()
+          <<  Interface_MSG::Blanks(14 - lab->Length())<<"******\n";
+    sout << "******    Type : "<<theModel->TypeName(ent,Standard_False)
+        <<  Interface_MSG::Blanks((Standard_Integer) (44 - strlen(theModel->TypeName(ent,Standard_False))))
+        <<  "******";
+    sout<<"\n*******************************************************************\n";
+  }
+
+  //! Results of the translation of one root in a parallel thread.
+  struct IGESControl_RootResult
+  {
+    Handle(Transfer_TransientProcess)   Process;      //!< process of the cluster of the root
+    Handle(IGESControl_MessageRecorder) Messages;     //!< messages sent by this process
+    Standard_Integer                    FirstItem;    //!< first binding made for the root in the process
+    Standard_Integer                    LastItem;     //!< last binding made for the root in the process
+    Standard_Integer                    FirstMessage; //!< first message sent for the root
+    Standard_Integer                    LastMessage;  //!< last message sent for the root
+  };
+
+  //! Translates the roots of one cluster in their order by its own actor
+  //! into its own transfer process, and keeps for each root the range of
+  //! the bindings it has made in the process and of the messages it has sent.
+  class IGESControl_RootTransfer
+  {
+  public:
+
+    IGESControl_RootTransfer (const TColStd_SequenceOfTransient&               theRoots,
+                              const NCollection_Vector<TColStd_ListOfInteger>& theClusters,
+                              const Handle(IGESData_IGESModel)&                theModel,
+                              const Handle(Interface_HGraph)&                  theGraph,
+                              const Standard_Integer                           theContinuity,
+                              const Standard_Boolean                           theErrorHandle,
+                              const Standard_Integer                           theTraceLevel,
+                              NCollection_Array1<IGESControl_RootResult>&      theResults)
+    : myRoots (theRoots),
+      myClusters (theClusters),
+      myModel (theModel),
+      myGraph (theGraph),
+      myContinuity (theContinuity),
+      myErrorHandle (theErrorHandle),
+      myTraceLevel (theTraceLevel),
+      myResults (theResults)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      Handle(IGESToBRep_Actor) anActor = new IGESToBRep_Actor;
+      anActor->SetModel (myModel);
+      anActor->SetContinuity (myContinuity);
+      // the session data are prepared once before the parallel translation
+      anActor->SetToPrepareTransfer (Standard_False);
+
+      // the map grows on demand, a cluster usually brings few entities
+      Handle(IGESControl_MessageRecorder) aRecorder = new IGESControl_MessageRecorder;
+      Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess (100);
+      if (myGraph.IsNull())
+        aTP->SetModel (myModel);
+      else
+        aTP->SetGraph (myGraph);
+      aTP->SetActor (anActor);
+      aTP->SetErrorHandle (myErrorHandle);
+      aTP->SetMessenger (new Message_Messenger (aRecorder));
+      aTP->SetTraceLevel (myTraceLevel);
+      for (TColStd_ListIteratorOfListOfInteger anIter (myClusters (theIndex)); anIter.More(); anIter.Next()) {
+        IGESControl_RootResult& aResult = myResults.ChangeValue (anIter.Value());
+        aResult.Process      = aTP;
+        aResult.Messages     = aRecorder;
+        aResult.FirstItem    = aTP->NbMapped() + 1;
+        aResult.FirstMessage = aRecorder->NbMessages();
+        aTP->Transfer (myRoots.Value (anIter.Value()));
+        aResult.LastItem     = aTP->NbMapped();
+        aResult.LastMessage  = aRecorder->NbMessages() - 1;
+      }
+    }
+
+  private:
+    IGESControl_RootTransfer& operator= (const IGESControl_RootTransfer&);
+
+  private:
+    const TColStd_SequenceOfTransient&               myRoots;
+    const NCollection_Vector<TColStd_ListOfInteger>& myClusters;
+    Handle(IGESData_IGESModel)                       myModel;
+    Handle(Interface_HGraph)                         myGraph;
+    Standard_Integer                                 myContinuity;
+    Standard_Boolean                                 myErrorHandle;
+    Standard_Integer                                 myTraceLevel;
+    NCollection_Array1<IGESControl_RootResult>&      myResults;
+  };
+}
+
+//=======================================================================
+//function : TransferRoots
+//purpose  : 
+//=======================================================================
+
+Standard_Integer IGESControl_Reader::TransferRoots()
+{
+  NbRootsForTransfer();
+  const Standard_Integer nb = theroots.Length();
+  const Handle(XSControl_TransferReader) &TR = WS()->TransferReader();
+  Handle(IGESToBRep_Actor) actor = Handle(IGESToBRep_Actor)::DownCast (TR->Actor());
+  if (!theRunParallel || nb < 2 || actor.IsNull())
+    return XSControl_Reader::TransferRoots();
+
+  // The roots sharing translated entities are translated sequentially
+  NCollection_Vector<TColStd_ListOfInteger> aClusters;
+  IGESControl_ClusterRoots (theroots, WS()->Graph(), actor, aClusters);
+  if (aClusters.Length() < 2)
+    return XSControl_Reader::TransferRoots();
+
+  TR->BeginTransfer();
+  ClearShapes();
+  const Handle(Transfer_TransientProcess) &proc = TR->TransientProcess();
+  Handle(IGESData_IGESModel) model = IGESModel();
+
+  // The session data (length unit) are prepared once for all the translations.
+  // The first cluster is translated alone: it initializes the data shared by the
+  // translations (resource file of shape processing), which are then only read
+  // by the parallel threads
+  XSAlgo::AlgoContainer()->PrepareForTransfer();
+  NCollection_Array1<IGESControl_RootResult> aResults (1, nb);
+  IGESControl_RootTransfer aFunctor (theroots, aClusters, model, proc->HGraph(), actor->GetContinuity(),
+                                     proc->ErrorHandle(), proc->TraceLevel(), aResults);
+  aFunctor (0);
+  OSD_Parallel::For (1, aClusters.Length(), aFunctor);
+
+  // Merge the results and the messages in the order of roots, as a sequential transfer would do
+  Standard_Integer nbt = 0;
+  ShapeExtend_Explorer STU;
+  Message_ProgressSentry PS ( proc->GetProgress(), "Root", 0, nb, 1 );
+  for (Standard_Integer i = 1; i <= nb && PS.More(); i ++,PS.Next()) {
+    const IGESControl_RootResult& aResult = aResults (i);
+    Handle(Standard_Transient) start = theroots.Value(i);
+    if (proc->TraceLevel() > 1)
+      IGESControl_TraceRoot (proc->Messenger(), model, start);
+    aResult.Messages->Replay (proc->Messenger(), aResult.FirstMessage, aResult.LastMessage);
+    for (Standard_Integer j = aResult.FirstItem; j <= aResult.LastItem; j ++) {
+      const Handle(Standard_Transient)& anEnt = aResult.Process->Mapped (j);
+      Handle(Transfer_Binder) aBinder = aResult.Process->MapItem (j);
+      Handle(Transfer_Binder) aFormer = proc->Find (anEnt);
+      if (aFormer.IsNull())
+        proc->Bind (anEnt, aBinder);
+      else
+        aFormer->CCheck()->GetMessages (aBinder->Check());
+    }
+
+    proc->SetRoot (start);
+    Handle(Transfer_Binder) binder = proc->Find (start);
+    if (binder.IsNull()) continue;
+    TR->RecordResult (start);
+    if (!binder->HasResult()) continue;
+
+    TopoDS_Shape sh = TR->ShapeResult(start);
+    if (STU.ShapeType(sh,Standard_True) == TopAbs_SHAPE) continue;  // nulle-vide
+    Shapes().Append(sh);
+    nbt ++;
+  }
+  return nbt;
+}
+
 //  ####    Reliquat de methodes a reprendre    ####
 
 //=======================================================================
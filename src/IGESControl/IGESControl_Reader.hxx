@@ -85,6 +85,13 @@ public:
   
     Standard_Boolean GetReadVisible() const;
   
+  //! Allows or forbids translation of the roots in parallel threads
+  //! by TransferRoots(); the default value is taken from the
+  //! static parameter "read.iges.parallel.mode"
+    void SetRunParallel (const Standard_Boolean theToRunParallel);
+  
+    Standard_Boolean GetRunParallel() const;
+  
   //! Returns the model as a IGESModel.
   //! It can then be consulted (header, product)
   Standard_EXPORT Handle(IGESData_IGESModel) IGESModel() const;
@@ -94,6 +101,16 @@ public:
   //! <theReadOnlyVisible> is taken into account to define roots
   Standard_EXPORT virtual Standard_Integer NbRootsForTransfer() Standard_OVERRIDE;
   
+  //! Transfers all roots (see XSControl_Reader).
+  //! In parallel mode the roots are distributed into clusters of roots
+  //! sharing translated entities (e.g. subfigure definitions), the roots
+  //! of one cluster being translated sequentially by one actor into one
+  //! transfer process. The clusters are translated concurrently and their
+  //! bindings are merged into the session transfer process in the order
+  //! of the roots, so that the result is the same as in sequential mode;
+  //! the trace messages are kept and sent to the messenger in this order too.
+  Standard_EXPORT virtual Standard_Integer TransferRoots() Standard_OVERRIDE;
+  
   //! Prints Statistics and check list for Transfer
   Standard_EXPORT void PrintTransferInfo (const IFSelect_PrintFail failwarn, const IFSelect_PrintCount mode) const;
 
@@ -111,6 +128,7 @@ private:
 
 
   Standard_Boolean theReadOnlyVisible;
+  Standard_Boolean theRunParallel;
 
 
 };
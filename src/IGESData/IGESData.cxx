@@ -112,6 +112,13 @@ static Handle(IGESData_DefaultSpecific)   speci;
   Interface_Static::Init ("XSTEP","read.iges.faulty.entities",'&',"eval On");
   Interface_Static::SetIVal ("read.iges.faulty.entities",0);
 
+  // parameter for translation of independent roots in parallel threads
+  Interface_Static::Init ("XSTEP","read.iges.parallel.mode",'e',"");
+  Interface_Static::Init ("XSTEP","read.iges.parallel.mode",'&',"ematch 0");
+  Interface_Static::Init ("XSTEP","read.iges.parallel.mode",'&',"eval Off");
+  Interface_Static::Init ("XSTEP","read.iges.parallel.mode",'&',"eval On");
+  Interface_Static::SetIVal ("read.iges.parallel.mode",0);
+
   //ika added parameter for writing planes mode 2.11.2012 
   Interface_Static::Init ("XSTEP","write.iges.plane.mode",'e',"");
   Interface_Static::Init ("XSTEP","write.iges.plane.mode",'&',"ematch 0");
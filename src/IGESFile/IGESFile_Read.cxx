@@ -14,6 +14,7 @@
 // dce 21.01.99 : move of general message to IGESToBRep_Reader
 
 #include <stdio.h>
+#include <string.h>
 // declarations des programmes C de base :
 #include <Interface_ParamType.hxx>
 #include <IGESData_IGESReaderData.hxx>
@@ -39,21 +40,32 @@
 #include <Message_Msg.hxx>
 
 // decoupage interne pour faciliter les recuperations d erreurs
-static Standard_Integer recupne,recupnp;  // pour affichage en cas de pepin
-static Handle(Interface_Check)& checkread()
-{
-  static Handle(Interface_Check) chrd = new Interface_Check;
-  return chrd;
-}
-
-static void IGESFile_ReadHeader  (const Handle(IGESData_IGESReaderData)& IR);
-static void IGESFile_ReadContent (const Handle(IGESData_IGESReaderData)& IR);
-void IGESFile_Check (int mode,Message_Msg& amsg);
-// void IGESFile_Check2 (int mode,char * code, int num, char * str);
-// void IGESFile_Check3 (int mode,char * code);
+// (recupne,recupnp : pour affichage en cas de pepin)
+// Tout l'etat de lecture est local a l'appel (contexte igesread + check) :
+// plusieurs fichiers peuvent etre lus en parallele
+static void IGESFile_ReadHeader  (igesread_context& ctx,
+                                  const Handle(IGESData_IGESReaderData)& IR);
+static void IGESFile_ReadContent (igesread_context& ctx,
+                                  const Handle(IGESData_IGESReaderData)& IR,
+                                  Standard_Integer& recupne,
+                                  Standard_Integer& recupnp);
+static void IGESFile_Check (const Handle(Interface_Check)& theCheck,
+                            int mode, Message_Msg& amsg);
 
 //  Correspondance entre types igesread et types Interface_ParamFile ...
-static Interface_ParamType LesTypes[10];
+static const Interface_ParamType LesTypes[10] =
+{
+  Interface_ParamVoid,     // ArgVide
+  Interface_ParamMisc,     // ArgQuid
+  Interface_ParamText,     // ArgChar
+  Interface_ParamInteger,  // ArgInt
+  Interface_ParamInteger,  // ArgSign
+  Interface_ParamReal,     // ArgReal
+  Interface_ParamMisc,     // ArgExp  : exposant pas termine
+  Interface_ParamReal,     // ArgRexp : exposant complet
+  Interface_ParamEnum,     // ArgMexp : exposant mais pas de point
+  Interface_ParamVoid
+};
 
 
 //  Nouvelle maniere : Protocol suffit
@@ -94,29 +106,28 @@ Standard_Integer IGESFile_Read
   char* ficnom = nomfic; // ficnom ?
   int lesect[6];
   
+  Handle(Interface_Check) checkread = new Interface_Check;
+  igesread_context ctx;
+  memset (&ctx, 0, sizeof(ctx));
+  ctx.check = checkread.get();
+
   // Sending of message : Beginning of the reading
-  IGESFile_Check(2, Msg1);
+  IGESFile_Check(checkread, 2, Msg1);
 
-  checkread()->Clear();
-  int result = igesread(ficnom,lesect,modefnes);
+  checkread->Clear();
+  int result = igesread(&ctx,ficnom,lesect,modefnes);
 
-  if (result != 0) return result;
+  if (result != 0)
+  {
+    iges_finfile(&ctx,0);
+    return result;
+  }
 
 //  Chargement des resultats dans un IGESReader
 
-  LesTypes[ArgVide] = Interface_ParamVoid;
-  LesTypes[ArgQuid] = Interface_ParamMisc;
-  LesTypes[ArgChar] = Interface_ParamText;
-  LesTypes[ArgInt]  = Interface_ParamInteger;
-  LesTypes[ArgSign] = Interface_ParamInteger;
-  LesTypes[ArgReal] = Interface_ParamReal;
-  LesTypes[ArgExp ] = Interface_ParamMisc;  // exposant pas termine
-  LesTypes[ArgRexp] = Interface_ParamReal;       // exposant complet
-  LesTypes[ArgMexp] = Interface_ParamEnum;       // exposant mais pas de point
-
-
+  Standard_Integer recupne = 0, recupnp = 0;
   int nbparts, nbparams;
-  iges_stats(&nbparts,&nbparams);    // et fait les Initialisations necessaires
+  iges_stats(&ctx,&nbparts,&nbparams);    // et fait les Initialisations necessaires
   Handle(IGESData_IGESReaderData) IR =
 //    new IGESData_IGESReaderData (nbparts, nbparams);
     new IGESData_IGESReaderData((lesect[3]+1)/2, nbparams);
@@ -124,19 +135,19 @@ Standard_Integer IGESFile_Read
    {
     try {
       OCC_CATCH_SIGNALS
-      IGESFile_ReadHeader(IR);
+      IGESFile_ReadHeader(ctx,IR);
     }    // fin essai 1 (global)
     catch (Standard_Failure) {
       // Sending of message : Internal error during the header reading 
       Message_Msg Msg11 = Message_Msg("XSTEP_11");
-      IGESFile_Check (1,Msg11);
+      IGESFile_Check (checkread,1,Msg11);
     }
    }
 
    {
     try {
       OCC_CATCH_SIGNALS
-      if (nbparts > 0) IGESFile_ReadContent(IR);
+      if (nbparts > 0) IGESFile_ReadContent(ctx,IR,recupne,recupnp);
 
   // Sending of message : Loaded data  
     }    // fin essai 2 (entites)
@@ -145,13 +156,13 @@ Standard_Integer IGESFile_Read
       if (recupnp == 0) {
 	Message_Msg Msg13 = Message_Msg("XSTEP_13");
 	Msg13.Arg(recupne);
-	IGESFile_Check(1,Msg13);
+	IGESFile_Check(checkread,1,Msg13);
       }
       else {
 	Message_Msg Msg14 = Message_Msg("XSTEP_14");
 	Msg14.Arg(recupne);
 	Msg14.Arg(recupnp);
-	IGESFile_Check(1, Msg14);
+	IGESFile_Check(checkread,1, Msg14);
       }
     }
    }
@@ -160,8 +171,8 @@ Standard_Integer IGESFile_Read
   Standard_Integer nbr = IR->NbRecords();
   // Sending of message : Number of total loaded entities 
   Msg15.Arg(nbr);
-  IGESFile_Check(2, Msg15);
-  iges_finfile(1);
+  IGESFile_Check(checkread,2, Msg15);
+  iges_finfile(&ctx,1);
   IGESData_IGESReaderTool IT (IR,protocol);
   IT.Prepare(reco); 
   IT.SetErrorHandle(Standard_True);
@@ -169,18 +180,18 @@ Standard_Integer IGESFile_Read
   // Sending of message : Loading of Model : Beginning 
   IT.LoadModel(amodel);
   if (amodel->Protocol().IsNull()) amodel->SetProtocol (protocol);
-  iges_finfile(2);
+  iges_finfile(&ctx,2);
 
   //  A present, le check
   // Nb warning in global section.
-  Standard_Integer nbWarn = checkread()->NbWarnings(), nbFail = checkread()->NbFails();
+  Standard_Integer nbWarn = checkread->NbWarnings(), nbFail = checkread->NbFails();
   const Handle(Interface_Check)& oldglob = amodel->GlobalCheck();
   if (nbWarn + nbFail > 0) {
-    checkread()->GetMessages (oldglob);
-    amodel->SetGlobalCheck (checkread());
+    checkread->GetMessages (oldglob);
+    amodel->SetGlobalCheck (checkread);
   }
 
-  checkread()->Trace(0,1);
+  checkread->Trace(0,1);
  
   return 0;
 }
@@ -188,7 +199,8 @@ Standard_Integer IGESFile_Read
 
 // Decoupage interne
 
- void IGESFile_ReadHeader  (const Handle(IGESData_IGESReaderData)& IR)
+ void IGESFile_ReadHeader  (igesread_context& ctx,
+                            const Handle(IGESData_IGESReaderData)& IR)
 {
   Standard_Integer l=0; //szv#4:S4163:12Mar99 i,j,k not needed
   char* parval;
@@ -211,7 +223,7 @@ Standard_Integer IGESFile_Read
     IR->AddGlobal(LesTypes[typarg],parval);
   }
 */
-  while (iges_lirparam(&typarg,&parval) != 0) {
+  while (iges_lirparam(&ctx,&typarg,&parval) != 0) {
     Standard_Integer j; // svv Jan11 2000 : porting on DEC
     for (j = 72; j >= 0; j--)
       if (parval[j] > 32) break;
@@ -220,12 +232,15 @@ Standard_Integer IGESFile_Read
     l++;
   }
   //  puis la Global Section
-  iges_setglobal();
-  while (iges_lirparam(&typarg,&parval) != 0) IR->AddGlobal(LesTypes[typarg],parval);
+  iges_setglobal(&ctx);
+  while (iges_lirparam(&ctx,&typarg,&parval) != 0) IR->AddGlobal(LesTypes[typarg],parval);
   IR->SetGlobalSection();
 }
 
- void IGESFile_ReadContent (const Handle(IGESData_IGESReaderData)& IR)
+ void IGESFile_ReadContent (igesread_context& ctx,
+                            const Handle(IGESData_IGESReaderData)& IR,
+                            Standard_Integer& recupne,
+                            Standard_Integer& recupnp)
 {
   char *res1, *res2, *nom, *num; char* parval;
   int *v; int typarg;
@@ -234,7 +249,7 @@ Standard_Integer IGESFile_Read
 
   Standard_Integer nn=0;
   int ns; //szv#4:S4163:12Mar99 i unused
-  while ( (ns = iges_lirpart(&v,&res1,&res2,&nom,&num,&nbparam)) != 0) {
+  while ( (ns = iges_lirpart(&ctx,&v,&res1,&res2,&nom,&num,&nbparam)) != 0) {
     nn++;
     recupnp = 0;
     recupne = (ns+1)/2;  // numero entite
@@ -245,7 +260,7 @@ Standard_Integer IGESFile_Read
     IR->SetDirPart(recupne,
 		   v[0],v[1],v[2],v[3],v[4],v[5],v[6],v[7],v[8],v[9],v[10],
 		   v[11],v[12],v[13],v[14],v[15],v[16],res1,res2,nom,num);
-    while (iges_lirparam(&typarg,&parval) != 0) { //szv#4:S4163:12Mar99 `i=` not needed
+    while (iges_lirparam(&ctx,&typarg,&parval) != 0) { //szv#4:S4163:12Mar99 `i=` not needed
       recupnp ++;
       if (typarg == ArgInt || typarg == ArgSign) {
 	Standard_Integer nument = atoi(parval);
@@ -257,52 +272,55 @@ Standard_Integer IGESFile_Read
       else IR->AddParam(recupne,parval,LesTypes[typarg]);
     }
     IR->InitParams(recupne);
-    iges_nextpart();
+    iges_nextpart(&ctx);
   }
 }
 
 
-void IGESFile_Check (int mode,Message_Msg& amsg)
+void IGESFile_Check (const Handle(Interface_Check)& theCheck,
+                     int mode, Message_Msg& amsg)
 {
   // MGE 20/07/98
   switch (mode)
    {
-    case 0 : checkread()->SendFail (amsg); break;
-    case 1 : checkread()->SendWarning (amsg); break;
-    case 2 : checkread()->SendMsg (amsg);break;
-    default : checkread()->SendMsg (amsg); 
+    case 0 : theCheck->SendFail (amsg); break;
+    case 1 : theCheck->SendWarning (amsg); break;
+    case 2 : theCheck->SendMsg (amsg);break;
+    default : theCheck->SendMsg (amsg); 
    }
   //checkread().Trace(3,-1);
 }
 
-void IGESFile_Check2 (int mode,char * code, int num, char * str)
+void IGESFile_Check2 (void* check, int mode,char * code, int num, char * str)
 {
   // MGE 20/07/98
   Message_Msg amsg (code);
   amsg.Arg(num);
   amsg.Arg(str);
 
+  Interface_Check* aCheck = static_cast<Interface_Check*> (check);
   switch (mode)
    {
-    case 0 : checkread()->SendFail (amsg); break;
-    case 1 : checkread()->SendWarning (amsg); break;
-    case 2 : checkread()->SendMsg (amsg); break;
-    default : checkread()->SendMsg (amsg); 
+    case 0 : aCheck->SendFail (amsg); break;
+    case 1 : aCheck->SendWarning (amsg); break;
+    case 2 : aCheck->SendMsg (amsg); break;
+    default : aCheck->SendMsg (amsg); 
    }
   //checkread().Trace(3,-1);
 }
 
 
-void IGESFile_Check3 (int mode,char * code)
+void IGESFile_Check3 (void* check, int mode,char * code)
 {
   // MGE 20/07/98
   Message_Msg amsg (code);
+  Interface_Check* aCheck = static_cast<Interface_Check*> (check);
   switch (mode)
    {
-    case 0 : checkread()->SendFail (amsg); break;
-    case 1 : checkread()->SendWarning (amsg); break;
-    case 2 : checkread()->SendMsg (amsg); break;
-    default : checkread()->SendMsg (amsg);
+    case 0 : aCheck->SendFail (amsg); break;
+    case 1 : aCheck->SendWarning (amsg); break;
+    case 2 : aCheck->SendMsg (amsg); break;
+    default : aCheck->SendMsg (amsg);
    }
   //checkread().Trace(3,-1);
 }
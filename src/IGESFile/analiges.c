@@ -16,10 +16,9 @@
 #include <stdlib.h>
 #include "igesread.h"
 
-void iges_newparam(int typarg,int longval, char *parval);
-void iges_newpart(int numsec);
-void iges_curpart(int dnum);
-void iges_addparam(int longval, char* parval);
+void iges_newpart(struct igesread_context* ctx, int numsec);
+void iges_curpart(struct igesread_context* ctx, int dnum);
+void iges_addparam(struct igesread_context* ctx, int longval, char* parval);
 
 #define ArgVide 0
 #define ArgQuid 1
@@ -73,12 +72,12 @@ void IGES_copstr(char *ligne, int depuis, int tant, char* dans)
 }
 
 /*                   Analyse section D                */
-void iges_Dsect (int *Dstat, int numsec, char* ligne)
+void iges_Dsect (struct igesread_context* ctx, int *Dstat, int numsec, char* ligne)
 {
   struct dirpart *curp;
   if (*Dstat == 0) {
-    iges_newpart(numsec);
-    curp = iges_get_curp();
+    iges_newpart(ctx,numsec);
+    curp = iges_get_curp(ctx);
     curp->typ  = IGES_decode(ligne, 0,8);
     curp->poi  = IGES_decode(ligne, 8,8);
     curp->pdef = IGES_decode(ligne,16,8);
@@ -96,7 +95,7 @@ void iges_Dsect (int *Dstat, int numsec, char* ligne)
 #endif
     *Dstat = 1;
   } else if (*Dstat == 1) {
-    curp = iges_get_curp();
+    curp = iges_get_curp(ctx);
     curp->typ2 = IGES_decode(ligne, 0,8);
     curp->epa  = IGES_decode(ligne, 8,8);
     curp->col  = IGES_decode(ligne,16,8);
@@ -117,12 +116,12 @@ void iges_Dsect (int *Dstat, int numsec, char* ligne)
 /*     Lecture section P : preanalyse
        Extraction du numero D et troncature a 64 caracteres  */
 
-void iges_Psect (int numsec, char ligne[80])
+void iges_Psect (struct igesread_context* ctx, int numsec, char ligne[80])
 {
   int dnum;
   dnum = atoi(&ligne[65]);
   ligne[64] = '\0';
-  iges_curpart(dnum);
+  iges_curpart(ctx,dnum);
 #ifdef VERIFPRINT
   printf("Entite P:%d ->D:%d,soit %s\n",numsec,dnum,ligne);
 #else
@@ -141,53 +140,52 @@ void iges_Psect (int numsec, char ligne[80])
           pas fini (un nnnH... pas termine)
 */
 
-static int nbcarH = 0; static int numcar = 0; static int reste = 0;
-/*  reste : 0 cas normal; 1 completer parametre; -1 le sauter  */
-static int typarg;
-/*  +  definitions des types de parametres en tete  */
+/*  Etat porte par le contexte : nbcarH, numcar, reste, typarg
+    reste : 0 cas normal; 1 completer parametre; -1 le sauter
+    typarg : cf definitions des types de parametres en tete  */
 
 
-void iges_param (int *Pstat, char *ligne, char c_separ, char c_fin, int lonlin)
+void iges_param (struct igesread_context* ctx, int *Pstat, char *ligne, char c_separ, char c_fin, int lonlin)
 {
   int i,i0,j; char param[80]; char unpar;
-  if (*Pstat == 0) reste  = 0;
-  if (*Pstat != 2) numcar = 0;
-  if (*Pstat < 3)  nbcarH = 0;
+  if (*Pstat == 0) ctx->reste  = 0;
+  if (*Pstat != 2) ctx->numcar = 0;
+  if (*Pstat < 3)  ctx->nbcarH = 0;
   else {
-    numcar = nbcarH;
-    if (numcar > lonlin) {
-      iges_addparam(lonlin,ligne);
-      nbcarH -= lonlin;   /*  ??? enregistrer ...  ???  */
+    ctx->numcar = ctx->nbcarH;
+    if (ctx->numcar > lonlin) {
+      iges_addparam(ctx,lonlin,ligne);
+      ctx->nbcarH -= lonlin;   /*  ??? enregistrer ...  ???  */
       return;
     } else {
-      iges_addparam(nbcarH,ligne);
-      nbcarH = 0;
+      iges_addparam(ctx,ctx->nbcarH,ligne);
+      ctx->nbcarH = 0;
     }
   }
   i0 = 0;     /*  debut param utile (apres blancs eventuels), par defaut a 0 */
-  typarg = ArgVide;
-  for (i = 0; (unpar = ligne[numcar+i]) != '\0'; i ++) {
+  ctx->typarg = ArgVide;
+  for (i = 0; (unpar = ligne[ctx->numcar+i]) != '\0'; i ++) {
     if (unpar == c_separ) {
       *Pstat = 2;  param[i] = '\0';
 #ifdef VERIFPRINT
-      printf("numcar = %d type %d param: %s ",numcar,typarg,&param[i0]);
+      printf("ctx->numcar = %d type %d param: %s ",ctx->numcar,ctx->typarg,&param[i0]);
 #endif
-      if (reste == 0) iges_newparam(typarg,i-i0+1,&param[i0]);
-      else if (reste > 0) iges_addparam(i-i0+1,&param[i0]);
-      reste = 0;
-      for (j = i+1; (unpar = ligne[numcar+j]) != '\0'; j++) {
-	if (unpar != ' ') { numcar += i+1; return; }
+      if (ctx->reste == 0) iges_newparam(ctx,ctx->typarg,i-i0+1,&param[i0]);
+      else if (ctx->reste > 0) iges_addparam(ctx,i-i0+1,&param[i0]);
+      ctx->reste = 0;
+      for (j = i+1; (unpar = ligne[ctx->numcar+j]) != '\0'; j++) {
+	if (unpar != ' ') { ctx->numcar += i+1; return; }
       }
       *Pstat = 1; return;
     }
     if (unpar == c_fin) {
       *Pstat = 1;  param[i] = '\0';
 #ifdef VERIFPRINT
-      printf("numcar = %d type %d param: %s ",numcar,typarg,&param[i0]);
+      printf("ctx->numcar = %d type %d param: %s ",ctx->numcar,ctx->typarg,&param[i0]);
 #endif
-      if (reste == 0) iges_newparam(typarg,i-i0+1,&param[i0]);
-      else if (reste > 0) iges_addparam(i-i0+1,&param[i0]);
-      reste = 0;
+      if (ctx->reste == 0) iges_newparam(ctx,ctx->typarg,i-i0+1,&param[i0]);
+      else if (ctx->reste > 0) iges_addparam(ctx,i-i0+1,&param[i0]);
+      ctx->reste = 0;
       return;
     }
     param[i] = unpar;
@@ -195,71 +193,71 @@ void iges_param (int *Pstat, char *ligne, char c_separ, char c_fin, int lonlin)
 /*    Type du parametre ? */
 
     if (unpar > 47 && unpar < 58) {
-      if (typarg == ArgInt) continue;
-      if (typarg == ArgVide) typarg = ArgInt;
-      else if (typarg == ArgExp) typarg = ArgRexp;
+      if (ctx->typarg == ArgInt) continue;
+      if (ctx->typarg == ArgVide) ctx->typarg = ArgInt;
+      else if (ctx->typarg == ArgExp) ctx->typarg = ArgRexp;
     }
 
     else if (unpar == '+' || unpar == '-') {
-      if (typarg == ArgVide) typarg = ArgSign;
-      else if (typarg != ArgExp && typarg != ArgMexp) typarg = ArgQuid;
+      if (ctx->typarg == ArgVide) ctx->typarg = ArgSign;
+      else if (ctx->typarg != ArgExp && ctx->typarg != ArgMexp) ctx->typarg = ArgQuid;
     }
 
     else if (unpar == '.') {
-      if (typarg == ArgVide) typarg = ArgReal;
-      else if (typarg == ArgInt || typarg == ArgSign) typarg = ArgReal;
-      else typarg = ArgQuid;
+      if (ctx->typarg == ArgVide) ctx->typarg = ArgReal;
+      else if (ctx->typarg == ArgInt || ctx->typarg == ArgSign) ctx->typarg = ArgReal;
+      else ctx->typarg = ArgQuid;
     }
 
     else if (unpar == 'E' || unpar == 'e' || unpar == 'D' || unpar == 'd') {
-      if (typarg == ArgReal) typarg = ArgExp;
-      else if (typarg == ArgInt || typarg == ArgSign) typarg = ArgMexp;
-      else typarg = ArgQuid;
+      if (ctx->typarg == ArgReal) ctx->typarg = ArgExp;
+      else if (ctx->typarg == ArgInt || ctx->typarg == ArgSign) ctx->typarg = ArgMexp;
+      else ctx->typarg = ArgQuid;
     }
 
     else if (unpar == 'H') {         /* format Hollerith ? */
-      if (typarg != ArgInt) { typarg = ArgQuid; continue; }
-      typarg = ArgChar;
-      nbcarH = 0;
+      if (ctx->typarg != ArgInt) { ctx->typarg = ArgQuid; continue; }
+      ctx->typarg = ArgChar;
+      ctx->nbcarH = 0;
       for (j = i0; j < i; j++) {
-	if (param[j] > 47 && param[j] < 58) nbcarH = nbcarH*10 + (param[j]-48);
-	else { nbcarH = 0; break; }
+	if (param[j] > 47 && param[j] < 58) ctx->nbcarH = ctx->nbcarH*10 + (param[j]-48);
+	else { ctx->nbcarH = 0; break; }
       }
-      if (numcar+i+nbcarH >= lonlin) {   /* texte a cheval sur +ieurs lignes */
-	for (j = 1; j < lonlin-numcar-i; j++) param[i+j] = ligne[numcar+i+j];
-	param[lonlin-numcar] = '\0';
-	nbcarH = (numcar+i +nbcarH+1 -lonlin);
+      if (ctx->numcar+i+ctx->nbcarH >= lonlin) {   /* texte a cheval sur +ieurs lignes */
+	for (j = 1; j < lonlin-ctx->numcar-i; j++) param[i+j] = ligne[ctx->numcar+i+j];
+	param[lonlin-ctx->numcar] = '\0';
+	ctx->nbcarH = (ctx->numcar+i +ctx->nbcarH+1 -lonlin);
 	*Pstat =3;
 #ifdef VERIFPRINT
-	printf("numcar = %d param: %s ",numcar,param);
+	printf("ctx->numcar = %d param: %s ",ctx->numcar,param);
 #endif
-	iges_newparam(typarg,lonlin-i0,&param[i0]);
-	reste = 1;
+	iges_newparam(ctx,ctx->typarg,lonlin-i0,&param[i0]);
+	ctx->reste = 1;
 	return;
       } else {
-	for (j = 1; j <= nbcarH; j++) param[i+j] = ligne[numcar+i+j];
-        i += nbcarH;
+	for (j = 1; j <= ctx->nbcarH; j++) param[i+j] = ligne[ctx->numcar+i+j];
+        i += ctx->nbcarH;
       }
     }
 
 /*   blanc : leading (facile) ou trailing (chercher la suite), sinon mauvais */
     else if (unpar == ' ') {
-      if (typarg == ArgVide) i0 = i+1;
+      if (ctx->typarg == ArgVide) i0 = i+1;
       else {
-	for (j = i+1; (unpar = ligne[numcar+j]) != '\0' ; j ++) {
+	for (j = i+1; (unpar = ligne[ctx->numcar+j]) != '\0' ; j ++) {
 	  if (unpar == c_separ || unpar == c_fin) break;
-	  if (unpar != ' ')  {  typarg = ArgQuid;  break;  }
+	  if (unpar != ' ')  {  ctx->typarg = ArgQuid;  break;  }
 	}
       }
     }
 
-    else typarg = ArgQuid;   /* caractere non reconnu */
+    else ctx->typarg = ArgQuid;   /* caractere non reconnu */
   }
 /*  Ici, fin de ligne sans separateur : noter parametre en cours !  */
-  *Pstat = 1;  param[i] = '\0'; reste = -1;
+  *Pstat = 1;  param[i] = '\0'; ctx->reste = -1;
 #ifdef VERIFPRINT
-  printf ("Fin de ligne sans separateur, numcar,i : %d %d\n",numcar,i);
-  if (i > i0) printf("numcar = %d type %d param: %s ",numcar,typarg,&param[i0]);
+  printf ("Fin de ligne sans separateur, ctx->numcar,i : %d %d\n",ctx->numcar,i);
+  if (i > i0) printf("ctx->numcar = %d type %d param: %s ",ctx->numcar,ctx->typarg,&param[i0]);
 #endif
-  if (i > i0) iges_newparam(typarg,i-i0+1,&param[i0]);
+  if (i > i0) iges_newparam(ctx,ctx->typarg,i-i0+1,&param[i0]);
 }
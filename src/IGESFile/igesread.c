@@ -15,22 +15,12 @@
 
 /*  Regroupement des sources "C" pour compilation   */ 
 #include <stdio.h>
+#include <stdlib.h>
 #include "igesread.h"
 #include <OSD_OpenFile.hxx>
 
-/*
-void IGESFile_Check21 (int mode,char * code, int num, char * str);
-*/
-void IGESFile_Check3 (int mode,char * code);
-void IGESFile_Check2 (int mode,char * code, int num, char * str);
-
 /*  #include "structiges.c"    ...  fait par analiges qui en a l'usage  ...  */
-void iges_initfile();
-int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes);
-void iges_newparam(int typarg,int longval, char *parval);
-void iges_param(int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
-void iges_Dsect (int *Dstat,int numsec,char* ligne);
-void iges_Psect(int numsec,char ligne[80]);
+/*  prototypes : cf igesread.h (toutes les routines prennent le contexte)  */
 
 
 
@@ -39,6 +29,10 @@ void iges_Psect(int numsec,char ligne[80]);
     Il en resulte un ensemble de donnees (struct C) interrogeables par
     routines ad hoc  (cf igesread.h qui les recapitule pour appel par C++)
 
+    Le fichier est charge en une fois dans ctx->data puis ferme, l'analyse
+    se fait en memoire ; tout l'etat de lecture est dans le contexte <ctx>,
+    qui doit etre mis a zero par l'appelant et libere par iges_finfile
+
     Retourne : 0 si OK, 1 si fichier pas pu etre ouvert
   */
 
@@ -52,7 +46,35 @@ void iges_Psect(int numsec,char ligne[80]);
 static  char sects [] = " SGDPT ";
 
 
-int igesread (char* nomfic, int lesect[6], int modefnes)
+/*  Chargement du fichier complet en memoire (par blocs, lecture standard)  */
+static int iges_loadfile (struct igesread_context* ctx, FILE* lefic)
+{
+  size_t capacity = 0;
+  ctx->data = NULL; ctx->size = ctx->pos = 0; ctx->eof = 0;
+  for (;;) {
+    size_t nbread;
+    if (ctx->size == capacity) {
+      char* newdata;
+      capacity = (capacity == 0 ? 1 << 20 : capacity * 2);
+      newdata = (char*) realloc (ctx->data, capacity);
+      if (newdata == NULL) return -1;
+      ctx->data = newdata;
+    }
+    nbread = fread (ctx->data + ctx->size, 1, capacity - ctx->size, lefic);
+    ctx->size += nbread;
+    if (nbread == 0) break;
+  }
+  return (ferror(lefic) ? -1 : 0);
+}
+
+/*  Liberation du contenu du fichier (les parametres sont dans les pages)  */
+static void iges_freefile (struct igesread_context* ctx)
+{
+  free (ctx->data);
+  ctx->data = NULL; ctx->size = ctx->pos = 0;
+}
+
+int igesread (struct igesread_context* ctx, char* nomfic, int lesect[6], int modefnes)
 {
   /* MGE 16/06/98 */
 
@@ -60,26 +82,29 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
   char str[2];
 
   int Dstat = 0; int Pstat = 0; char c_separ = ','; char c_fin = ';';
-  iges_initfile();
+  iges_initfile(ctx);
   lefic = stdin; i0 = numsec = 0;  numl = 0;
   if (nomfic[0] != '\0') 
     lefic = OSD_OpenFile(nomfic,"r");
   if (lefic == NULL) return -1;    /*  fichier pas pu etre ouvert  */
+  i = iges_loadfile (ctx,lefic);
+  if (lefic != stdin) fclose (lefic);
+  if (i != 0) {  iges_freefile(ctx);  return -1;  }
   for (i = 1; i < 6; i++) lesect[i] = 0;
   for (j = 0; j < 100; j++) ligne[j] = 0;
   for(;;) {
     numl ++;
-    i = iges_lire(lefic,&numsec,ligne,modefnes);
+    i = iges_lire(ctx,&numsec,ligne,modefnes);
     if (i <= 0 || i < i0) {
       if (i  == 0) break;
       /* Sending of message : Syntax error */
       {
         str[1] = '\0';
         str[0] = sects[i0];
-        IGESFile_Check2 (0,"XSTEP_18",numl,str); /* //gka 15 Sep 98: str instead of sects[i0]); */
+        IGESFile_Check2 (ctx->check,0,"XSTEP_18",numl,str); /* //gka 15 Sep 98: str instead of sects[i0]); */
       }
     
-      if (i0 == 0) return -1;
+      if (i0 == 0) {  iges_freefile(ctx);  return -1;  }
       lesect[i0] ++;
       continue;
     }
@@ -88,30 +113,30 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
       /* Sending of message : Syntax error */
       str[1] = '\0';
       str[0] = sects[i0];
-      IGESFile_Check2 (0,"XSTEP_19",numl,str); /* //gka 15 Sep 98: str instead of sects[i0]); */
+      IGESFile_Check2 (ctx->check,0,"XSTEP_19",numl,str); /* //gka 15 Sep 98: str instead of sects[i0]); */
     }
 
     if (i == 1) {                                   /* Start Section (comm.) */
       ligne[72] = '\0';
-      iges_newparam (0,72,ligne);
+      iges_newparam (ctx,0,72,ligne);
     }
     if (i == 2) {                                   /* Header (Global sect) */
-      iges_setglobal();
+      iges_setglobal(ctx);
       for (;;) {
         if (lesect[i] == 1) {    /* Separation specifique */
           int n0 = 0;
           if (ligne[0] != ',') {  c_separ = ligne[2]; n0 = 3;  }
           if (ligne[n0+1] != c_separ) { c_fin = ligne[n0+3]; }
         }
-        iges_param(&Pstat,ligne,c_separ,c_fin,72);
+        iges_param(ctx,&Pstat,ligne,c_separ,c_fin,72);
         if (Pstat != 2) break;
       }
     }
-    if (i == 3) iges_Dsect(&Dstat,numsec,ligne);    /* Directory  (Dsect) */
+    if (i == 3) iges_Dsect(ctx,&Dstat,numsec,ligne);    /* Directory  (Dsect) */
     if (i == 4) {                                   /* Parametres (Psect) */
-      iges_Psect(numsec,ligne);
+      iges_Psect(ctx,numsec,ligne);
       for (;;) {
-        iges_param(&Pstat,ligne,c_separ,c_fin,64);
+        iges_param(ctx,&Pstat,ligne,c_separ,c_fin,64);
         if (Pstat != 2) break;
       }
     }
@@ -119,12 +144,12 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
 
   /* Sending of message : No Terminal Section */
   if (lesect[5] == 0) {
-    IGESFile_Check3 (1, "XSTEP_20");
+    IGESFile_Check3 (ctx->check,1, "XSTEP_20");
     //return -1;
   }
   
 
-  fclose (lefic);
+  iges_freefile (ctx);
 
   return 0;
 }
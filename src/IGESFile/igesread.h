@@ -15,6 +15,7 @@
 
 /* Appel externe aux routines de lecture (en C) */ 
 #include <stdio.h>
+#include <stddef.h>
 
 /*  structiges : */
 struct parlist {
@@ -30,32 +31,98 @@ struct dirpart {
   int numpart;                                           /* n0 en Dsect */
 };
 
+/*                   Declaration d'un parametre IGES (Psect)              */
+struct oneparam {
+  struct oneparam *next;
+  int typarg;
+  char *parval;
+};
+
+#define Maxparts 1000
+struct dirpage {
+  int used;
+  struct dirpage *next;
+  struct dirpart  parts[Maxparts];
+};
+
+#define Maxpar 20000
+struct parpage {    /* une page de parametres ; cf AddParam */
+  struct parpage* next;
+  int             used;
+  struct oneparam params[Maxpar+1];
+};
+
+#define Maxcar 10000
+struct carpage {
+  struct carpage* next;        /*  chainage des pages de caracteres  */
+  int             used;        /*  place deja prise  */
+  char  cars[Maxcar+1];        /*  page de caracteres  */
+};
+
+/*  Contexte de lecture d'un fichier IGES : contenu du fichier, etat de
+    l'analyse et pages allouees pour les entites et les parametres.
+    Chaque lecture a le sien, plusieurs fichiers peuvent etre lus en meme temps */
+struct igesread_context {
+  /*  liriges : contenu du fichier lu en une fois, ligne courante  */
+  char*  data;
+  size_t size;
+  size_t pos;
+  int    eof;
+  int    fautrelire;
+
+  /*  structiges : enregistrement des entites et parametres  */
+  int nbparts;
+  int nbparams;
+  struct parlist  *curlist;
+  struct parlist  *starts;     /*  Start Section du fichier IGES  */
+  struct parlist  *header;     /*  Entete du fichier IGES  */
+  struct dirpart  *curp;
+  struct oneparam *curparam;
+  struct dirpage  *firstpage;
+  struct dirpage  *curpage;
+  int              curnumpart;
+  struct parpage  *oneparpage;
+  struct carpage  *onecarpage;
+  char            *restext;    /*  texte courant  */
+
+  /*  analiges : parametre en cours d'analyse  */
+  int nbcarH;
+  int numcar;
+  int reste;
+  int typarg;
+
+  /*  messages : Interface_Check de la lecture (objet C++)  */
+  void* check;
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-  int  igesread   (char* nomfic,int lesect[6],int modefnes);
+  int  igesread   (struct igesread_context* ctx, char* nomfic,int lesect[6],int modefnes);
 
   /*  structiges : */
   int  iges_lirpart
-   (int* *tabval,char* *res1,char* *res2,char* *nom,char* *num,int* nbparam);
-  void iges_stats    (int* nbpart, int* nbparam);
-  void iges_setglobal ();
-  void iges_nextpart ();
-  int  iges_lirparam (int* typarg,char* *parval);
-  void iges_finfile  (int mode);
-  struct dirpart *iges_get_curp (void);
-
-  void iges_initfile();
-  int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes);
-  void iges_newparam(int typarg,int longval, char *parval);
-  void iges_param(int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
-  void iges_Dsect (int *Dstat,int numsec,char* ligne);
-  void iges_Psect(int numsec,char ligne[80]);
+   (struct igesread_context* ctx,
+    int* *tabval,char* *res1,char* *res2,char* *nom,char* *num,int* nbparam);
+  void iges_stats    (struct igesread_context* ctx, int* nbpart, int* nbparam);
+  void iges_setglobal (struct igesread_context* ctx);
+  void iges_nextpart (struct igesread_context* ctx);
+  int  iges_lirparam (struct igesread_context* ctx, int* typarg,char* *parval);
+  void iges_finfile  (struct igesread_context* ctx, int mode);
+  struct dirpart *iges_get_curp (struct igesread_context* ctx);
+
+  void iges_initfile (struct igesread_context* ctx);
+  int  iges_lire (struct igesread_context* ctx, int *numsec, char ligne[100], int modefnes);
+  void iges_newparam (struct igesread_context* ctx, int typarg,int longval, char *parval);
+  void iges_param (struct igesread_context* ctx,
+                   int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
+  void iges_Dsect (struct igesread_context* ctx, int *Dstat,int numsec,char* ligne);
+  void iges_Psect (struct igesread_context* ctx, int numsec,char ligne[80]);
 
   /* MGE 20/07/98 */
-  void IGESFile_Check2 (int mode,char * code, int num, char * str);
-  void IGESFile_Check3 (int mode,char * code);
+  void IGESFile_Check2 (void* check, int mode,char * code, int num, char * str);
+  void IGESFile_Check3 (void* check, int mode,char * code);
 
 #ifdef __cplusplus
 }
@@ -30,14 +30,29 @@
   Cas d erreur : ligne fausse des le debut -> abandon. Sinon tacher d enjamber
 */
 
-static int iges_fautrelire = 0;
-int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
-/*int iges_lire (lefic,numsec,ligne,modefnes)*/
-/*FILE* lefic; int *numsec; char ligne[100]; int modefnes;*/
+/*  Equivalent de fgets sur le contenu du fichier charge en memoire
+    (ctx->data) : lit au plus n-1 caracteres, s'arrete apres une fin de ligne,
+    retourne NULL si rien n'a pu etre lu ; ctx->eof joue le role de feof  */
+static char* iges_gets (struct igesread_context* ctx, char* s, int n)
+{
+  int i = 0;
+  while (i < n-1) {
+    char c;
+    if (ctx->pos >= ctx->size) { ctx->eof = 1; break; }
+    c = ctx->data[ctx->pos ++];
+    s[i ++] = c;
+    if (c == '\n') break;
+  }
+  if (i == 0) return NULL;
+  s[i] = '\0';
+  return s;
+}
+
+int  iges_lire (struct igesread_context* ctx, int *numsec, char ligne[100], int modefnes)
 {
   int i,result; char typesec;
 /*  int length;*/
-  if (iges_fautrelire == 0)
+  if (ctx->fautrelire == 0)
   {
     if (*numsec == 0)
       ligne[72] = ligne[79] = ' ';
@@ -45,18 +60,18 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
     ligne[0] = '\0'; 
     if(modefnes)
     {
-      if (fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
+      if (iges_gets(ctx,ligne,99) == NULL) /*for kept compatibility with fnes*/
         return 0;
     }
     else
     {
       /* PTV: 21.03.2002 it is neccessary for files that have only `\r` but no `\n` 
               examle file is 919-001-T02-04-CP-VL.iges */
-      while ( fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
+      while ( iges_gets ( ctx, ligne, 2 ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
       {
       }
       
-      if (fgets(&ligne[1],80,lefic) == NULL)
+      if (iges_gets(ctx,&ligne[1],80) == NULL)
         return 0;
     }
     
@@ -66,15 +81,15 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
       
       if(modefnes)
       {
-        if (fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
+        if (iges_gets(ctx,ligne,99) == NULL) /*for kept compatibility with fnes*/
           return 0;
       }
       else
       {
-        while ( fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
+        while ( iges_gets ( ctx, ligne, 2 ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
         {
         }
-        if (fgets(&ligne[1],80,lefic) == NULL)
+        if (iges_gets(ctx,&ligne[1],80) == NULL)
           return 0;
       }
     }
@@ -86,7 +101,7 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
     }
   }
 
-  if (feof(lefic))
+  if (ctx->eof)
     return 0;
 
   {//0x1A is END_OF_FILE for OS DOS and WINDOWS. For other OS we set this rule forcefully.
@@ -98,9 +113,9 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
     }
   }
 
-  iges_fautrelire = 0;
+  ctx->fautrelire = 0;
   if (ligne[0] == '\0' || ligne[0] == '\n' || ligne[0] == '\r')
-    return iges_lire(lefic,numsec,ligne,modefnes); /* 0 */
+    return iges_lire(ctx,numsec,ligne,modefnes); /* 0 */
 
   if (sscanf(&ligne[73],"%d",&result) != 0) {
     *numsec = result;
@@ -166,5 +181,5 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
 
 /*          Pour commander la relecture sur place            */
 
-void iges_arelire()
-{  iges_fautrelire = 1;  }
+void iges_arelire (struct igesread_context* ctx)
+{  ctx->fautrelire = 1;  }
@@ -44,7 +44,7 @@ IMPLEMENT_STANDARD_RTTIEXT(IGESToBRep_Actor,Transfer_ActorOfTransientProcess)
 //purpose  : 
 //=======================================================================
 IGESToBRep_Actor::IGESToBRep_Actor ()
-{  thecontinuity = 0;  theeps = 0.0001;  }
+{  thecontinuity = 0;  theeps = 0.0001;  theprepare = Standard_True;  }
 
 
 //=======================================================================
@@ -77,6 +77,15 @@ Standard_Integer  IGESToBRep_Actor::GetContinuity () const
   return thecontinuity;
 }
 
+//=======================================================================
+//function : SetToPrepareTransfer
+//purpose  : 
+//=======================================================================
+void  IGESToBRep_Actor::SetToPrepareTransfer (const Standard_Boolean toPrepare)
+{
+  theprepare = toPrepare;
+}
+
 //=======================================================================
 //function : Recognize
 //purpose  : 
@@ -164,7 +173,8 @@ Handle(Transfer_Binder) IGESToBRep_Actor::Transfer
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressSentry aPSentry(TP->GetProgress(), "Transfer stage", 0, 2, 1);
 
-    XSAlgo::AlgoContainer()->PrepareForTransfer();
+    if (theprepare)
+      XSAlgo::AlgoContainer()->PrepareForTransfer();
     IGESToBRep_CurveAndSurface CAS;
     CAS.SetModel(mymodel);
     CAS.SetContinuity(thecontinuity);
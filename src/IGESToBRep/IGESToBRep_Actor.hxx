@@ -56,6 +56,12 @@ public:
   //! Return "thecontinuity"
   Standard_EXPORT Standard_Integer GetContinuity() const;
   
+  //! Defines whether Transfer() prepares the session data for the
+  //! translation (see XSAlgo_AlgoContainer::PrepareForTransfer()).
+  //! It is switched off for the actors translating in parallel threads,
+  //! the data being prepared once before. By default it is True.
+  Standard_EXPORT void SetToPrepareTransfer (const Standard_Boolean toPrepare = Standard_True);
+  
   Standard_EXPORT virtual Standard_Boolean Recognize (const Handle(Standard_Transient)& start) Standard_OVERRIDE;
   
   Standard_EXPORT virtual Handle(Transfer_Binder) Transfer (const Handle(Standard_Transient)& start, const Handle(Transfer_TransientProcess)& TP) Standard_OVERRIDE;
@@ -80,6 +86,7 @@ private:
   Handle(Interface_InterfaceModel) themodel;
   Standard_Integer thecontinuity;
   Standard_Real theeps;
+  Standard_Boolean theprepare;
 
 
 };
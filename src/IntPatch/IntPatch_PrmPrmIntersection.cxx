@@ -37,6 +37,9 @@
 #include <IntSurf_ListIteratorOfListOfPntOn2S.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <IntWalk_PWalking.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Handle.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -297,6 +300,133 @@ static void DublicateOfLinesProcessing( const IntWalk_PWalking& thePW,
   }
 }
 
+//=======================================================================
+//class    : IntPatch_SectionWalk
+//purpose  : Marching from the first start point of a section line
+//           of the polyhedral interference
+//=======================================================================
+struct IntPatch_SectionWalk
+{
+  IntPatch_SectionWalk()
+  : StartIndex (0),
+    HasStartPoint (Standard_False),
+    HasBeenAdded (Standard_False)
+  {
+    memset (Params, 0, sizeof(Params));
+    memset (Bounds, 0, sizeof(Bounds));
+  }
+
+  Standard_Integer  StartIndex; //!< index of the start point in the section line, 0 if none
+  Standard_Real     Params[4]; //!< approximate start point (U1, V1, U2, V2)
+  Standard_Real     Bounds[8]; //!< UV-box of the section line on both surfaces
+  Handle(Adaptor3d_HSurface) Surf1; //!< surface copies referenced by the walker
+  Handle(Adaptor3d_HSurface) Surf2;
+  NCollection_Handle<IntWalk_PWalking> Walker;
+  IntSurf_PntOn2S   StartPoint;
+  Standard_Boolean  HasStartPoint;
+  Standard_Boolean  HasBeenAdded;
+};
+
+//=======================================================================
+//function : PerformSectionWalk
+//purpose  : Marching from the first start point of a section line
+//           with a new walker on the surfaces stored in <theWalk>
+//=======================================================================
+static void PerformSectionWalk (IntPatch_SectionWalk& theWalk,
+                                const Standard_Real   theTolTangency,
+                                const Standard_Real   theEpsilon,
+                                const Standard_Real   theDeflection,
+                                const Standard_Real   theIncrement)
+{
+  theWalk.Walker = new IntWalk_PWalking (theWalk.Surf1, theWalk.Surf2, theTolTangency,
+                                         theEpsilon, theDeflection, theIncrement);
+
+  TColStd_Array1OfReal aStartParams (1, 4);
+  for (Standard_Integer i = 0; i < 4; ++i)
+  {
+    aStartParams (i + 1) = theWalk.Params[i];
+  }
+  theWalk.HasStartPoint = theWalk.Walker->PerformFirstPoint (aStartParams, theWalk.StartPoint);
+  if (!theWalk.HasStartPoint)
+  {
+    return;
+  }
+
+  const Standard_Real* aB = theWalk.Bounds;
+  theWalk.Walker->Perform (aStartParams, aB[0], aB[1], aB[2], aB[3], aB[4], aB[5], aB[6], aB[7]);
+  if (!theWalk.Walker->IsDone()
+   || theWalk.Walker->NbPoints() <= 2)
+  {
+    return;
+  }
+
+  //Try to extend the intersection line to the boundary,
+  //if it is possibly
+  theWalk.Walker->PutToBoundary (theWalk.Surf1, theWalk.Surf2);
+  const Standard_Integer aMinNbPoints = 40;
+  if (theWalk.Walker->NbPoints() < aMinNbPoints)
+  {
+    theWalk.HasBeenAdded = theWalk.Walker->SeekAdditionalPoints (theWalk.Surf1, theWalk.Surf2, aMinNbPoints);
+  }
+}
+
+//=======================================================================
+//class    : IntPatch_SectionWalkFunctor
+//purpose  : Walks the section lines independently of each other.
+//           Each walk uses its own copies of the surface adaptors.
+//=======================================================================
+class IntPatch_SectionWalkFunctor
+{
+public:
+
+  IntPatch_SectionWalkFunctor (NCollection_Array1<IntPatch_SectionWalk>& theWalks,
+                               const Handle(Adaptor3d_HSurface)&         theSurf1,
+                               const Handle(Adaptor3d_HSurface)&         theSurf2,
+                               const Standard_Real                       theTolTangency,
+                               const Standard_Real                       theEpsilon,
+                               const Standard_Real                       theDeflection,
+                               const Standard_Real                       theIncrement)
+  : myWalks (theWalks),
+    mySurf1 (theSurf1),
+    mySurf2 (theSurf2),
+    myTolTangency (theTolTangency),
+    myEpsilon (theEpsilon),
+    myDeflection (theDeflection),
+    myIncrement (theIncrement)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    IntPatch_SectionWalk& aWalk = myWalks.ChangeValue (theIndex);
+    if (aWalk.StartIndex == 0)
+    {
+      return;
+    }
+
+    aWalk.Surf1 = mySurf1->ShallowCopy();
+    aWalk.Surf2 = mySurf2->ShallowCopy();
+    if (aWalk.Surf1.IsNull()
+     || aWalk.Surf2.IsNull())
+    {
+      // the point is processed by the shared walker
+      return;
+    }
+    PerformSectionWalk (aWalk, myTolTangency, myEpsilon, myDeflection, myIncrement);
+  }
+
+private:
+  IntPatch_SectionWalkFunctor& operator= (const IntPatch_SectionWalkFunctor&);
+
+private:
+  NCollection_Array1<IntPatch_SectionWalk>& myWalks;
+  Handle(Adaptor3d_HSurface) mySurf1;
+  Handle(Adaptor3d_HSurface) mySurf2;
+  Standard_Real myTolTangency;
+  Standard_Real myEpsilon;
+  Standard_Real myDeflection;
+  Standard_Real myIncrement;
+};
+
 //==================================================================================
 // function : 
 // purpose  : 
@@ -2238,7 +2368,8 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
 
       //----------------------------------------
       // 1.2 For the line "ls" get 2D-bounds U,V for surfaces 1,2
-      //
+      //     and the first start point of the marching
+      NCollection_Array1<IntPatch_SectionWalk> aWalks (1, nbLigSec);
       for(Standard_Integer ls = 1; ls <= nbLigSec; ++ls)
       {
         Standard_Integer nbp = Interference.NbPointsInLine(TabL[ls]);
@@ -2247,12 +2378,6 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
           continue;
         }
         //
-        Standard_Integer *TabPtDep = new Standard_Integer [nbp+1];
-        for(Standard_Integer ilig = 1; ilig <= nbp; ++ilig )
-        {
-          TabPtDep[ilig]=0;
-        }
-        //
         Standard_Real UminLig1,VminLig1,UmaxLig1,VmaxLig1;
         Standard_Real UminLig2,VminLig2,UmaxLig2,VmaxLig2;
         Standard_Real _x,_y,_z;
@@ -2282,6 +2407,56 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
           if(V2<VminLig2) VminLig2=V2;
         }//for( ilig = 2; ilig <= nbp; ilig++ ) { 
         //
+        IntPatch_SectionWalk& aWalk = aWalks.ChangeValue(ls);
+        aWalk.Bounds[0] = UminLig1; aWalk.Bounds[1] = VminLig1;
+        aWalk.Bounds[2] = UminLig2; aWalk.Bounds[3] = VminLig2;
+        aWalk.Bounds[4] = UmaxLig1; aWalk.Bounds[5] = VmaxLig1;
+        aWalk.Bounds[6] = UmaxLig2; aWalk.Bounds[7] = VmaxLig2;
+        // the first start point tried by the loop 1.3 below
+        aWalk.StartIndex = (nbp > 1) ? nbp/2 : 1;
+        Interference.GetLinePoint(TabL[ls], aWalk.StartIndex, _x, _y, _z,
+          aWalk.Params[0], aWalk.Params[1], aWalk.Params[2], aWalk.Params[3],
+          incidence);
+      }
+
+      // With several lines and processors the marching from the first start
+      // point of each line is done in advance in parallel, by a new walker
+      // on copies of the surface adaptors (if they can be copied).
+      // The found lines are checked against already computed ones below
+      // in the same order. Otherwise all start points are processed
+      // by the shared walker when they are reached.
+      const Standard_Boolean isParallelWalk = nbLigSec > 1
+                                          && OSD_Parallel::NbLogicalProcessors() > 1
+                                          && Surf1->CanShallowCopy()
+                                          && Surf2->CanShallowCopy();
+      if (isParallelWalk)
+      {
+        IntPatch_SectionWalkFunctor aFunctor (aWalks, Surf1, Surf2, TolTangency,
+                                              Epsilon, Deflection, Increment);
+        OSD_Parallel::For (1, nbLigSec + 1, aFunctor);
+      }
+
+      for(Standard_Integer ls = 1; ls <= nbLigSec; ++ls)
+      {
+        Standard_Integer nbp = Interference.NbPointsInLine(TabL[ls]);
+        if (!nbp)
+        {
+          continue;
+        }
+        //
+        Standard_Integer *TabPtDep = new Standard_Integer [nbp+1];
+        for(Standard_Integer ilig = 1; ilig <= nbp; ++ilig )
+        {
+          TabPtDep[ilig]=0;
+        }
+        //
+        IntPatch_SectionWalk& aWalk = aWalks.ChangeValue(ls);
+        const Standard_Real UminLig1 = aWalk.Bounds[0], VminLig1 = aWalk.Bounds[1];
+        const Standard_Real UminLig2 = aWalk.Bounds[2], VminLig2 = aWalk.Bounds[3];
+        const Standard_Real UmaxLig1 = aWalk.Bounds[4], VmaxLig1 = aWalk.Bounds[5];
+        const Standard_Real UmaxLig2 = aWalk.Bounds[6], VmaxLig2 = aWalk.Bounds[7];
+        Standard_Real _x,_y,_z;
+        //
         //----------------------------------------
         // 1.3
         Standard_Integer nbps2 = (nbp>3)? (nbp/2) :  1;
@@ -2325,6 +2500,12 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
             Standard_Real U1, U2, V1, V2;
 
             TabPtDep[nbps2] = 1;
+            // the marching from the first start point of the line
+            // may be already done by its own walker
+            const Standard_Boolean isWalked = isParallelWalk
+                                           && nbps2 == aWalk.StartIndex
+                                           && !aWalk.Walker.IsNull();
+            IntWalk_PWalking& aPW = isWalked ? *aWalk.Walker : PW;
             Interference.GetLinePoint(TabL[ls],nbps2,_x,_y,_z,U1,V1,U2,V2,incidence);
 
             StartParams(1) = U1;
@@ -2332,7 +2513,15 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
             StartParams(3) = U2;
             StartParams(4) = V2;
 
-            HasStartPoint = PW.PerformFirstPoint(StartParams,StartPOn2S);
+            if (isWalked)
+            {
+              HasStartPoint = aWalk.HasStartPoint;
+              StartPOn2S = aWalk.StartPoint;
+            }
+            else
+            {
+              HasStartPoint = aPW.PerformFirstPoint(StartParams,StartPOn2S);
+            }
             dminiPointLigne = SeuildPointLigne + SeuildPointLigne;
             if(HasStartPoint)
             {
@@ -2351,34 +2540,40 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
 
               if(dminiPointLigne > SeuildPointLigne)
               {
-                PW.Perform(StartParams, UminLig1, VminLig1, UminLig2, VminLig2,
-                  UmaxLig1, VmaxLig1, UmaxLig2, VmaxLig2);
+                if (!isWalked)
+                {
+                  aPW.Perform(StartParams, UminLig1, VminLig1, UminLig2, VminLig2,
+                    UmaxLig1, VmaxLig1, UmaxLig2, VmaxLig2);
+                }
 
                 //
                 Standard_Boolean bPWIsDone;
                 Standard_Real aD11, aD12, aD21, aD22, aDx;
                 //
-                bPWIsDone=PW.IsDone();
+                bPWIsDone=aPW.IsDone();
 
                 if(bPWIsDone)
                 {
-                  Standard_Boolean hasBeenAdded = Standard_False;
-                  if(PW.NbPoints() > 2 )
+                  Standard_Boolean hasBeenAdded = aWalk.HasBeenAdded && isWalked;
+                  if(aPW.NbPoints() > 2 )
                   {
-                    //Try to extend the intersection line to the boundary,
-                    //if it is possibly
-                    PW.PutToBoundary(Surf1, Surf2);
-
-                    const Standard_Integer aMinNbPoints = 40;
-                    if(PW.NbPoints() < aMinNbPoints)
+                    if (!isWalked)
                     {
-                      hasBeenAdded = PW.SeekAdditionalPoints(Surf1, Surf2, aMinNbPoints);
+                      //Try to extend the intersection line to the boundary,
+                      //if it is possibly
+                      aPW.PutToBoundary(Surf1, Surf2);
+
+                      const Standard_Integer aMinNbPoints = 40;
+                      if(aPW.NbPoints() < aMinNbPoints)
+                      {
+                        hasBeenAdded = aPW.SeekAdditionalPoints(Surf1, Surf2, aMinNbPoints);
+                      }
                     }
                     
-                    Standard_Integer iPWNbPoints = PW.NbPoints(), aNbPointsVer = 0;
+                    Standard_Integer iPWNbPoints = aPW.NbPoints(), aNbPointsVer = 0;
                     RejectLine = Standard_False;
-                    Point3dDebut = PW.Value(1).Value();
-                    Point3dFin = PW.Value(iPWNbPoints).Value();
+                    Point3dDebut = aPW.Value(1).Value();
+                    Point3dFin = aPW.Value(iPWNbPoints).Value();
                     for( ver = 1; (!RejectLine) && (ver<= NbLigCalculee); ++ver)
                     {
                       const Handle(IntPatch_WLine)& verwline = *((Handle(IntPatch_WLine)*)&SLin.Value(ver));
@@ -2414,8 +2609,8 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
                         const gp_Pnt& aPx=verwline->Point(mx).Value();
                         for(m=1; m<iPWNbPoints; ++m)
                         {
-                          const gp_Pnt& aP1=PW.Value(m).Value();
-                          const gp_Pnt& aP2=PW.Value(m+1).Value();
+                          const gp_Pnt& aP1=aPW.Value(m).Value();
+                          const gp_Pnt& aP2=aPW.Value(m+1).Value();
                           gp_Vec aVec12(aP1, aP2);
                           if (aVec12.SquareMagnitude()<1.e-20)
                           {
@@ -2444,7 +2639,7 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
 
                     if(RejectLine)
                     {
-                      DublicateOfLinesProcessing(PW, ver, SLin, RejectLine);
+                      DublicateOfLinesProcessing(aPW, ver, SLin, RejectLine);
                     }
 
                     if(!RejectLine)
@@ -2454,11 +2649,11 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
                       gp_Vec norm1,norm2,d1u,d1v;
                       gp_Pnt ptbid;
                       Standard_Integer indextg;
-                      gp_Vec tgline(PW.TangentAtLine(indextg));
-                      PW.Line()->Value(indextg).ParametersOnS1(locu,locv);
+                      gp_Vec tgline(aPW.TangentAtLine(indextg));
+                      aPW.Line()->Value(indextg).ParametersOnS1(locu,locv);
                       Surf1->D1(locu,locv,ptbid,d1u,d1v);
                       norm1 = d1u.Crossed(d1v);
-                      PW.Line()->Value(indextg).ParametersOnS2(locu,locv);
+                      aPW.Line()->Value(indextg).ParametersOnS2(locu,locv);
                       Surf2->D1(locu,locv,ptbid,d1u,d1v);
                       norm2 = d1u.Crossed(d1v);
                       if( tgline.DotCross(norm2,norm1) >= 0. )
@@ -2473,7 +2668,7 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
                       }
 
                       Standard_Real TolTang = TolTangency;
-                      Handle(IntPatch_WLine) wline = new IntPatch_WLine(PW.Line(),Standard_False,trans1,trans2);
+                      Handle(IntPatch_WLine) wline = new IntPatch_WLine(aPW.Line(),Standard_False,trans1,trans2);
                       wline->EnablePurging(!hasBeenAdded);
                       //the method PutVertexOnLine can reduce the number of points in <wline>
                       IntPatch_RstInt::PutVertexOnLine(wline,Surf1,D1,Surf2,Standard_True,TolTang);
@@ -2485,14 +2680,14 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
                       if(wline->NbVertex() == 0)
                       {
                         IntPatch_Point vtx;
-                        IntSurf_PntOn2S POn2S = PW.Line()->Value(1);
+                        IntSurf_PntOn2S POn2S = aPW.Line()->Value(1);
                         POn2S.Parameters(pu1,pv1,pu2,pv2);
                         vtx.SetValue(Point3dDebut,TolTang,Standard_False);
                         vtx.SetParameters(pu1,pv1,pu2,pv2);
                         vtx.SetParameter(1);
                         wline->AddVertex(vtx);
 
-                        POn2S = PW.Line()->Value(wline->NbPnts());
+                        POn2S = aPW.Line()->Value(wline->NbPnts());
                         POn2S.Parameters(pu1,pv1,pu2,pv2);
                         vtx.SetValue(Point3dFin,TolTang,Standard_False);
                         vtx.SetParameters(pu1,pv1,pu2,pv2);
@@ -2503,8 +2698,8 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_HSurface)& Sur
                       lignetrouvee = Standard_True;
 
                       SeveralWlinesProcessing(Surf1, Surf2, SLin, Periods, trans1, trans2,
-                                              TolTang, Max(PW.MaxStep(0), PW.MaxStep(1)),
-                                              Max(PW.MaxStep(2), PW.MaxStep(3)), wline);
+                                              TolTang, Max(aPW.MaxStep(0), aPW.MaxStep(1)),
+                                              Max(aPW.MaxStep(2), aPW.MaxStep(3)), wline);
 
                       AddWLine(SLin, wline, Deflection);
                       empt = Standard_False;
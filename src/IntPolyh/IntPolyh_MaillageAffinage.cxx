@@ -42,10 +42,13 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
-#include <NCollection_UBTree.hxx>
-#include <NCollection_UBTreeFiller.hxx>
-#include <algorithm>
+#include <BVH_IndexedBoxSet.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+#include <vector>
 
 typedef NCollection_Array1<Standard_Integer> IntPolyh_ArrayOfInteger;
 typedef NCollection_IndexedDataMap
@@ -132,34 +135,49 @@ static
                         Standard_Integer& aI1,
                         Standard_Integer& aI2);
 
-//=======================================================================
-//class : IntPolyh_BoxBndTreeSelector
-//purpose  : Select interfering bounding boxes
-//=======================================================================
-typedef NCollection_UBTree<Standard_Integer, Bnd_Box> IntPolyh_BoxBndTree;
-class IntPolyh_BoxBndTreeSelector : public IntPolyh_BoxBndTree::Selector {
- public:
-  IntPolyh_BoxBndTreeSelector(const Bnd_Box& theBox) : myBox(theBox) {}
-  //
-  virtual Standard_Boolean Reject(const Bnd_Box& theOther) const
-  {
-    return myBox.IsOut(theOther);
-  }
-  //
-  virtual Standard_Boolean Accept(const Standard_Integer &theInd)
-  {
-    myIndices.Append(theInd);
-    return Standard_True;
-  }
-  //
-  const TColStd_ListOfInteger& Indices() const
+namespace
+{
+  //! Number of triangles processed by a single parallel task
+  static const Standard_Integer THE_CHUNK_SIZE = 128;
+
+  //=======================================================================
+  //class : IntPolyh_InterferenceFunctor
+  //purpose  : Finds the triangles of the set interfering with the chunk
+  //           of query boxes; the found indices are sorted per query
+  //=======================================================================
+  class IntPolyh_InterferenceFunctor
   {
-    return myIndices;
-  }
- private:
-  Bnd_Box myBox;
-  TColStd_ListOfInteger myIndices;
-};
+  public:
+
+    IntPolyh_InterferenceFunctor (const BVH_IndexedBoxSet&                               theSet,
+                                  const NCollection_Vector<BVH_Box<Standard_Real, 3> >& theQueries,
+                                  NCollection_Array1<Standard_Integer>&                  theCounts,
+                                  NCollection_Array1<std::vector<Standard_Integer> >&    theResults)
+    : mySet (theSet), myQueries (theQueries), myCounts (theCounts), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theChunk) const
+    {
+      std::vector<Standard_Integer>& aResult = myResults (theChunk);
+      const Standard_Integer aLast = Min ((theChunk + 1) * THE_CHUNK_SIZE, myQueries.Length());
+      for (Standard_Integer aQuery = theChunk * THE_CHUNK_SIZE; aQuery < aLast; ++aQuery)
+      {
+        const size_t aStart = aResult.size();
+        mySet.Select (myQueries (aQuery), aResult);
+        std::sort (aResult.begin() + aStart, aResult.end());
+        myCounts (aQuery) = static_cast<Standard_Integer> (aResult.size() - aStart);
+      }
+    }
+
+  private:
+    IntPolyh_InterferenceFunctor& operator= (const IntPolyh_InterferenceFunctor&);
+
+  private:
+    const BVH_IndexedBoxSet&                               mySet;
+    const NCollection_Vector<BVH_Box<Standard_Real, 3> >& myQueries;
+    NCollection_Array1<Standard_Integer>&                  myCounts;
+    NCollection_Array1<std::vector<Standard_Integer> >&    myResults;
+  };
+}
 
 //=======================================================================
 //function : GetInterferingTriangles
@@ -173,12 +191,10 @@ static
                                IntPolyh_IndexedDataMapOfIntegerArrayOfInteger& theCouples)
 {
   // To find the triangles with interfering bounding boxes
-  // use the algorithm of unbalanced binary tree of overlapping bounding boxes
-  IntPolyh_BoxBndTree aBBTree;
-  NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller(aBBTree);
-  // 1. Fill the tree with the boxes of the triangles from second surface
+  // use the bounding volume hierarchy of the boxes of the second surface
+  Handle(BVH_IndexedBoxSet) aBoxSet = new BVH_IndexedBoxSet();
+  // 1. Fill the set with the boxes of the triangles from second surface
   Standard_Integer i, aNbT2 = theTriangles2.NbItems();
-  Standard_Boolean bAdded = Standard_False;
   for (i = 0; i < aNbT2; ++i) {
     IntPolyh_Triangle& aT = theTriangles2[i];
     if (!aT.IsIntersectionPossible() || aT.IsDegenerated()) {
@@ -186,18 +202,21 @@ static
     }
     //
     const Bnd_Box& aBox = aT.BoundingBox(thePoints2);
-    aTreeFiller.Add(i, aBox);
-    bAdded = Standard_True;
+    if (!aBox.IsVoid()) {
+      aBoxSet->Add(i, aBox);
+    }
   }
   //
-  if (!bAdded)
+  if (aBoxSet->Size() == 0)
     // Intersection is not possible for all triangles in theTriangles2
     return;
 
-  // 2. Shake the tree filler
-  aTreeFiller.Fill();
+  // 2. Build the tree
+  aBoxSet->BVH();
   //
-  // 3. Find boxes interfering with the first triangles
+  // 3. Collect the boxes of the first triangles
+  NCollection_Vector<Standard_Integer> aQueryTriangles;
+  NCollection_Vector<BVH_Box<Standard_Real, 3> > aQueryBoxes;
   Standard_Integer aNbT1 = theTriangles1.NbItems();
   for (i = 0; i < aNbT1; ++i) {
     IntPolyh_Triangle& aT = theTriangles1[i];
@@ -206,23 +225,41 @@ static
     }
     //
     const Bnd_Box& aBox = aT.BoundingBox(thePoints1);
-    //
-    IntPolyh_BoxBndTreeSelector aSelector(aBox);
-    if (!aBBTree.Select(aSelector)) {
-      continue;
+    if (!aBox.IsVoid()) {
+      aQueryTriangles.Append(i);
+      aQueryBoxes.Append(BVH_IndexedBoxSet::ToBVHBox(aBox));
     }
-    //
-    const TColStd_ListOfInteger& aLI = aSelector.Indices();
-    // Sort the indices
-    IntPolyh_ArrayOfInteger anArr(1, aLI.Extent());
-    TColStd_ListIteratorOfListOfInteger aItLI(aLI);
-    for (Standard_Integer j = 1; aItLI.More(); aItLI.Next(), ++j) {
-      anArr(j) = aItLI.Value();
+  }
+  //
+  const Standard_Integer aNbQueries = aQueryBoxes.Length();
+  if (aNbQueries == 0) {
+    return;
+  }
+  //
+  // 4. Find boxes interfering with the first triangles, in parallel by chunks
+  const Standard_Integer aNbChunks = (aNbQueries + THE_CHUNK_SIZE - 1) / THE_CHUNK_SIZE;
+  NCollection_Array1<Standard_Integer> aCounts(0, aNbQueries - 1);
+  NCollection_Array1<std::vector<Standard_Integer> > aResults(0, aNbChunks - 1);
+  IntPolyh_InterferenceFunctor aFunctor(*aBoxSet, aQueryBoxes, aCounts, aResults);
+  OSD_Parallel::For(0, aNbChunks, aFunctor);
+  //
+  // 5. Gather the results in the order of the first triangles
+  for (Standard_Integer aChunk = 0, aQuery = 0; aChunk < aNbChunks; ++aChunk) {
+    const std::vector<Standard_Integer>& aResult = aResults(aChunk);
+    size_t aPos = 0;
+    const Standard_Integer aLast = Min((aChunk + 1) * THE_CHUNK_SIZE, aNbQueries);
+    for (; aQuery < aLast; ++aQuery) {
+      const Standard_Integer aNb = aCounts(aQuery);
+      if (aNb == 0) {
+        continue;
+      }
+      //
+      IntPolyh_ArrayOfInteger anArr(1, aNb);
+      for (Standard_Integer j = 1; j <= aNb; ++j, ++aPos) {
+        anArr(j) = aResult[aPos];
+      }
+      theCouples.Add(aQueryTriangles(aQuery), anArr);
     }
-    //
-    std::sort(anArr.begin(), anArr.end());
-    //
-    theCouples.Add(i, anArr);
   }
 }
 
@@ -348,13 +385,15 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt
   }
   //
   TPoints.Init(aNbU*aNbV);
+  TColgp_Array2OfPnt aGridPnts(Upars.Lower(), Upars.Upper(), Vpars.Lower(), Vpars.Upper());
+  aS->D0Grid(Upars, Vpars, aGridPnts);
   iCnt=0;
   for(i=1; i<=aNbU; ++i){
     bDegI=(aID1==i || aID2==i);
     aU=Upars(i);
     for(j=1; j<=aNbV; ++j){
       aV=Vpars(j);
-      aP=aS->Value(aU, aV);
+      aP=aGridPnts(i, j);
       aP.Coord(aX, aY, aZ);
       IntPolyh_Point& aIP=TPoints[iCnt];
       aIP.Set(aX, aY, aZ, aU, aV);
@@ -1208,17 +1247,8 @@ Standard_Integer IntPolyh_MaillageAffinage::TriContact
   IntPolyh_Point q1, q2, q3;
   IntPolyh_Point e1, e2, e3;
   IntPolyh_Point f1, f2, f3;
-  IntPolyh_Point g1, g2, g3;
-  IntPolyh_Point h1, h2, h3;
   IntPolyh_Point n1, m1;
-  IntPolyh_Point z;
-
-  IntPolyh_Point ef11, ef12, ef13;
-  IntPolyh_Point ef21, ef22, ef23;
-  IntPolyh_Point ef31, ef32, ef33;
-
-  z.SetX(0.0);  z.SetY(0.0);  z.SetZ(0.0);
-
+  IntPolyh_Point anAxis;
 
   p1.SetX(P1.X() - P1.X());  p1.SetY(P1.Y() - P1.Y());  p1.SetZ(P1.Z() - P1.Z());
   p2.SetX(P2.X() - P1.X());  p2.SetY(P2.Y() - P1.Y());  p2.SetZ(P2.Z() - P1.Z());
@@ -1239,44 +1269,29 @@ Standard_Integer IntPolyh_MaillageAffinage::TriContact
   n1.Cross(e1, e2); //normal to the first triangle
   m1.Cross(f1, f2); //normal to the second triangle
 
-  g1.Cross(e1, n1); 
-  g2.Cross(e2, n1);
-  g3.Cross(e3, n1);
-  h1.Cross(f1, m1);
-  h2.Cross(f2, m1);
-  h3.Cross(f3, m1);
-
-  ef11.Cross(e1, f1);
-  ef12.Cross(e1, f2);
-  ef13.Cross(e1, f3);
-  ef21.Cross(e2, f1);
-  ef22.Cross(e2, f2);
-  ef23.Cross(e2, f3);
-  ef31.Cross(e3, f1);
-  ef32.Cross(e3, f2);
-  ef33.Cross(e3, f3);
-  
-  // Now the testing is done
+  // Now the testing is done; the separating axes are computed
+  // one by one, so that most of the couples are rejected early
 
   if (!project6(n1, p1, p2, p3, q1, q2, q3)) return 0; //T2 is not higher or lower than T1
   if (!project6(m1, p1, p2, p3, q1, q2, q3)) return 0; //T1 is not higher of lower than T2
   
-  if (!project6(ef11, p1, p2, p3, q1, q2, q3)) return 0; 
-  if (!project6(ef12, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef13, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef21, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef22, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef23, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef31, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef32, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef33, p1, p2, p3, q1, q2, q3)) return 0;
-
-  if (!project6(g1, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(g2, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(g3, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(h1, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
-  if (!project6(h2, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
-  if (!project6(h3, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
+  const IntPolyh_Point* anEdges1[3] = { &e1, &e2, &e3 };
+  const IntPolyh_Point* anEdges2[3] = { &f1, &f2, &f3 };
+  for (Standard_Integer i = 0; i < 3; ++i) {
+    for (Standard_Integer j = 0; j < 3; ++j) {
+      anAxis.Cross(*anEdges1[i], *anEdges2[j]);
+      if (!project6(anAxis, p1, p2, p3, q1, q2, q3)) return 0;
+    }
+  }
+
+  for (Standard_Integer i = 0; i < 3; ++i) {
+    anAxis.Cross(*anEdges1[i], n1);
+    if (!project6(anAxis, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
+  }
+  for (Standard_Integer j = 0; j < 3; ++j) {
+    anAxis.Cross(*anEdges2[j], m1);
+    if (!project6(anAxis, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
+  }
 
   //Calculation of cosinus angle between two normals
   Standard_Real SqModn1=-1.0;
@@ -2285,6 +2300,75 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleEdgeContact
   }
   return (NbPoints);
 }
+namespace
+{
+  //! Contact of the triangles found by IntPolyh_ContactFunctor
+  struct IntPolyh_Contact
+  {
+    Standard_Integer Triangle;  //!< index of the triangle of the second surface
+    Standard_Real    Angle;     //!< cosine of the angle between the normals of the triangles
+  };
+
+  //=======================================================================
+  //class : IntPolyh_ContactFunctor
+  //purpose  : Checks the contacts of the chunk of the couples of triangles
+  //           with interfering boxes
+  //=======================================================================
+  class IntPolyh_ContactFunctor
+  {
+  public:
+
+    IntPolyh_ContactFunctor (const IntPolyh_MaillageAffinage&                      theTool,
+                             const IntPolyh_IndexedDataMapOfIntegerArrayOfInteger& theCouples,
+                             NCollection_Array1<Standard_Integer>&                 theCounts,
+                             NCollection_Array1<std::vector<IntPolyh_Contact> >&   theResults)
+    : myTool (theTool), myCouples (theCouples), myCounts (theCounts), myResults (theResults) {}
+
+    void operator() (const Standard_Integer theChunk) const
+    {
+      const IntPolyh_ArrayOfTriangles& aTriangles1 = myTool.GetArrayOfTriangles (1);
+      const IntPolyh_ArrayOfTriangles& aTriangles2 = myTool.GetArrayOfTriangles (2);
+      const IntPolyh_ArrayOfPoints&    aPoints1    = myTool.GetArrayOfPoints (1);
+      const IntPolyh_ArrayOfPoints&    aPoints2    = myTool.GetArrayOfPoints (2);
+      std::vector<IntPolyh_Contact>& aResult = myResults (theChunk);
+      const Standard_Integer aLast = Min ((theChunk + 1) * THE_CHUNK_SIZE, myCouples.Extent());
+      for (Standard_Integer anIndex = theChunk * THE_CHUNK_SIZE; anIndex < aLast; ++anIndex)
+      {
+        const IntPolyh_Triangle& aTriangle1 = aTriangles1[myCouples.FindKey (anIndex + 1)];
+        const IntPolyh_Point& aP1 = aPoints1[aTriangle1.FirstPoint()];
+        const IntPolyh_Point& aP2 = aPoints1[aTriangle1.SecondPoint()];
+        const IntPolyh_Point& aP3 = aPoints1[aTriangle1.ThirdPoint()];
+        const size_t aStart = aResult.size();
+        for (IntPolyh_ArrayOfInteger::Iterator anIt (myCouples (anIndex + 1)); anIt.More(); anIt.Next())
+        {
+          const IntPolyh_Triangle& aTriangle2 = aTriangles2[anIt.Value()];
+          IntPolyh_Contact aContact;
+          aContact.Triangle = anIt.Value();
+          aContact.Angle    = -2.0;
+          if (myTool.TriContact (aP1, aP2, aP3,
+                                 aPoints2[aTriangle2.FirstPoint()],
+                                 aPoints2[aTriangle2.SecondPoint()],
+                                 aPoints2[aTriangle2.ThirdPoint()],
+                                 aContact.Angle))
+          {
+            aResult.push_back (aContact);
+          }
+        }
+        myCounts (anIndex) = static_cast<Standard_Integer> (aResult.size() - aStart);
+      }
+    }
+
+  private:
+    IntPolyh_ContactFunctor& operator= (const IntPolyh_ContactFunctor&);
+
+  private:
+    const IntPolyh_MaillageAffinage&                      myTool;
+    const IntPolyh_IndexedDataMapOfIntegerArrayOfInteger& myCouples;
+    NCollection_Array1<Standard_Integer>&                 myCounts;
+    NCollection_Array1<std::vector<IntPolyh_Contact> >&   myResults;
+  };
+}
+
 //=======================================================================
 //function : TriangleCompare
 //purpose  : Analyze  each couple of  triangles from the two --
@@ -2303,32 +2387,32 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare ()
     return 0;
   }
   //
-  Standard_Real CoupleAngle = -2.0;
+  // Intersection of the triangles, in parallel by chunks
+  const Standard_Integer aNb = aDMILI.Extent();
+  const Standard_Integer aNbChunks = (aNb + THE_CHUNK_SIZE - 1) / THE_CHUNK_SIZE;
+  NCollection_Array1<Standard_Integer> aCounts(0, aNb - 1);
+  NCollection_Array1<std::vector<IntPolyh_Contact> > aResults(0, aNbChunks - 1);
+  IntPolyh_ContactFunctor aFunctor(*this, aDMILI, aCounts, aResults);
+  OSD_Parallel::For(0, aNbChunks, aFunctor);
   //
-  // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
-  for (i = 1; i <= aNb; ++i) {
-    const Standard_Integer i_S1 = aDMILI.FindKey(i);
-    IntPolyh_Triangle &Triangle1 =  TTriangles1[i_S1];
-    const IntPolyh_Point& P1 = TPoints1[Triangle1.FirstPoint()];
-    const IntPolyh_Point& P2 = TPoints1[Triangle1.SecondPoint()];
-    const IntPolyh_Point& P3 = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const IntPolyh_ArrayOfInteger& aLI2 = aDMILI(i);
-    IntPolyh_ArrayOfInteger::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next()) {
-      const Standard_Integer i_S2 = aItLI.Value();
-      IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
-      const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
+  // Gather the couples in the order of the triangles
+  for (Standard_Integer aChunk = 0, i = 0; aChunk < aNbChunks; ++aChunk) {
+    const std::vector<IntPolyh_Contact>& aResult = aResults(aChunk);
+    size_t aPos = 0;
+    const Standard_Integer aLast = Min((aChunk + 1) * THE_CHUNK_SIZE, aNb);
+    for (; i < aLast; ++i) {
+      const Standard_Integer aNbContacts = aCounts(i);
+      if (aNbContacts == 0) {
+        continue;
+      }
       //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
+      const Standard_Integer i_S1 = aDMILI.FindKey(i + 1);
+      TTriangles1[i_S1].SetIntersection(Standard_True);
+      for (Standard_Integer j = 0; j < aNbContacts; ++j, ++aPos) {
+        const IntPolyh_Contact& aContact = aResult[aPos];
+        IntPolyh_Couple aCouple(i_S1, aContact.Triangle, aContact.Angle);
         TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
+        TTriangles2[aContact.Triangle].SetIntersection(Standard_True);
       }
     }
   }
@@ -163,17 +163,20 @@ void IntPolyh_Tools::FillArrayOfPointNormal(const Handle(Adaptor3d_HSurface)& th
   Standard_Integer aNbV = theVPars.Length();
   Standard_Integer iCnt = 0;
   thePoints.Init(aNbU * aNbV);
+
+  // Compute the points and derivatives on the whole grid
+  TColgp_Array2OfPnt aGridPnts(theUPars.Lower(), theUPars.Upper(), theVPars.Lower(), theVPars.Upper());
+  TColgp_Array2OfVec aGridDU  (theUPars.Lower(), theUPars.Upper(), theVPars.Lower(), theVPars.Upper());
+  TColgp_Array2OfVec aGridDV  (theUPars.Lower(), theUPars.Upper(), theVPars.Lower(), theVPars.Upper());
+  theSurf->D1Grid(theUPars, theVPars, aGridPnts, aGridDU, aGridDV);
+
   for (Standard_Integer i = 1; i <= aNbU; ++i)
   {
-    Standard_Real aU = theUPars(i);
-
     for (Standard_Integer j = 1; j <= aNbV; ++j)
     {
-      Standard_Real aV = theVPars(j);
-      // Compute the point
-      gp_Pnt aP;
-      gp_Vec aDU, aDV;
-      theSurf->D1(aU, aV, aP, aDU, aDV);
+      const gp_Pnt& aP  = aGridPnts(i, j);
+      const gp_Vec& aDU = aGridDU(i, j);
+      const gp_Vec& aDV = aGridDV(i, j);
       // Compute normal
       gp_Vec aVNorm = aDU.Crossed(aDV);
       Standard_Real aLength = aVNorm.Magnitude();
@@ -27,7 +27,9 @@
 #include <TCollection_HAsciiString.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
-#include <TColStd_ListIteratorOfListOfInteger.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 // Flags : 0 = Presence, 1 = Sharing Error
 #define Graph_Present 0
@@ -89,9 +91,14 @@ Interface_Graph::Interface_Graph
 
 Interface_Graph::Interface_Graph
 (const Interface_Graph& agraph, const Standard_Boolean /*copied*/)
-: themodel   (agraph.Model()), thepresents ("") 
+: themodel   (agraph.Model()), thepresents ("") ,
+  thesharedpos  (agraph.thesharedpos),
+  theshareds    (agraph.theshareds),
+  thesharingpos (agraph.thesharingpos),
+  thesharings   (agraph.thesharings),
+  thepartials   (agraph.thepartials)
 {
-  thesharings = agraph.SharingTable();
+  // the tables are never modified once filled : they can be shared
   Standard_Integer nb = agraph.NbStatuses();
   if(!nb)
     return;
@@ -114,47 +121,186 @@ Standard_Integer Interface_Graph::NbStatuses() const
   return (thestats.IsNull() ? 0 : thestats->Length());
 }
 
-const Handle(TColStd_HArray1OfListOfInteger)& Interface_Graph::SharingTable () const
-{  return thesharings;  }
+//  Lists Shared by the Entities are computed in parallel by blocks of
+//  Entities : each block notes the Numbers in its own vector, then these
+//  vectors are copied into the table once the count of each list is known
+
+namespace
+{
+  static const Standard_Integer THE_GRAPH_BLOCK = 4096;
+
+  //! Numbers noted for a block of Entities
+  struct Interface_GraphBlock
+  {
+    NCollection_Vector<Standard_Integer> Shareds;  //!< numbers of shared entities
+    NCollection_Vector<Standard_Integer> Errors;   //!< entities sharing unknown ones
+    NCollection_Vector<Standard_Integer> Partials; //!< entities sharing themselves
+  };
+
+  //! Computes the Shared Lists of a block of Entities
+  class Interface_GraphFiller
+  {
+  public:
+    Interface_GraphFiller (const Handle(Interface_InterfaceModel)&   theModel,
+                           NCollection_Array1<Interface_GraphBlock>& theBlocks,
+                           TColStd_Array1OfInteger&                  theCounts)
+    : myModel (theModel), myGTool (theModel->GTool()),
+      myBlocks (theBlocks), myCounts (theCounts) {}
+
+    void operator() (const Standard_Integer theBlock) const
+    {
+      Interface_GraphBlock& aBlock = myBlocks.ChangeValue (theBlock);
+      const Standard_Integer aLast = Min (myModel->NbEntities(), (theBlock + 1) * THE_GRAPH_BLOCK);
+      for (Standard_Integer i = theBlock * THE_GRAPH_BLOCK + 1; i <= aLast; i ++) {
+        //    ATTENTION : Si Entite non chargee donc illisible, basculer sur son
+        //    "Contenu" equivalent
+        const Handle(Standard_Transient)& ent = myModel->Value(i);
+        Handle(Standard_Transient) aCurEnt = ent;
+        if (myModel->IsRedefinedContent(i))
+          aCurEnt = myModel->ReportEntity(i)->Content();
+
+        Interface_EntityIterator iter;
+        Handle(Interface_GeneralModule) module;
+        Standard_Integer CN;
+        if (!aCurEnt.IsNull() && myGTool->Select(aCurEnt,module,CN))
+          module->FillShared(myModel,CN,aCurEnt,iter);
+
+        Standard_Integer nb = 0;
+        Standard_Boolean isError = Standard_False, isPartial = Standard_False;
+        for (iter.Start(); iter.More(); iter.Next()) {
+          const Handle(Standard_Transient)& entshare = iter.Value();
+          if (entshare == ent) {
+            isPartial = Standard_True;
+            continue;
+          }
+          //    num = 0 -> on sort du Model de depart, le noter "Error" et passer
+          const Standard_Integer num = myModel->Number(entshare);
+          if (!num) {
+            isError = Standard_True;
+            continue;
+          }
+          aBlock.Shareds.Append (num);
+          nb ++;
+        }
+        myCounts.SetValue (i,nb);
+        if (isError)
+          aBlock.Errors.Append (i);
+        else if (isPartial)
+          aBlock.Partials.Append (i);
+      }
+    }
+
+  private:
+    Interface_GraphFiller& operator= (const Interface_GraphFiller&);
+
+  private:
+    Handle(Interface_InterfaceModel)          myModel;
+    Handle(Interface_GTool)                   myGTool;
+    NCollection_Array1<Interface_GraphBlock>& myBlocks;
+    TColStd_Array1OfInteger&                  myCounts;
+  };
+
+  //! Copies the numbers noted for a block of Entities into the table
+  class Interface_GraphCopier
+  {
+  public:
+    Interface_GraphCopier (const NCollection_Array1<Interface_GraphBlock>& theBlocks,
+                           const TColStd_Array1OfInteger&                  thePos,
+                           TColStd_Array1OfInteger&                        theShareds)
+    : myBlocks (theBlocks), myPos (thePos), myShareds (theShareds) {}
+
+    void operator() (const Standard_Integer theBlock) const
+    {
+      const NCollection_Vector<Standard_Integer>& aNums = myBlocks.Value (theBlock).Shareds;
+      Standard_Integer aPos = myPos.Value (theBlock * THE_GRAPH_BLOCK);
+      for (NCollection_Vector<Standard_Integer>::Iterator anIter (aNums); anIter.More(); anIter.Next())
+        myShareds.SetValue (aPos ++, anIter.Value());
+    }
+
+  private:
+    Interface_GraphCopier& operator= (const Interface_GraphCopier&);
+
+  private:
+    const NCollection_Array1<Interface_GraphBlock>& myBlocks;
+    const TColStd_Array1OfInteger&                  myPos;
+    TColStd_Array1OfInteger&                        myShareds;
+  };
+}
 
 void Interface_Graph::Evaluate()
 {
   //  Evaluation d un Graphe de dependances : sur chaque Entite, on prend sa
   //  liste "Shared". On en deduit les "Sharing"  directement
+  //  Liste de l Entite num : positions pos(num-1) a pos(num)-1 de la table
   Standard_Integer n = Size();
-  thesharings = new TColStd_HArray1OfListOfInteger(1,n);//TColStd_HArray1OfTransient(1,n);//Clear();
-  if(themodel->GTool().IsNull())
+  thesharedpos  = new TColStd_HArray1OfInteger (0,n,0);
+  thesharingpos = new TColStd_HArray1OfInteger (0,n,0);
+  thepartials   = new TColStd_HPackedMapOfInteger;
+  thesharingtable.Nullify();
+  Handle(Interface_GTool) gtool = themodel->GTool();
+  if (gtool.IsNull() || n == 0) {
+    theshareds  = new TColStd_HArray1OfInteger (0,0,0);
+    thesharings = theshareds;
     return;
-  
+  }
 
+  //  Modules of all the types are selected before the parallel computation,
+  //  which then only reads the cache of the GTool
+  Handle(Interface_GeneralModule) module;
+  Standard_Integer CN;
+  Handle(Standard_Type) aLastType;
   Standard_Integer i; // svv Jan11 2000 : porting on DEC
   for (i = 1; i <= n; i ++) {
-     //    ATTENTION : Si Entite non chargee donc illisible, basculer sur son
-    //    "Contenu" equivalent
     Handle(Standard_Transient) ent = themodel->Value(i);
-  
-
-    //    Resultat obtenu via GeneralLib
-    Interface_EntityIterator iter = GetShareds(ent);
-
-    //    Mise en forme : liste d entiers
-    for (iter.Start(); iter.More(); iter.Next()) {
-      //    num = 0 -> on sort du Model de depart, le noter "Error" et passer
-      Handle(Standard_Transient) entshare = iter.Value();
-      if(entshare == ent)
-        continue;
-
-      Standard_Integer num = EntityNumber(entshare);
+    if (themodel->IsRedefinedContent(i))
+      ent = themodel->ReportEntity(i)->Content();
+    if (ent.IsNull() || ent->DynamicType() == aLastType)
+      continue;
+    aLastType = ent->DynamicType();
+    gtool->Select(ent,module,CN);
+  }
 
-      if (!num )  
-      {
-        if(!thestats.IsNull())
-          theflags.SetTrue (i,Graph_ShareError);
-        continue;
-      }
-      thesharings->ChangeValue(num).Append(i);
+  //  Shared Lists : count, positions, copy into the table
+  TColStd_Array1OfInteger& sharedpos = thesharedpos->ChangeArray1();
+  const Standard_Integer nbblocks = (n + THE_GRAPH_BLOCK - 1) / THE_GRAPH_BLOCK;
+  NCollection_Array1<Interface_GraphBlock> blocks (0,nbblocks-1);
+  OSD_Parallel::For (0,nbblocks,Interface_GraphFiller (themodel,blocks,sharedpos));
+  for (i = 1; i <= n; i ++)
+    sharedpos.ChangeValue(i) += sharedpos.Value(i-1);
+  const Standard_Integer nbshareds = sharedpos.Value(n);
+  theshareds = new TColStd_HArray1OfInteger (0,Max(nbshareds,1)-1,0);
+  OSD_Parallel::For (0,nbblocks,Interface_GraphCopier (blocks,sharedpos,theshareds->ChangeArray1()));
+
+  for (Standard_Integer ib = 0; ib < nbblocks; ib ++) {
+    const Interface_GraphBlock& aBlock = blocks.Value(ib);
+    for (NCollection_Vector<Standard_Integer>::Iterator anIter (aBlock.Errors); anIter.More(); anIter.Next()) {
+      if(!thestats.IsNull())
+        theflags.SetTrue (anIter.Value(),Graph_ShareError);
+      thepartials->ChangeMap().Add (anIter.Value());
     }
+    for (NCollection_Vector<Standard_Integer>::Iterator anIter (aBlock.Partials); anIter.More(); anIter.Next())
+      thepartials->ChangeMap().Add (anIter.Value());
   }
+
+  //  Sharing Lists : deduced from the Shared ones, in the order of Numbers
+  const TColStd_Array1OfInteger& shareds = theshareds->Array1();
+  TColStd_Array1OfInteger& sharingpos = thesharingpos->ChangeArray1();
+  Standard_Integer k;
+  for (k = 0; k < nbshareds; k ++)
+    sharingpos.ChangeValue (shareds.Value(k)) ++;
+  for (i = 1; i <= n; i ++)
+    sharingpos.ChangeValue(i) += sharingpos.Value(i-1);
+  thesharings = new TColStd_HArray1OfInteger (0,Max(nbshareds,1)-1,0);
+  TColStd_Array1OfInteger& sharings = thesharings->ChangeArray1();
+  //  positions are advanced from the start of the lists to their end ...
+  for (i = 1; i <= n; i ++) {
+    for (k = sharedpos.Value(i-1); k < sharedpos.Value(i); k ++)
+      sharings.SetValue (sharingpos.ChangeValue (shareds.Value(k)-1) ++, i);
+  }
+  //  ... so they have to be shifted back
+  for (i = n; i > 0; i --)
+    sharingpos.SetValue (i, sharingpos.Value(i-1));
+  sharingpos.SetValue (0,0);
 }
 
 //  ....                Construction depuis un autre Graph                ....
@@ -287,7 +433,7 @@ void  Interface_Graph::GetFromEntity
   thestats->SetValue(num,newstat);
   if (!shared) return;
   //  Attention a la redefinition !
-  Interface_EntityIterator aIter = GetShareds(ent);
+  Interface_EntityIterator aIter = Shareds(ent);
 
   for ( ; aIter.More() ; aIter.Next())    
     GetFromEntity(aIter.Value(),Standard_True,newstat);
@@ -319,7 +465,7 @@ void  Interface_Graph::GetFromEntity
   }
   if (!shared) return;
   //  Attention a la redefinition !
-  Interface_EntityIterator aIter = GetShareds(ent);
+  Interface_EntityIterator aIter = Shareds(ent);
 
   for ( ; aIter.More() ; aIter.Next())    
     GetFromEntity(aIter.Value(),Standard_True,newstat);
@@ -404,6 +550,14 @@ Interface_EntityIterator Interface_Graph::Shareds
   if(!num)
     return iter;
 
+  //  List recorded in the table, unless it misses entities (see Evaluate)
+  if (num < thesharedpos->Length() && !thepartials->Map().Contains(num)) {
+    const Standard_Integer last = thesharedpos->Value(num);
+    for (Standard_Integer k = thesharedpos->Value(num-1); k < last; k ++)
+      iter.AddItem (Entity(theshareds->Value(k)));
+    return iter;
+  }
+
   Handle(Standard_Transient) aCurEnt =  ent;
   if (themodel->IsRedefinedContent(num)) 
      aCurEnt = themodel->ReportEntity(num)->Content();
@@ -430,12 +584,10 @@ Handle(TColStd_HSequenceOfTransient) Interface_Graph::GetSharings(const Handle(S
   Standard_Integer num   = EntityNumber(ent);
   if(!num)
     return 0;
-  //return Handle(TColStd_HSequenceOfTransient)::DownCast(thesharings->Value(num));
-  const TColStd_ListOfInteger& alist = thesharings->Value(num);
   Handle(TColStd_HSequenceOfTransient) aSharings = new TColStd_HSequenceOfTransient;
-  TColStd_ListIteratorOfListOfInteger aIt(alist);
-  for( ; aIt.More() ; aIt.Next())
-    aSharings->Append(Entity(aIt.Value()));
+  const Standard_Integer nb = NbSharings(num);
+  for (Standard_Integer i = 1; i <= nb; i ++)
+    aSharings->Append(Entity(SharingNumber(num,i)));
   return aSharings;
 }
 
@@ -443,11 +595,57 @@ Interface_EntityIterator Interface_Graph::Sharings
 (const Handle(Standard_Transient)& ent) const
 {
   Interface_EntityIterator iter;
-  iter.AddList(GetSharings(ent));
+  Standard_Integer num   = EntityNumber(ent);
+  const Standard_Integer nb = NbSharings(num);
+  for (Standard_Integer i = 1; i <= nb; i ++)
+    iter.AddItem(Entity(SharingNumber(num,i)));
   return iter;
 
 }
 
+Standard_Integer Interface_Graph::NbShareds (const Standard_Integer num) const
+{
+  if (num <= 0 || num >= thesharedpos->Length())
+    return 0;
+  return thesharedpos->Value(num) - thesharedpos->Value(num-1);
+}
+
+Standard_Integer Interface_Graph::SharedNumber
+(const Standard_Integer num, const Standard_Integer rank) const
+{
+  return theshareds->Value (thesharedpos->Value(num-1) + rank - 1);
+}
+
+Standard_Integer Interface_Graph::NbSharings (const Standard_Integer num) const
+{
+  if (num <= 0 || num >= thesharingpos->Length())
+    return 0;
+  return thesharingpos->Value(num) - thesharingpos->Value(num-1);
+}
+
+Standard_Integer Interface_Graph::SharingNumber
+(const Standard_Integer num, const Standard_Integer rank) const
+{
+  return thesharings->Value (thesharingpos->Value(num-1) + rank - 1);
+}
+
+//  Former form of the table of Sharing lists, built on demand
+
+const Handle(TColStd_HArray1OfListOfInteger)& Interface_Graph::SharingTable () const
+{
+  if (thesharingtable.IsNull()) {
+    const Standard_Integer n = Size();
+    thesharingtable = new TColStd_HArray1OfListOfInteger (1,n);
+    for (Standard_Integer num = 1; num <= n; num ++) {
+      TColStd_ListOfInteger& alist = thesharingtable->ChangeValue(num);
+      const Standard_Integer nb = NbSharings(num);
+      for (Standard_Integer i = 1; i <= nb; i ++)
+        alist.Append (SharingNumber(num,i));
+    }
+  }
+  return thesharingtable;
+}
+
 static void AddTypedSharings
 (const Handle(Standard_Transient)& ent, const Handle(Standard_Type)& type,
  Interface_EntityIterator& iter, const Standard_Integer n,
@@ -479,9 +677,9 @@ Interface_EntityIterator Interface_Graph::TypedSharings
 Interface_EntityIterator Interface_Graph::RootEntities () const
 {
   Interface_EntityIterator iter;
-  Standard_Integer nb = thesharings->Length();
+  Standard_Integer nb = thesharingpos->Upper();
   for (Standard_Integer i = 1; i <= nb; i ++) {
-    if(!thesharings->Value(i).IsEmpty())
+    if(NbSharings(i) > 0)
       continue;
     iter.AddItem(Entity(i));
   }
@@ -27,6 +27,7 @@
 #include <TCollection_HAsciiString.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfListOfInteger.hxx>
+#include <TColStd_HPackedMapOfInteger.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
 
 class Standard_DomainError;
@@ -55,6 +56,11 @@ class Interface_EntityIterator;
 //! Entities (in fact, their Numbers in the Model) which is
 //! filled by a ShareTool, and a list of Sharing Entities,
 //! computed by deduction from the Shared Lists
+//! Both lists are stored for all the Entities in compressed
+//! tables (numbers of all lists put one after another, plus
+//! the position of the first number of each list), filled
+//! once at creation time; Shared Lists of the Entities are
+//! computed in parallel
 //!
 //! Moreover, it is possible to redefine the list of Entities
 //! Shared by an Entity (instead of standard answer by general
@@ -199,6 +205,9 @@ public:
   //! Returns the list of Entities Shared by an Entity, as recorded
   //! by the Graph. That is, by default Basic Shared List, else it
   //! can be redefined by methods SetShare, SetNoShare ... see below
+  //! Warning : the list is a snapshot taken when the Graph is created :
+  //! changes of the entities made after are not reflected, neither
+  //! in Shareds nor in Sharings; the Graph has to be created again
   Standard_EXPORT Interface_EntityIterator Shareds (const Handle(Standard_Transient)& ent) const;
   
   //! Returns the list of Entities which Share an Entity, computed
@@ -225,8 +234,27 @@ public:
   
   //! Returns the Table of Sharing lists. Used to Create
   //! another Graph from <me>
+  //! The table is built at first call from the recorded lists
+  Standard_DEPRECATED("Interface_Graph::SharingTable() is deprecated - NbSharings() and SharingNumber() should be used instead")
   Standard_EXPORT const Handle(TColStd_HArray1OfListOfInteger)& SharingTable() const;
   
+  //! Returns the count of Entities Shared by the Entity of number
+  //! <num>, as recorded at creation time (0 if <num> is out of range)
+  Standard_EXPORT Standard_Integer NbShareds (const Standard_Integer num) const;
+  
+  //! Returns the Number of the <rank>-th Entity Shared by the
+  //! Entity of number <num> (<rank> from 1 to NbShareds(num))
+  Standard_EXPORT Standard_Integer SharedNumber (const Standard_Integer num, const Standard_Integer rank) const;
+  
+  //! Returns the count of Entities Sharing the Entity of number
+  //! <num> (0 if <num> is out of range)
+  Standard_EXPORT Standard_Integer NbSharings (const Standard_Integer num) const;
+  
+  //! Returns the Number of the <rank>-th Entity Sharing the
+  //! Entity of number <num> (<rank> from 1 to NbSharings(num)).
+  //! Sharing Entities are given in the order of their Numbers
+  Standard_EXPORT Standard_Integer SharingNumber (const Standard_Integer num, const Standard_Integer rank) const;
+  
   //! Returns mode resposible for computation of statuses;
   Standard_EXPORT Standard_Boolean ModeStat() const;
 
@@ -243,7 +271,12 @@ protected:
   Handle(Interface_InterfaceModel) themodel;
   TCollection_AsciiString thepresents;
   Handle(TColStd_HArray1OfInteger) thestats;
-  Handle(TColStd_HArray1OfListOfInteger) thesharings;
+  Handle(TColStd_HArray1OfInteger) thesharedpos;
+  Handle(TColStd_HArray1OfInteger) theshareds;
+  Handle(TColStd_HArray1OfInteger) thesharingpos;
+  Handle(TColStd_HArray1OfInteger) thesharings;
+  Handle(TColStd_HPackedMapOfInteger) thepartials;
+  mutable Handle(TColStd_HArray1OfListOfInteger) thesharingtable;
 
 
 private:
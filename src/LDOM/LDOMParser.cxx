@@ -26,6 +26,9 @@
 #include <TCollection_ExtendedString.hxx>
 #include <OSD_OpenFile.hxx>
 
+// block size of the memory managers of detached elements
+#define DETACHED_BLOCK_SIZE 1024
+
 #include <fcntl.h>
 #ifdef _MSC_VER
 #include <io.h>
@@ -118,6 +121,7 @@ Standard_Boolean LDOMParser::parse (istream& anInput,
   // Open the DOM Document
   myDocument = new LDOM_MemManager (20000);
   myError.Clear();
+  myIsDetaching = Standard_False;
 
   // Create the Reader instance
   if (myReader) delete myReader;
@@ -187,11 +191,13 @@ Standard_Boolean LDOMParser::ParseDocument (istream& theIStream, const Standard_
       if (isElement == Standard_False) {
         isElement = Standard_True;
         myDocument -> myRootElement = &myReader -> GetElement ();
+        setCurrentElement (myReader -> GetElement(), myDocument);
         if (startElement()) {
           isError = Standard_True;
           myError = "User abort at startElement()";
           break;
         }
+        myIsDetaching = Standard_False;
         if (endElement()) {
           isError = Standard_True;
           myError = "User abort at endElement()";
@@ -216,13 +222,14 @@ Standard_Boolean LDOMParser::ParseDocument (istream& theIStream, const Standard_
         }
         
         myDocument->myRootElement = &myReader->GetElement();
-        
+        setCurrentElement (myReader->GetElement(), myDocument);
+
         if (startElement()) {
           isError = Standard_True;
           myError = "User abort at startElement()";
           break;
         }
-        isError = ParseElement (theIStream);
+        isError = ParseElement (theIStream, myDocument);
         if (isError) break;
         continue;
       }
@@ -254,41 +261,60 @@ Standard_Boolean LDOMParser::ParseDocument (istream& theIStream, const Standard_
 //purpose  : parse one element, given the type of its XML presentation
 //=======================================================================
 
-Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream)
+Standard_Boolean LDOMParser::ParseElement (Standard_IStream&              theIStream,
+                                           const Handle(LDOM_MemManager)& theDocument)
 {
   Standard_Boolean  isError = Standard_False;
   const LDOM_BasicElement * aParent = &myReader->GetElement();
   const LDOM_BasicNode    * aLastChild = NULL;
+  // the children are detached if it has been requested in startElement()
+  const Standard_Boolean isDetached = myIsDetaching;
+  myIsDetaching = Standard_False;
+  Handle(LDOM_MemManager) aChildDocument;
+  if (!isDetached)
+    aChildDocument = theDocument;
   for(;;) {
     LDOM_Node::NodeType aLocType;
     LDOMBasicString     aTextValue;
     char *aTextStr;
+    if (aChildDocument.IsNull())
+      aChildDocument = new LDOM_MemManager (DETACHED_BLOCK_SIZE);
+    myReader -> SetDocument (aChildDocument);
     LDOM_XmlReader::RecordType aType = ReadRecord (* myReader, theIStream, myCurrentData);
     switch (aType) {
     case LDOM_XmlReader::XML_UNKNOWN:
       isError = Standard_True;
       break;
     case LDOM_XmlReader::XML_FULL_ELEMENT:
-      aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
+      if (!isDetached)
+        aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
+      setCurrentElement (myReader -> GetElement(), aChildDocument);
       if (startElement()) {
         isError = Standard_True;
         myError = "User abort at startElement()";
         break;
       }
+      myIsDetaching = Standard_False;
       if (endElement()) {
         isError = Standard_True;
         myError = "User abort at endElement()";
         break;
       }
+      if (isDetached)
+        aChildDocument.Nullify();
       break;
     case LDOM_XmlReader::XML_START_ELEMENT:
-      aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
+      if (!isDetached)
+        aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
+      setCurrentElement (myReader -> GetElement(), aChildDocument);
       if (startElement()) {
         isError = Standard_True;
         myError = "User abort at startElement()";
         break;
       }
-      isError = ParseElement (theIStream);
+      isError = ParseElement (theIStream, aChildDocument);
+      if (isDetached)
+        aChildDocument.Nullify();
       break;
     case LDOM_XmlReader::XML_END_ELEMENT:
       {
@@ -300,9 +326,12 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream)
           myError += "\'";
           isError = Standard_True;
         }
-        else if (endElement()) {
-          isError = Standard_True;
-          myError = "User abort at endElement()";
+        else {
+          setCurrentElement (*aParent, theDocument);
+          if (endElement()) {
+            isError = Standard_True;
+            myError = "User abort at endElement()";
+          }
         }
         delete [] aTextStr;
       }
@@ -316,9 +345,9 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream)
         if (IsDigit(aTextStr[0])) {
           if (LDOM_XmlReader::getInteger (aTextValue, aTextStr,
                                           aTextStr + aTextLen))
-            aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+            aTextValue = LDOMBasicString (aTextStr, aTextLen, theDocument);
         } else
-          aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+          aTextValue = LDOMBasicString (aTextStr, aTextLen, theDocument);
       }
       goto create_text_node;
     case LDOM_XmlReader::XML_COMMENT:
@@ -326,17 +355,17 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream)
       {
         Standard_Integer aTextLen;
         aTextStr = LDOM_CharReference::Decode ((char *)myCurrentData.str(), aTextLen);
-        aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+        aTextValue = LDOMBasicString (aTextStr, aTextLen, theDocument);
       }
       goto create_text_node;
     case LDOM_XmlReader::XML_CDATA:
       aLocType = LDOM_Node::CDATA_SECTION_NODE;
       aTextStr = (char *)myCurrentData.str();
-      aTextValue = LDOMBasicString(aTextStr,myCurrentData.Length(),myDocument);
+      aTextValue = LDOMBasicString(aTextStr,myCurrentData.Length(),theDocument);
     create_text_node:
       {
         LDOM_BasicNode& aTextNode =
-          LDOM_BasicText::Create (aLocType, aTextValue, myDocument);
+          LDOM_BasicText::Create (aLocType, aTextValue, theDocument);
         aParent -> AppendChild (&aTextNode, aLastChild);
       }
       delete [] aTextStr;
@@ -379,7 +408,17 @@ Standard_Boolean LDOMParser::endElement ()
 
 LDOM_Element LDOMParser::getCurrentElement () const
 {
-  return LDOM_Element (myReader -> GetElement(), myDocument);
+  return LDOM_Element (*myCurrentElement, myCurrentDocument);
+}
+
+//=======================================================================
+//function : detachChildren
+//purpose  : 
+//=======================================================================
+
+void LDOMParser::detachChildren ()
+{
+  myIsDetaching = Standard_True;
 }
 
 //=======================================================================
@@ -32,7 +32,8 @@ class LDOMParser
  public:
   // ---------- PUBLIC METHODS ----------
 
-  LDOMParser () : myReader (NULL), myCurrentData (16384) {}
+  LDOMParser () : myReader (NULL), myCurrentElement (NULL),
+                  myCurrentData (16384), myIsDetaching (Standard_False) {}
   // Empty constructor
 
   virtual Standard_EXPORT ~LDOMParser  ();
@@ -79,11 +80,25 @@ class LDOMParser
                         getCurrentElement () const;
   // to be called from startElement() and endElement()
 
+  Standard_EXPORT void  detachChildren  ();
+  // to be called from startElement(): the child elements of the current
+  // element are not appended to it. Each child element is allocated with its
+  // contents in a separate memory manager, released after endElement() of
+  // the child unless the descendant keeps a reference to it (an LDOM_Element
+  // obtained from getCurrentElement()). Allows processing of large documents
+  // element by element with the memory bounded by the retained elements.
+
  private:
   // ---------- PRIVATE METHODS ----------
   Standard_Boolean      ParseDocument   (Standard_IStream& theIStream, const Standard_Boolean theWithoutRoot = Standard_False);
 
-  Standard_Boolean      ParseElement    (Standard_IStream& theIStream);
+  Standard_Boolean      ParseElement    (Standard_IStream& theIStream,
+                                         const Handle(LDOM_MemManager)& theDocument);
+  // parse the contents of the last read element owned by theDocument
+
+  void                  setCurrentElement (const LDOM_BasicElement&       theElement,
+                                           const Handle(LDOM_MemManager)& theDocument)
+  { myCurrentElement = &theElement; myCurrentDocument = theDocument; }
 
   // ---------- PRIVATE (PROHIBITED) METHODS ----------
 
@@ -98,8 +113,11 @@ class LDOMParser
 
   LDOM_XmlReader                * myReader;
   Handle(LDOM_MemManager)       myDocument;
+  const LDOM_BasicElement       * myCurrentElement;
+  Handle(LDOM_MemManager)       myCurrentDocument;
   LDOM_OSStream                 myCurrentData;
   TCollection_AsciiString       myError;
+  Standard_Boolean              myIsDetaching;
 };
 
 #endif
@@ -61,6 +61,10 @@ class LDOM_XmlReader
 
   void CreateElement (const char *theName, const Standard_Integer theLen);
 
+  void SetDocument (const Handle(LDOM_MemManager)& theDocument)
+                                        { myDocument = theDocument; }
+  // set the memory manager receiving the elements created by next records
+
   static Standard_Boolean getInteger    (LDOMBasicString&       theValue,
                                          const char             * theStart,
                                          const char             * theEnd);
@@ -0,0 +1,979 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWGltf_CafWriter.hxx>
+
+#include <BRep_Tool.hxx>
+#include <Message.hxx>
+#include <Message_Messenger.hxx>
+#include <Message_ProgressSentry.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_OpenFile.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Quantity_ColorRGBAHasher.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDF_Tool.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFPrs.hxx>
+#include <XCAFPrs_DataMapIteratorOfIndexedDataMapOfShapeStyle.hxx>
+#include <XCAFPrs_IndexedDataMapOfShapeStyle.hxx>
+
+#include <algorithm>
+#include <cfloat>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <string.h>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWGltf_CafWriter, Standard_Transient)
+
+namespace
+{
+  //! glTF constants
+  static const unsigned int THE_GLB_MAGIC       = 0x46546C67; // "glTF"
+  static const unsigned int THE_GLB_VERSION     = 2;
+  static const unsigned int THE_GLB_CHUNK_JSON  = 0x4E4F534A; // "JSON"
+  static const unsigned int THE_GLB_CHUNK_BIN   = 0x004E4942; // "BIN\0"
+  static const int THE_GLTF_FLOAT               = 5126;
+  static const int THE_GLTF_UNSIGNED_SHORT      = 5123;
+  static const int THE_GLTF_UNSIGNED_INT        = 5125;
+  static const int THE_GLTF_ARRAY_BUFFER        = 34962;
+  static const int THE_GLTF_ELEMENT_ARRAY_BUFFER = 34963;
+
+  //! Special material indices of the face.
+  static const Standard_Integer THE_MATERIAL_DEFAULT = -1; //!< material of the instance
+  static const Standard_Integer THE_MATERIAL_HIDDEN  = -2; //!< face is not written
+
+  //! Face of the part.
+  struct RWGltf_Face
+  {
+    Handle(Poly_Triangulation) Triangulation;
+    gp_Trsf                    Trsf;       //!< location of the face within the part
+    Standard_Boolean           IsReversed;
+    Standard_Integer           Material;   //!< material index, THE_MATERIAL_DEFAULT or THE_MATERIAL_HIDDEN
+  };
+
+  //! Triangulated part of the document, shared by all its instances.
+  struct RWGltf_Part
+  {
+    TCollection_AsciiString         Name;
+    Standard_Integer                Material; //!< own material of the part or -1
+    NCollection_Vector<RWGltf_Face> Faces;
+  };
+
+  //! Group of faces of the mesh having the same material.
+  struct RWGltf_Primitive
+  {
+    NCollection_Vector<Standard_Integer> Faces;    //!< indices of faces of the part
+    Standard_Integer Material;
+    Standard_Integer NbNodes;
+    Standard_Integer NbTriangles;
+    float            MinPnt[3];
+    float            MaxPnt[3];
+    Standard_Size    NodeOffset;  //!< byte offset within the positions (normals) buffer view
+    Standard_Size    IndexOffset; //!< byte offset within the indices buffer view
+    Standard_Integer Accessor;    //!< index of the positions accessor, followed by normals and indices
+
+    RWGltf_Primitive() : Material (-1), NbNodes (0), NbTriangles (0), NodeOffset (0), IndexOffset (0), Accessor (-1) {}
+
+    //! Return TRUE if the indices should be written as 32-bit integers.
+    Standard_Boolean IsIndex32() const { return NbNodes > 65535; }
+  };
+
+  //! Mesh - the part with resolved default material.
+  struct RWGltf_Mesh
+  {
+    Standard_Integer                     Part;
+    NCollection_Vector<RWGltf_Primitive> Primitives;
+  };
+
+  //! Node of the scene.
+  struct RWGltf_Node
+  {
+    TCollection_AsciiString              Name;
+    gp_Trsf                              Trsf;
+    Standard_Integer                     Mesh;
+    NCollection_Vector<Standard_Integer> Children;
+
+    RWGltf_Node() : Mesh (-1) {}
+  };
+
+  //! Return the name of the label or empty string.
+  static TCollection_AsciiString labelName (const TDF_Label& theLabel)
+  {
+    Handle(TDataStd_Name) aNameAttr;
+    if (!theLabel.FindAttribute (TDataStd_Name::GetID(), aNameAttr))
+    {
+      return TCollection_AsciiString();
+    }
+    return TCollection_AsciiString (aNameAttr->Get());
+  }
+
+  //! Write string value with JSON escaping.
+  static void writeString (Standard_OStream& theStream, const TCollection_AsciiString& theString)
+  {
+    theStream << '"';
+    for (const char* aChar = theString.ToCString(); *aChar != '\0'; ++aChar)
+    {
+      switch (*aChar)
+      {
+        case '"':  theStream << "\\\""; break;
+        case '\\': theStream << "\\\\"; break;
+        case '\n': theStream << "\\n";  break;
+        case '\r': theStream << "\\r";  break;
+        case '\t': theStream << "\\t";  break;
+        default:
+        {
+          if ((unsigned char )*aChar < 0x20)
+          {
+            char aBuff[8];
+            Sprintf (aBuff, "\\u%04x", (unsigned int )(unsigned char )*aChar);
+            theStream << aBuff;
+          }
+          else
+          {
+            theStream << *aChar;
+          }
+        }
+      }
+    }
+    theStream << '"';
+  }
+
+  //! Write floating point value so that it is restored exactly as 32-bit float.
+  //! The value is formatted by the stream according to its locale (classic one for JSON).
+  static void writeFloat (Standard_OStream& theStream, const Standard_Real theValue)
+  {
+    const std::streamsize aPrecision = theStream.precision();
+    theStream << std::setprecision (9) << theValue << std::setprecision (aPrecision);
+  }
+
+  //! Write 4x4 column-major transformation matrix.
+  static void writeMatrix (Standard_OStream& theStream, const Standard_Real theMat[16])
+  {
+    theStream << "[";
+    for (Standard_Integer anIter = 0; anIter < 16; ++anIter)
+    {
+      if (anIter != 0)
+      {
+        theStream << ",";
+      }
+      writeFloat (theStream, theMat[anIter]);
+    }
+    theStream << "]";
+  }
+
+  //! Put unsigned 32-bit integer in Little Endian.
+  static void putUInt32 (char* theData, const Standard_Size theValue)
+  {
+    for (Standard_Integer aByteIter = 0; aByteIter < 4; ++aByteIter)
+    {
+      theData[aByteIter] = (char )((theValue >> (8 * aByteIter)) & 0xFF);
+    }
+  }
+
+  //! Buffered sequential writer of the binary chunk.
+  class RWGltf_BinaryStream
+  {
+  public:
+    RWGltf_BinaryStream (FILE* theFile)
+    : myFile (theFile), myBuffer (0, (1 << 20) - 1), mySize (0), myIsOK (Standard_True) {}
+
+    //! Append value to the buffer.
+    template<typename T> void Put (const T theValue)
+    {
+      if (mySize + sizeof(T) > (Standard_Size )myBuffer.Size())
+      {
+        Flush();
+      }
+      memcpy (&myBuffer.ChangeValue ((Standard_Integer )mySize), &theValue, sizeof(T));
+      mySize += sizeof(T);
+    }
+
+    //! Append zero bytes to align the stream.
+    void Pad (const Standard_Size theNbBytes)
+    {
+      for (Standard_Size aByteIter = 0; aByteIter < theNbBytes; ++aByteIter)
+      {
+        Put<char> (0);
+      }
+    }
+
+    //! Dump the buffer to the file.
+    Standard_Boolean Flush()
+    {
+      if (mySize != 0)
+      {
+        myIsOK = myIsOK && fwrite (&myBuffer.First(), 1, mySize, myFile) == mySize;
+        mySize = 0;
+      }
+      return myIsOK;
+    }
+
+  private:
+    FILE*                    myFile;
+    NCollection_Array1<char> myBuffer;
+    Standard_Size            mySize;
+    Standard_Boolean         myIsOK;
+  };
+
+  //! Collects the scene structure from the document.
+  class RWGltf_SceneBuilder
+  {
+  public:
+
+    RWGltf_SceneBuilder (const Handle(XCAFDoc_ColorTool)& theColorTool) : myColorTool (theColorTool) {}
+
+    //! Add node for the label (a reference, an assembly or a part) and return its index, or -1 if it is empty.
+    Standard_Integer AddNode (const TDF_Label& theLabel, const Standard_Integer theMaterial)
+    {
+      if (!myColorTool->IsVisible (theLabel))
+      {
+        return -1;
+      }
+
+      RWGltf_Node aNode;
+      TDF_Label aRefLabel = theLabel;
+      Standard_Integer anInstMaterial = -1;
+      if (XCAFDoc_ShapeTool::GetReferredShape (theLabel, aRefLabel))
+      {
+        aNode.Trsf = XCAFDoc_ShapeTool::GetLocation (theLabel).Transformation();
+        anInstMaterial = labelMaterial (theLabel);
+      }
+
+      // names of instances are usually generated, so that the name of the product is preferred
+      aNode.Name = labelName (aRefLabel);
+      if (aNode.Name.IsEmpty())
+      {
+        aNode.Name = labelName (theLabel);
+      }
+
+      if (XCAFDoc_ShapeTool::IsAssembly (aRefLabel))
+      {
+        // the instance style has priority over the one of the assembly itself
+        Standard_Integer aMaterial = anInstMaterial;
+        if (aMaterial == -1)
+        {
+          aMaterial = labelMaterial (aRefLabel);
+        }
+        if (aMaterial == -1)
+        {
+          aMaterial = theMaterial;
+        }
+
+        TopoDS_Shape anAsmShape;
+        if (XCAFDoc_ShapeTool::GetShape (aRefLabel, anAsmShape))
+        {
+          aNode.Trsf.Multiply (anAsmShape.Location().Transformation());
+        }
+
+        TDF_LabelSequence aComponents;
+        XCAFDoc_ShapeTool::GetComponents (aRefLabel, aComponents);
+        for (TDF_LabelSequence::Iterator aCompIter (aComponents); aCompIter.More(); aCompIter.Next())
+        {
+          const Standard_Integer aChild = AddNode (aCompIter.Value(), aMaterial);
+          if (aChild != -1)
+          {
+            aNode.Children.Append (aChild);
+          }
+        }
+        if (aNode.Children.IsEmpty())
+        {
+          return -1;
+        }
+      }
+      else
+      {
+        const Standard_Integer aPart = addPart (aRefLabel);
+        if (aPart == -1)
+        {
+          return -1;
+        }
+
+        Standard_Integer aMaterial = anInstMaterial;
+        if (aMaterial == -1)
+        {
+          aMaterial = myParts (aPart).Material;
+        }
+        if (aMaterial == -1)
+        {
+          aMaterial = theMaterial;
+        }
+        aNode.Mesh = addMesh (aPart, aMaterial);
+        if (aNode.Mesh == -1)
+        {
+          return -1;
+        }
+      }
+
+      myNodes.Append (aNode);
+      return myNodes.Upper();
+    }
+
+    //! Return materials (colors).
+    const NCollection_IndexedMap<Quantity_ColorRGBA, Quantity_ColorRGBAHasher>& Materials() const { return myMaterials; }
+
+    //! Return parts.
+    const NCollection_Vector<RWGltf_Part>& Parts() const { return myParts; }
+
+    //! Return meshes.
+    NCollection_Vector<RWGltf_Mesh>& Meshes() { return myMeshes; }
+
+    //! Return nodes.
+    NCollection_Vector<RWGltf_Node>& Nodes() { return myNodes; }
+
+  private:
+
+    //! Return index of the material defined by the color of the label, or -1.
+    Standard_Integer labelMaterial (const TDF_Label& theLabel)
+    {
+      Quantity_ColorRGBA aColor;
+      if (myColorTool->GetColor (theLabel, XCAFDoc_ColorSurf, aColor)
+       || myColorTool->GetColor (theLabel, XCAFDoc_ColorGen,  aColor))
+      {
+        return myMaterials.Add (aColor) - 1;
+      }
+      return -1;
+    }
+
+    //! Return index of the material defined by the style, or -1.
+    Standard_Integer styleMaterial (const XCAFPrs_Style& theStyle)
+    {
+      if (!theStyle.IsVisible())
+      {
+        return THE_MATERIAL_HIDDEN;
+      }
+      return theStyle.IsSetColorSurf() ? myMaterials.Add (theStyle.GetColorSurfRGBA()) - 1 : THE_MATERIAL_DEFAULT;
+    }
+
+    //! Collect the triangulated faces of the part with their styles; returns -1 if part has no triangles.
+    Standard_Integer addPart (const TDF_Label& theLabel)
+    {
+      TCollection_AsciiString anEntry;
+      TDF_Tool::Entry (theLabel, anEntry);
+      if (const Standard_Integer* aPartIndex = myPartMap.Seek (anEntry))
+      {
+        return *aPartIndex;
+      }
+
+      RWGltf_Part aPart;
+      aPart.Name     = labelName (theLabel);
+      aPart.Material = -1;
+
+      TopoDS_Shape aShape;
+      XCAFDoc_ShapeTool::GetShape (theLabel, aShape);
+
+      // styles of sub-shapes override the style of the part as a whole, similar to presentation of the document
+      XCAFPrs_IndexedDataMapOfShapeStyle aSettings;
+      XCAFPrs::CollectStyleSettings (theLabel, TopLoc_Location(), aSettings);
+      NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher> aFaceMaterials;
+      for (XCAFPrs_DataMapIteratorOfIndexedDataMapOfShapeStyle aStyleIter (aSettings); aStyleIter.More(); aStyleIter.Next())
+      {
+        const Standard_Integer aMaterial = styleMaterial (aStyleIter.Value());
+        if (aStyleIter.Key().IsSame (aShape))
+        {
+          aPart.Material = aMaterial;
+          continue;
+        }
+        for (TopExp_Explorer aFaceIter (aStyleIter.Key(), TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+        {
+          aFaceMaterials.Bind (aFaceIter.Current(), aMaterial);
+        }
+      }
+      if (aPart.Material == THE_MATERIAL_HIDDEN)
+      {
+        myPartMap.Bind (anEntry, -1);
+        return -1;
+      }
+
+      if (!aShape.IsNull())
+      {
+        for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+        {
+          TopLoc_Location aLoc;
+          RWGltf_Face aFace;
+          aFace.Triangulation = BRep_Tool::Triangulation (TopoDS::Face (aFaceIter.Current()), aLoc);
+          if (aFace.Triangulation.IsNull()
+           || aFace.Triangulation->NbTriangles() == 0)
+          {
+            continue;
+          }
+
+          aFace.Trsf       = aLoc.Transformation();
+          aFace.IsReversed = aFaceIter.Current().Orientation() == TopAbs_REVERSED;
+          aFace.Material   = THE_MATERIAL_DEFAULT;
+          if (const Standard_Integer* aMaterial = aFaceMaterials.Seek (aFaceIter.Current()))
+          {
+            aFace.Material = *aMaterial;
+          }
+          if (aFace.Material != THE_MATERIAL_HIDDEN)
+          {
+            aPart.Faces.Append (aFace);
+          }
+        }
+      }
+
+      const Standard_Integer aPartIndex = aPart.Faces.IsEmpty() ? -1 : myParts.Length();
+      if (aPartIndex != -1)
+      {
+        myParts.Append (aPart);
+      }
+      myPartMap.Bind (anEntry, aPartIndex);
+      return aPartIndex;
+    }
+
+    //! Return the mesh of the part with specified default material; the same mesh is shared by instances.
+    Standard_Integer addMesh (const Standard_Integer thePart, const Standard_Integer theMaterial)
+    {
+      const TCollection_AsciiString aKey = TCollection_AsciiString (thePart) + ":" + TCollection_AsciiString (theMaterial);
+      if (const Standard_Integer* aMeshIndex = myMeshMap.Seek (aKey))
+      {
+        return *aMeshIndex;
+      }
+
+      const RWGltf_Part& aPart = myParts (thePart);
+      RWGltf_Mesh aMesh;
+      aMesh.Part = thePart;
+      NCollection_DataMap<Standard_Integer, Standard_Integer> aPrimMap;
+      for (Standard_Integer aFaceIter = 0; aFaceIter < aPart.Faces.Length(); ++aFaceIter)
+      {
+        const RWGltf_Face& aFace = aPart.Faces (aFaceIter);
+        const Standard_Integer aMaterial = aFace.Material == THE_MATERIAL_DEFAULT ? theMaterial : aFace.Material;
+        Standard_Integer aPrimIndex = -1;
+        if (!aPrimMap.Find (aMaterial, aPrimIndex))
+        {
+          aPrimIndex = aMesh.Primitives.Length();
+          aMesh.Primitives.Append (RWGltf_Primitive());
+          aMesh.Primitives.ChangeValue (aPrimIndex).Material = aMaterial;
+          aPrimMap.Bind (aMaterial, aPrimIndex);
+        }
+        aMesh.Primitives.ChangeValue (aPrimIndex).Faces.Append (aFaceIter);
+      }
+
+      myMeshes.Append (aMesh);
+      myMeshMap.Bind (aKey, myMeshes.Upper());
+      return myMeshes.Upper();
+    }
+
+  private:
+    Handle(XCAFDoc_ColorTool)                                            myColorTool;
+    NCollection_IndexedMap<Quantity_ColorRGBA, Quantity_ColorRGBAHasher> myMaterials;
+    NCollection_DataMap<TCollection_AsciiString, Standard_Integer>       myPartMap;
+    NCollection_DataMap<TCollection_AsciiString, Standard_Integer>       myMeshMap;
+    NCollection_Vector<RWGltf_Part>                                      myParts;
+    NCollection_Vector<RWGltf_Mesh>                                      myMeshes;
+    NCollection_Vector<RWGltf_Node>                                      myNodes;
+  };
+
+  //! Return node position transformed to the part coordinate system.
+  inline gp_XYZ facePoint (const RWGltf_Face& theFace, const Standard_Integer theNode)
+  {
+    gp_XYZ aPnt = theFace.Triangulation->Nodes().Value (theNode).XYZ();
+    theFace.Trsf.Transforms (aPnt);
+    return aPnt;
+  }
+
+  //! Return triangle of the face with indices oriented according to the face orientation.
+  inline void faceTriangle (const RWGltf_Face& theFace, const Standard_Integer theTri, Standard_Integer theNodes[3])
+  {
+    theFace.Triangulation->Triangles().Value (theTri).Get (theNodes[0], theNodes[1], theNodes[2]);
+    if (theFace.IsReversed != theFace.Trsf.IsNegative())
+    {
+      std::swap (theNodes[1], theNodes[2]);
+    }
+  }
+
+  //! Compute normals of the face nodes in the part coordinate system.
+  static void faceNormals (const RWGltf_Face& theFace, NCollection_Array1<gp_XYZ>& theNormals)
+  {
+    const Handle(Poly_Triangulation)& aTris = theFace.Triangulation;
+    if (aTris->HasNormals())
+    {
+      const TShort_Array1OfShortReal& aNormals = aTris->Normals();
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aTris->NbNodes(); ++aNodeIter)
+      {
+        const Standard_Integer anOffset = aNormals.Lower() + (aNodeIter - 1) * 3;
+        theNormals.ChangeValue (aNodeIter).SetCoord (aNormals (anOffset), aNormals (anOffset + 1), aNormals (anOffset + 2));
+      }
+    }
+    else
+    {
+      // smooth normals weighted by the triangle areas
+      theNormals.Init (gp_XYZ (0.0, 0.0, 0.0));
+      const TColgp_Array1OfPnt& aNodes = aTris->Nodes();
+      const Poly_Array1OfTriangle& aTriangles = aTris->Triangles();
+      for (Standard_Integer aTriIter = aTriangles.Lower(); aTriIter <= aTriangles.Upper(); ++aTriIter)
+      {
+        Standard_Integer aNodeIds[3];
+        aTriangles (aTriIter).Get (aNodeIds[0], aNodeIds[1], aNodeIds[2]);
+        const gp_XYZ& aP1 = aNodes (aNodeIds[0]).XYZ();
+        const gp_XYZ aTriNorm = (aNodes (aNodeIds[1]).XYZ() - aP1).Crossed (aNodes (aNodeIds[2]).XYZ() - aP1);
+        for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+        {
+          theNormals.ChangeValue (aNodeIds[aNodeIter]) += aTriNorm;
+        }
+      }
+    }
+
+    for (Standard_Integer aNodeIter = theNormals.Lower(); aNodeIter <= theNormals.Upper(); ++aNodeIter)
+    {
+      gp_Vec aNorm (theNormals (aNodeIter));
+      aNorm.Transform (theFace.Trsf);
+      if (theFace.IsReversed)
+      {
+        aNorm.Reverse();
+      }
+      const Standard_Real aMod = aNorm.Magnitude();
+      theNormals.ChangeValue (aNodeIter) = aMod > gp::Resolution() ? aNorm.XYZ() / aMod : gp_XYZ (0.0, 0.0, 1.0);
+    }
+  }
+}
+
+//================================================================
+// Function : RWGltf_CafWriter
+// Purpose  :
+//================================================================
+RWGltf_CafWriter::RWGltf_CafWriter (const TCollection_AsciiString& theFile)
+: myFile (theFile),
+  myLengthUnitScale (0.001),
+  myToConvertZUp (Standard_True)
+{
+  //
+}
+
+//================================================================
+// Function : ~RWGltf_CafWriter
+// Purpose  :
+//================================================================
+RWGltf_CafWriter::~RWGltf_CafWriter()
+{
+  //
+}
+
+//================================================================
+// Function : Perform
+// Purpose  :
+//================================================================
+Standard_Boolean RWGltf_CafWriter::Perform (const Handle(TDocStd_Document)& theDocument,
+                                            const Handle(Message_ProgressIndicator)& theProgress)
+{
+  TDF_LabelSequence aRoots;
+  Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool (theDocument->Main());
+  aShapeTool->GetFreeShapes (aRoots);
+  return Perform (theDocument, aRoots, theProgress);
+}
+
+//================================================================
+// Function : Perform
+// Purpose  :
+//================================================================
+Standard_Boolean RWGltf_CafWriter::Perform (const Handle(TDocStd_Document)& theDocument,
+                                            const TDF_LabelSequence& theRootLabels,
+                                            const Handle(Message_ProgressIndicator)& theProgress)
+{
+  const Handle(Message_Messenger)& aMsgr = Message::DefaultMessenger();
+
+  // collect the scene
+  RWGltf_SceneBuilder aScene (XCAFDoc_DocumentTool::ColorTool (theDocument->Main()));
+  NCollection_Vector<Standard_Integer> aRootNodes;
+  for (TDF_LabelSequence::Iterator aRootIter (theRootLabels); aRootIter.More(); aRootIter.Next())
+  {
+    const Standard_Integer aNode = aScene.AddNode (aRootIter.Value(), -1);
+    if (aNode != -1)
+    {
+      aRootNodes.Append (aNode);
+    }
+  }
+  if (aRootNodes.IsEmpty())
+  {
+    aMsgr->Send (TCollection_AsciiString ("Error: the document has no triangulation to write into '") + myFile + "'", Message_Fail);
+    return Standard_False;
+  }
+
+  // compute the layout of the binary buffer:
+  // positions of all primitives, then normals, then 16-bit indices and then 32-bit indices
+  const NCollection_Vector<RWGltf_Part>& aParts = aScene.Parts();
+  NCollection_Vector<RWGltf_Mesh>& aMeshes = aScene.Meshes();
+  Standard_Size aNodesSize = 0, anInd16Size = 0, anInd32Size = 0;
+  Standard_Integer aNbAccessors = 0, aNbPrimitives = 0;
+  for (NCollection_Vector<RWGltf_Mesh>::Iterator aMeshIter (aMeshes); aMeshIter.More(); aMeshIter.Next())
+  {
+    const RWGltf_Part& aPart = aParts (aMeshIter.Value().Part);
+    for (NCollection_Vector<RWGltf_Primitive>::Iterator aPrimIter (aMeshIter.ChangeValue().Primitives); aPrimIter.More(); aPrimIter.Next())
+    {
+      RWGltf_Primitive& aPrim = aPrimIter.ChangeValue();
+      for (Standard_Integer aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+      {
+        aPrim.MinPnt[aCoordIter] =  FLT_MAX;
+        aPrim.MaxPnt[aCoordIter] = -FLT_MAX;
+      }
+      for (NCollection_Vector<Standard_Integer>::Iterator aFaceIter (aPrim.Faces); aFaceIter.More(); aFaceIter.Next())
+      {
+        const RWGltf_Face& aFace = aPart.Faces (aFaceIter.Value());
+        for (Standard_Integer aNodeIter = 1; aNodeIter <= aFace.Triangulation->NbNodes(); ++aNodeIter)
+        {
+          const gp_XYZ aPnt = facePoint (aFace, aNodeIter);
+          for (Standard_Integer aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+          {
+            const float aCoord = (float )aPnt.Coord (aCoordIter + 1);
+            aPrim.MinPnt[aCoordIter] = Min (aPrim.MinPnt[aCoordIter], aCoord);
+            aPrim.MaxPnt[aCoordIter] = Max (aPrim.MaxPnt[aCoordIter], aCoord);
+          }
+        }
+        aPrim.NbNodes     += aFace.Triangulation->NbNodes();
+        aPrim.NbTriangles += aFace.Triangulation->NbTriangles();
+      }
+
+      aPrim.NodeOffset = aNodesSize;
+      aNodesSize += Standard_Size(aPrim.NbNodes) * 12;
+      if (aPrim.IsIndex32())
+      {
+        aPrim.IndexOffset = anInd32Size;
+        anInd32Size += Standard_Size(aPrim.NbTriangles) * 12;
+      }
+      else
+      {
+        aPrim.IndexOffset = anInd16Size;
+        anInd16Size += Standard_Size(aPrim.NbTriangles) * 6;
+      }
+      aPrim.Accessor = aNbAccessors;
+      aNbAccessors += 3;
+      ++aNbPrimitives;
+    }
+  }
+
+  const Standard_Size anInd16Padding = (4 - anInd16Size % 4) % 4;
+  const Standard_Size aBinSize = aNodesSize * 2 + anInd16Size + anInd16Padding + anInd32Size;
+
+  // buffer views: positions, normals and indices of each present type
+  Standard_Integer aViewPos = 0, aViewNorm = 1, aViewInd16 = -1, aViewInd32 = -1, aNbViews = 2;
+  if (anInd16Size != 0)
+  {
+    aViewInd16 = aNbViews++;
+  }
+  if (anInd32Size != 0)
+  {
+    aViewInd32 = aNbViews++;
+  }
+
+  // write JSON
+  std::ostringstream aJson;
+  aJson.imbue (std::locale::classic());
+  aJson << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"Open CASCADE Technology\"}";
+
+  NCollection_Vector<RWGltf_Node>& aNodes = aScene.Nodes();
+  const Standard_Boolean hasRootTrsf = myToConvertZUp || myLengthUnitScale != 1.0;
+  aJson << ",\"scene\":0,\"scenes\":[{\"nodes\":[";
+  if (hasRootTrsf)
+  {
+    aJson << aNodes.Length();
+  }
+  else
+  {
+    for (Standard_Integer aRootIter = 0; aRootIter < aRootNodes.Length(); ++aRootIter)
+    {
+      aJson << (aRootIter != 0 ? "," : "") << aRootNodes (aRootIter);
+    }
+  }
+  aJson << "]}]";
+
+  aJson << ",\"nodes\":[";
+  for (Standard_Integer aNodeIter = 0; aNodeIter < aNodes.Length(); ++aNodeIter)
+  {
+    const RWGltf_Node& aNode = aNodes (aNodeIter);
+    aJson << (aNodeIter != 0 ? ",{" : "{");
+    Standard_Boolean hasField = Standard_False;
+    if (!aNode.Name.IsEmpty())
+    {
+      aJson << "\"name\":";
+      writeString (aJson, aNode.Name);
+      hasField = Standard_True;
+    }
+    Standard_Real aMat[16] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0 };
+    Standard_Boolean isIdentity = Standard_True;
+    for (Standard_Integer aCol = 0; aCol < 4; ++aCol)
+    {
+      for (Standard_Integer aRow = 0; aRow < 3; ++aRow)
+      {
+        aMat[aCol * 4 + aRow] = aNode.Trsf.Value (aRow + 1, aCol + 1);
+        isIdentity = isIdentity && aMat[aCol * 4 + aRow] == (aRow == aCol ? 1.0 : 0.0);
+      }
+    }
+    if (!isIdentity)
+    {
+      aJson << (hasField ? "," : "") << "\"matrix\":";
+      writeMatrix (aJson, aMat);
+      hasField = Standard_True;
+    }
+    if (aNode.Mesh != -1)
+    {
+      aJson << (hasField ? "," : "") << "\"mesh\":" << aNode.Mesh;
+      hasField = Standard_True;
+    }
+    if (!aNode.Children.IsEmpty())
+    {
+      aJson << (hasField ? "," : "") << "\"children\":[";
+      for (Standard_Integer aChildIter = 0; aChildIter < aNode.Children.Length(); ++aChildIter)
+      {
+        aJson << (aChildIter != 0 ? "," : "") << aNode.Children (aChildIter);
+      }
+      aJson << "]";
+    }
+    aJson << "}";
+  }
+  if (hasRootTrsf)
+  {
+    // the root node converting the document coordinate system into the glTF one (meters, Y-up)
+    const Standard_Real aScale = myLengthUnitScale;
+    Standard_Real aMat[16] = { aScale, 0.0, 0.0, 0.0,
+                               0.0, aScale, 0.0, 0.0,
+                               0.0, 0.0, aScale, 0.0,
+                               0.0, 0.0, 0.0, 1.0 };
+    if (myToConvertZUp)
+    {
+      // (x, y, z) -> (x, z, -y)
+      aMat[5] = 0.0; aMat[6] = -aScale;
+      aMat[9] = aScale; aMat[10] = 0.0;
+    }
+    aJson << (aNodes.IsEmpty() ? "{" : ",{") << "\"matrix\":";
+    writeMatrix (aJson, aMat);
+    aJson << ",\"children\":[";
+    for (Standard_Integer aRootIter = 0; aRootIter < aRootNodes.Length(); ++aRootIter)
+    {
+      aJson << (aRootIter != 0 ? "," : "") << aRootNodes (aRootIter);
+    }
+    aJson << "]}";
+  }
+  aJson << "]";
+
+  aJson << ",\"meshes\":[";
+  for (Standard_Integer aMeshIter = 0; aMeshIter < aMeshes.Length(); ++aMeshIter)
+  {
+    const RWGltf_Mesh& aMesh = aMeshes (aMeshIter);
+    aJson << (aMeshIter != 0 ? ",{" : "{");
+    if (!aParts (aMesh.Part).Name.IsEmpty())
+    {
+      aJson << "\"name\":";
+      writeString (aJson, aParts (aMesh.Part).Name);
+      aJson << ",";
+    }
+    aJson << "\"primitives\":[";
+    for (Standard_Integer aPrimIter = 0; aPrimIter < aMesh.Primitives.Length(); ++aPrimIter)
+    {
+      const RWGltf_Primitive& aPrim = aMesh.Primitives (aPrimIter);
+      aJson << (aPrimIter != 0 ? ",{" : "{")
+            << "\"attributes\":{\"POSITION\":" << aPrim.Accessor << ",\"NORMAL\":" << (aPrim.Accessor + 1) << "}"
+            << ",\"indices\":" << (aPrim.Accessor + 2) << ",\"mode\":4";
+      if (aPrim.Material >= 0)
+      {
+        aJson << ",\"material\":" << aPrim.Material;
+      }
+      aJson << "}";
+    }
+    aJson << "]}";
+  }
+  aJson << "]";
+
+  const NCollection_IndexedMap<Quantity_ColorRGBA, Quantity_ColorRGBAHasher>& aMaterials = aScene.Materials();
+  if (!aMaterials.IsEmpty())
+  {
+    aJson << ",\"materials\":[";
+    for (Standard_Integer aMatIter = 1; aMatIter <= aMaterials.Extent(); ++aMatIter)
+    {
+      const Quantity_ColorRGBA& aColor = aMaterials (aMatIter);
+      aJson << (aMatIter != 1 ? "," : "") << "{\"pbrMetallicRoughness\":{\"baseColorFactor\":[";
+      writeFloat (aJson, aColor.GetRGB().Red());   aJson << ",";
+      writeFloat (aJson, aColor.GetRGB().Green()); aJson << ",";
+      writeFloat (aJson, aColor.GetRGB().Blue());  aJson << ",";
+      writeFloat (aJson, aColor.Alpha());
+      aJson << "],\"metallicFactor\":0,\"roughnessFactor\":1}";
+      if (aColor.Alpha() < 1.0f)
+      {
+        aJson << ",\"alphaMode\":\"BLEND\"";
+      }
+      aJson << "}";
+    }
+    aJson << "]";
+  }
+
+  aJson << ",\"accessors\":[";
+  Standard_Boolean isFirstAccessor = Standard_True;
+  for (NCollection_Vector<RWGltf_Mesh>::Iterator aMeshIter (aMeshes); aMeshIter.More(); aMeshIter.Next())
+  {
+    for (NCollection_Vector<RWGltf_Primitive>::Iterator aPrimIter (aMeshIter.Value().Primitives); aPrimIter.More(); aPrimIter.Next())
+    {
+      const RWGltf_Primitive& aPrim = aPrimIter.Value();
+      aJson << (isFirstAccessor ? "{" : ",{")
+            << "\"bufferView\":" << aViewPos << ",\"byteOffset\":" << aPrim.NodeOffset
+            << ",\"componentType\":" << THE_GLTF_FLOAT << ",\"count\":" << aPrim.NbNodes << ",\"type\":\"VEC3\",\"min\":[";
+      writeFloat (aJson, aPrim.MinPnt[0]); aJson << ","; writeFloat (aJson, aPrim.MinPnt[1]); aJson << ","; writeFloat (aJson, aPrim.MinPnt[2]);
+      aJson << "],\"max\":[";
+      writeFloat (aJson, aPrim.MaxPnt[0]); aJson << ","; writeFloat (aJson, aPrim.MaxPnt[1]); aJson << ","; writeFloat (aJson, aPrim.MaxPnt[2]);
+      aJson << "]}";
+      aJson << ",{\"bufferView\":" << aViewNorm << ",\"byteOffset\":" << aPrim.NodeOffset
+            << ",\"componentType\":" << THE_GLTF_FLOAT << ",\"count\":" << aPrim.NbNodes << ",\"type\":\"VEC3\"}";
+      aJson << ",{\"bufferView\":" << (aPrim.IsIndex32() ? aViewInd32 : aViewInd16) << ",\"byteOffset\":" << aPrim.IndexOffset
+            << ",\"componentType\":" << (aPrim.IsIndex32() ? THE_GLTF_UNSIGNED_INT : THE_GLTF_UNSIGNED_SHORT)
+            << ",\"count\":" << (aPrim.NbTriangles * 3) << ",\"type\":\"SCALAR\"}";
+      isFirstAccessor = Standard_False;
+    }
+  }
+  aJson << "]";
+
+  aJson << ",\"bufferViews\":["
+        << "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << aNodesSize
+        << ",\"byteStride\":12,\"target\":" << THE_GLTF_ARRAY_BUFFER << "}"
+        << ",{\"buffer\":0,\"byteOffset\":" << aNodesSize << ",\"byteLength\":" << aNodesSize
+        << ",\"byteStride\":12,\"target\":" << THE_GLTF_ARRAY_BUFFER << "}";
+  if (aViewInd16 != -1)
+  {
+    aJson << ",{\"buffer\":0,\"byteOffset\":" << (aNodesSize * 2) << ",\"byteLength\":" << anInd16Size
+          << ",\"target\":" << THE_GLTF_ELEMENT_ARRAY_BUFFER << "}";
+  }
+  if (aViewInd32 != -1)
+  {
+    aJson << ",{\"buffer\":0,\"byteOffset\":" << (aNodesSize * 2 + anInd16Size + anInd16Padding) << ",\"byteLength\":" << anInd32Size
+          << ",\"target\":" << THE_GLTF_ELEMENT_ARRAY_BUFFER << "}";
+  }
+  aJson << "]";
+  aJson << ",\"buffers\":[{\"byteLength\":" << aBinSize << "}]}";
+
+  std::string aJsonStr = aJson.str();
+  aJsonStr.append ((4 - aJsonStr.size() % 4) % 4, ' ');
+  const Standard_Size aFileSize = 12 + 8 + aJsonStr.size() + 8 + aBinSize;
+  if (aFileSize > 0xFFFFFFFFu)
+  {
+    aMsgr->Send (TCollection_AsciiString ("Error: the size of GLB file '") + myFile + "' exceeds 4 GiB", Message_Fail);
+    return Standard_False;
+  }
+
+  FILE* aFile = OSD_OpenFile (myFile.ToCString(), "wb");
+  if (aFile == NULL)
+  {
+    aMsgr->Send (TCollection_AsciiString ("Error: file '") + myFile + "' cannot be created", Message_Fail);
+    return Standard_False;
+  }
+
+  char aHeader[20];
+  putUInt32 (aHeader,      THE_GLB_MAGIC);
+  putUInt32 (aHeader + 4,  THE_GLB_VERSION);
+  putUInt32 (aHeader + 8,  aFileSize);
+  putUInt32 (aHeader + 12, aJsonStr.size());
+  putUInt32 (aHeader + 16, THE_GLB_CHUNK_JSON);
+  Standard_Boolean isOK = fwrite (aHeader, 1, 20, aFile) == 20
+                       && fwrite (aJsonStr.data(), 1, aJsonStr.size(), aFile) == aJsonStr.size();
+  aJsonStr.clear();
+
+  putUInt32 (aHeader,     aBinSize);
+  putUInt32 (aHeader + 4, THE_GLB_CHUNK_BIN);
+  isOK = isOK && fwrite (aHeader, 1, 8, aFile) == 8;
+
+  // stream the binary chunk in the order of buffer views
+  Message_ProgressSentry aPSentry (theProgress, "Writing glTF buffers", 0, aNbPrimitives * 3, 1);
+  RWGltf_BinaryStream aBinStream (aFile);
+  for (Standard_Integer aPass = 0; aPass < 4 && isOK; ++aPass)
+  {
+    for (NCollection_Vector<RWGltf_Mesh>::Iterator aMeshIter (aMeshes); aMeshIter.More() && isOK; aMeshIter.Next())
+    {
+      const RWGltf_Part& aPart = aParts (aMeshIter.Value().Part);
+      for (NCollection_Vector<RWGltf_Primitive>::Iterator aPrimIter (aMeshIter.Value().Primitives); aPrimIter.More(); aPrimIter.Next())
+      {
+        const RWGltf_Primitive& aPrim = aPrimIter.Value();
+        if ((aPass == 2 &&  aPrim.IsIndex32())
+         || (aPass == 3 && !aPrim.IsIndex32()))
+        {
+          continue;
+        }
+
+        Standard_Integer aFirstNode = 0;
+        for (NCollection_Vector<Standard_Integer>::Iterator aFaceIter (aPrim.Faces); aFaceIter.More(); aFaceIter.Next())
+        {
+          const RWGltf_Face& aFace = aPart.Faces (aFaceIter.Value());
+          const Standard_Integer aNbNodes = aFace.Triangulation->NbNodes();
+          if (aPass == 0)
+          {
+            for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+            {
+              const gp_XYZ aPnt = facePoint (aFace, aNodeIter);
+              aBinStream.Put ((float )aPnt.X());
+              aBinStream.Put ((float )aPnt.Y());
+              aBinStream.Put ((float )aPnt.Z());
+            }
+          }
+          else if (aPass == 1)
+          {
+            NCollection_Array1<gp_XYZ> aNormals (1, aNbNodes);
+            faceNormals (aFace, aNormals);
+            for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+            {
+              const gp_XYZ& aNorm = aNormals (aNodeIter);
+              aBinStream.Put ((float )aNorm.X());
+              aBinStream.Put ((float )aNorm.Y());
+              aBinStream.Put ((float )aNorm.Z());
+            }
+          }
+          else
+          {
+            const Standard_Integer aNbTris = aFace.Triangulation->NbTriangles();
+            for (Standard_Integer aTriIter = 1; aTriIter <= aNbTris; ++aTriIter)
+            {
+              Standard_Integer aNodeIds[3];
+              faceTriangle (aFace, aTriIter, aNodeIds);
+              for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+              {
+                const Standard_Integer anIndex = aFirstNode + aNodeIds[aNodeIter] - 1;
+                if (aPass == 2)
+                {
+                  aBinStream.Put ((uint16_t )anIndex);
+                }
+                else
+                {
+                  aBinStream.Put ((uint32_t )anIndex);
+                }
+              }
+            }
+          }
+          aFirstNode += aNbNodes;
+        }
+
+        aPSentry.Next();
+      }
+      if (!aPSentry.More())
+      {
+        isOK = Standard_False;
+      }
+    }
+    if (aPass == 2)
+    {
+      aBinStream.Pad (anInd16Padding);
+    }
+    isOK = isOK && aBinStream.Flush();
+  }
+
+  fclose (aFile);
+  if (!isOK)
+  {
+    aMsgr->Send (TCollection_AsciiString ("Error: file '") + myFile + "' has not been written", Message_Fail);
+  }
+  return isOK;
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWGltf_CafWriter_HeaderFile
+#define _RWGltf_CafWriter_HeaderFile
+
+#include <Message_ProgressIndicator.hxx>
+#include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TDF_LabelSequence.hxx>
+
+class TDocStd_Document;
+
+//! Writer of meshed XCAF document into binary glTF 2.0 file (GLB).
+//!
+//! The assembly structure of the document is exported as the node hierarchy:
+//! every instance of a part or a sub-assembly becomes a node with its own transformation,
+//! while the triangulation of each part is written only once into the binary buffer
+//! and shared by all the nodes instancing it.
+//! Faces of the part are grouped into primitives by their color,
+//! colors being taken from XCAFDoc_ColorTool in the same way as for presentation of the document.
+//!
+//! The shapes should be meshed in advance (e.g. by BRepMesh_IncrementalMesh);
+//! faces without triangulation are skipped.
+//! Node positions and normals are written as 32-bit floats,
+//! indices as 16-bit or 32-bit unsigned integers depending on the size of the primitive.
+//! The binary buffer is streamed directly to the file.
+class RWGltf_CafWriter : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(RWGltf_CafWriter, Standard_Transient)
+public:
+
+  //! Main constructor.
+  //! @param theFile path to the output GLB file
+  Standard_EXPORT RWGltf_CafWriter (const TCollection_AsciiString& theFile);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~RWGltf_CafWriter();
+
+  //! Return the scale factor converting document length units into meters (glTF units);
+  //! 0.001 by default (document in millimeters).
+  Standard_Real LengthUnitScale() const { return myLengthUnitScale; }
+
+  //! Set the scale factor converting document length units into meters.
+  void SetLengthUnitScale (const Standard_Real theScale) { myLengthUnitScale = theScale; }
+
+  //! Return TRUE if the Z-up coordinate system of the document should be converted
+  //! into the Y-up coordinate system of glTF; TRUE by default.
+  Standard_Boolean ToConvertZUpToYUp() const { return myToConvertZUp; }
+
+  //! Set flag to convert Z-up coordinate system into Y-up one.
+  void SetConvertZUpToYUp (const Standard_Boolean theToConvert) { myToConvertZUp = theToConvert; }
+
+  //! Write the free shapes of the document into the file.
+  //! @param theDocument input document
+  //! @param theProgress optional progress indicator
+  //! @return FALSE if the file cannot be written or the document contains no triangulation
+  Standard_EXPORT virtual Standard_Boolean Perform (const Handle(TDocStd_Document)& theDocument,
+                                                    const Handle(Message_ProgressIndicator)& theProgress = Handle(Message_ProgressIndicator)());
+
+  //! Write the specified root labels of the document into the file.
+  //! @param theDocument   input document
+  //! @param theRootLabels labels of the shapes (or of the components of assemblies) to export
+  //! @param theProgress   optional progress indicator
+  //! @return FALSE if the file cannot be written or the shapes contain no triangulation
+  Standard_EXPORT virtual Standard_Boolean Perform (const Handle(TDocStd_Document)& theDocument,
+                                                    const TDF_LabelSequence& theRootLabels,
+                                                    const Handle(Message_ProgressIndicator)& theProgress = Handle(Message_ProgressIndicator)());
+
+protected:
+
+  TCollection_AsciiString myFile;            //!< output file
+  Standard_Real           myLengthUnitScale; //!< scale factor to meters
+  Standard_Boolean        myToConvertZUp;    //!< flag to convert Z-up into Y-up
+
+};
+
+DEFINE_STANDARD_HANDLE(RWGltf_CafWriter, Standard_Transient)
+
+#endif // _RWGltf_CafWriter_HeaderFile
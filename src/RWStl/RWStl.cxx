@@ -15,11 +15,20 @@
 
 #include <RWStl.hxx>
 
+#include <BRep_Tool.hxx>
 #include <Message_ProgressSentry.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vec3.hxx>
 #include <NCollection_Vector.hxx>
 #include <OSD_File.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <RWStl_Reader.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <algorithm>
+#include <string.h>
 
 namespace
 {
@@ -104,6 +113,529 @@ namespace
 
 }
 
+namespace
+{
+  typedef NCollection_Vec3<Standard_ShortReal> Vec3f;
+
+  static const size_t THE_STL_HEADER_SIZE = 84;
+
+  //! Number of facets read from the file at once.
+  static const Standard_Integer THE_STL_CHUNK_NBFACETS = 65536;
+
+  //! Number of vertices processed by one task of the welding.
+  static const Standard_Integer THE_WELD_BLOCK_SIZE = 65536;
+
+  //! Vertices are distributed into 2^THE_WELD_NB_PARTS_LOG partitions by their hash code,
+  //! the partitions are welded independently.
+  static const Standard_Integer THE_WELD_NB_PARTS_LOG = 8;
+  static const Standard_Integer THE_WELD_NB_PARTS     = 1 << THE_WELD_NB_PARTS_LOG;
+
+  //! Returns bits of the float value; both zeros give the same bits.
+  inline static uint32_t floatBits (Standard_ShortReal theValue)
+  {
+    if (theValue == 0.0f)
+    {
+      theValue = 0.0f;
+    }
+    uint32_t aBits;
+    memcpy (&aBits, &theValue, sizeof(aBits));
+    return aBits;
+  }
+
+  //! Hash code of the vertex consistent with isSameVertex().
+  inline static uint32_t vertexHash (const Vec3f& theVec)
+  {
+    uint32_t aHash = (floatBits (theVec.x()) * 73856093u)
+                   ^ (floatBits (theVec.y()) * 19349663u)
+                   ^ (floatBits (theVec.z()) * 83492791u);
+    aHash ^= aHash >> 16;
+    aHash *= 0x85ebca6bu;
+    aHash ^= aHash >> 13;
+    return aHash;
+  }
+
+  //! Vertices are merged when their coordinates are exactly equal.
+  inline static bool isSameVertex (const Vec3f& theVec1, const Vec3f& theVec2)
+  {
+    return theVec1.x() == theVec2.x()
+        && theVec1.y() == theVec2.y()
+        && theVec1.z() == theVec2.z();
+  }
+
+  //! Vertex reference within a partition of welding.
+  struct WeldVertex
+  {
+    uint32_t         Hash;
+    Standard_Integer Index;
+  };
+
+  //! Counts the vertices per partition within each block.
+  class WeldCountFunctor
+  {
+  public:
+    WeldCountFunctor (const NCollection_Array1<Vec3f>&      theVerts,
+                      NCollection_Array1<Standard_Integer>& theCounts)
+    : myVerts (theVerts), myCounts (theCounts) {}
+
+    void operator() (const Standard_Integer theBlock) const
+    {
+      const Standard_Integer aLower = theBlock * THE_WELD_BLOCK_SIZE;
+      const Standard_Integer anUpper = Min (aLower + THE_WELD_BLOCK_SIZE, myVerts.Length());
+      Standard_Integer* aCounts = &myCounts.ChangeValue (theBlock * THE_WELD_NB_PARTS);
+      for (Standard_Integer aVertIter = aLower; aVertIter < anUpper; ++aVertIter)
+      {
+        ++aCounts[vertexHash (myVerts.Value (aVertIter)) >> (32 - THE_WELD_NB_PARTS_LOG)];
+      }
+    }
+
+  private:
+    WeldCountFunctor& operator= (const WeldCountFunctor&);
+
+  private:
+    const NCollection_Array1<Vec3f>&      myVerts;
+    NCollection_Array1<Standard_Integer>& myCounts;
+  };
+
+  //! Distributes the vertices of each block into partitions,
+  //! keeping them in increasing order within each partition.
+  //! The hash codes are computed again rather than kept
+  //! between the passes to save memory on large meshes.
+  class WeldScatterFunctor
+  {
+  public:
+    WeldScatterFunctor (const NCollection_Array1<Vec3f>&            theVerts,
+                        const NCollection_Array1<Standard_Integer>& theOffsets,
+                        NCollection_Array1<WeldVertex>&             theParts)
+    : myVerts (theVerts), myOffsets (theOffsets), myParts (theParts) {}
+
+    void operator() (const Standard_Integer theBlock) const
+    {
+      Standard_Integer anOffsets[THE_WELD_NB_PARTS];
+      memcpy (anOffsets, &myOffsets.Value (theBlock * THE_WELD_NB_PARTS), sizeof(anOffsets));
+      const Standard_Integer aLower = theBlock * THE_WELD_BLOCK_SIZE;
+      const Standard_Integer anUpper = Min (aLower + THE_WELD_BLOCK_SIZE, myVerts.Length());
+      for (Standard_Integer aVertIter = aLower; aVertIter < anUpper; ++aVertIter)
+      {
+        const uint32_t aHash = vertexHash (myVerts.Value (aVertIter));
+        WeldVertex& aVert = myParts.ChangeValue (anOffsets[aHash >> (32 - THE_WELD_NB_PARTS_LOG)]++);
+        aVert.Hash  = aHash;
+        aVert.Index = aVertIter;
+      }
+    }
+
+  private:
+    WeldScatterFunctor& operator= (const WeldScatterFunctor&);
+
+  private:
+    const NCollection_Array1<Vec3f>&            myVerts;
+    const NCollection_Array1<Standard_Integer>& myOffsets;
+    NCollection_Array1<WeldVertex>&             myParts;
+  };
+
+  //! Welds the vertices of one partition through an open addressing hash table:
+  //! each vertex refers to the first (lowest) vertex with the same coordinates.
+  class WeldPartFunctor
+  {
+  public:
+    WeldPartFunctor (const NCollection_Array1<Vec3f>&            theVerts,
+                     const NCollection_Array1<WeldVertex>&       theParts,
+                     const NCollection_Array1<Standard_Integer>& thePartStarts,
+                     NCollection_Array1<Standard_Integer>&       theFirst)
+    : myVerts (theVerts), myParts (theParts),
+      myPartStarts (thePartStarts), myFirst (theFirst) {}
+
+    void operator() (const Standard_Integer thePart) const
+    {
+      const Standard_Integer aLower = myPartStarts.Value (thePart);
+      const Standard_Integer anUpper = myPartStarts.Value (thePart + 1);
+      if (aLower == anUpper)
+      {
+        return;
+      }
+
+      uint32_t aMask = 1;
+      while (aMask < uint32_t(anUpper - aLower) * 2)
+      {
+        aMask <<= 1;
+      }
+      --aMask;
+      WeldVertex anEmpty;
+      anEmpty.Hash  = 0;
+      anEmpty.Index = -1;
+      NCollection_Array1<WeldVertex> aTable (0, Standard_Integer(aMask));
+      aTable.Init (anEmpty);
+      for (Standard_Integer anIter = aLower; anIter < anUpper; ++anIter)
+      {
+        const WeldVertex& aVert = myParts.Value (anIter);
+        Standard_Integer aFirst = aVert.Index;
+        for (uint32_t aSlot = aVert.Hash & aMask;; aSlot = (aSlot + 1) & aMask)
+        {
+          WeldVertex& anOther = aTable.ChangeValue (aSlot);
+          if (anOther.Index == -1)
+          {
+            anOther = aVert;
+            break;
+          }
+          if (anOther.Hash == aVert.Hash
+           && isSameVertex (myVerts.Value (anOther.Index), myVerts.Value (aVert.Index)))
+          {
+            aFirst = anOther.Index;
+            break;
+          }
+        }
+        myFirst.ChangeValue (aVert.Index) = aFirst;
+      }
+    }
+
+  private:
+    WeldPartFunctor& operator= (const WeldPartFunctor&);
+
+  private:
+    const NCollection_Array1<Vec3f>&            myVerts;
+    const NCollection_Array1<WeldVertex>&       myParts;
+    const NCollection_Array1<Standard_Integer>& myPartStarts;
+    NCollection_Array1<Standard_Integer>&       myFirst;
+  };
+
+  //! Reads binary STL stream containing exactly theNbFacets facets after the header
+  //! (the stream should be positioned at the beginning of the file) and
+  //! builds the triangulation directly, welding the nodes with equal coordinates in parallel.
+  //! The nodes are numbered in the order of their first appearance in the file,
+  //! as done by RWStl_Reader.
+  static Standard_Boolean readBinaryMesh (Standard_IStream&                        theStream,
+                                          const Standard_Integer                   theNbFacets,
+                                          const Handle(Message_ProgressIndicator)& theProgress,
+                                          Handle(Poly_Triangulation)&              theMesh)
+  {
+    const Standard_Integer aNbChunks = (theNbFacets + THE_STL_CHUNK_NBFACETS - 1) / THE_STL_CHUNK_NBFACETS;
+    Message_ProgressSentry aPSentry (theProgress, "Reading binary STL file", 0, aNbChunks + 1, 1);
+
+    char aHeader[THE_STL_HEADER_SIZE];
+    if (theStream.read (aHeader, THE_STL_HEADER_SIZE).gcount() != std::streamsize(THE_STL_HEADER_SIZE))
+    {
+      return Standard_False;
+    }
+
+    // read vertices (skipping normals and attributes)
+    const Standard_Integer aNbVerts = theNbFacets * 3;
+    NCollection_Array1<Vec3f> aVerts (0, aNbVerts - 1);
+    {
+      NCollection_Array1<char> aBuffer (0, THE_STL_SIZEOF_FACET * Min (theNbFacets, THE_STL_CHUNK_NBFACETS) - 1);
+      Standard_Integer aVertIter = 0;
+      for (Standard_Integer aFacetIter = 0; aFacetIter < theNbFacets && aPSentry.More(); aPSentry.Next())
+      {
+        const Standard_Integer aNbChunkFacets = Min (THE_STL_CHUNK_NBFACETS, theNbFacets - aFacetIter);
+        const std::streamsize aDataToRead = std::streamsize(aNbChunkFacets) * THE_STL_SIZEOF_FACET;
+        if (theStream.read (&aBuffer.ChangeFirst(), aDataToRead).gcount() != aDataToRead)
+        {
+          return Standard_False;
+        }
+        const char* aFacet = &aBuffer.First();
+        for (Standard_Integer aChunkIter = 0; aChunkIter < aNbChunkFacets; ++aChunkIter, aFacet += THE_STL_SIZEOF_FACET)
+        {
+          for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+          {
+            const char* aData = aFacet + sizeof(float) * 3 * aNodeIter;
+            aVerts.ChangeValue (aVertIter++) = Vec3f (RWStl_Reader::ReadFloat (aData),
+                                                      RWStl_Reader::ReadFloat (aData + sizeof(float)),
+                                                      RWStl_Reader::ReadFloat (aData + sizeof(float) * 2));
+          }
+        }
+        aFacetIter += aNbChunkFacets;
+      }
+    }
+    if (!aPSentry.More())
+    {
+      return Standard_False;
+    }
+
+    // weld vertices: distribute them into partitions by hash code
+    // and find the first vertex with the same coordinates within each partition
+    const Standard_Integer aNbBlocks = (aNbVerts + THE_WELD_BLOCK_SIZE - 1) / THE_WELD_BLOCK_SIZE;
+    NCollection_Array1<Standard_Integer> aFirst (0, aNbVerts - 1);
+    {
+      NCollection_Array1<Standard_Integer> aCounts (0, aNbBlocks * THE_WELD_NB_PARTS - 1);
+      aCounts.Init (0);
+      OSD_Parallel::For (0, aNbBlocks, WeldCountFunctor (aVerts, aCounts));
+
+      // offsets of each block within each partition
+      NCollection_Array1<Standard_Integer> aPartStarts (0, THE_WELD_NB_PARTS);
+      Standard_Integer anOffset = 0;
+      for (Standard_Integer aPartIter = 0; aPartIter < THE_WELD_NB_PARTS; ++aPartIter)
+      {
+        aPartStarts.ChangeValue (aPartIter) = anOffset;
+        for (Standard_Integer aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+        {
+          Standard_Integer& aCount = aCounts.ChangeValue (aBlockIter * THE_WELD_NB_PARTS + aPartIter);
+          const Standard_Integer aNb = aCount;
+          aCount = anOffset;
+          anOffset += aNb;
+        }
+      }
+      aPartStarts.ChangeLast() = anOffset;
+
+      NCollection_Array1<WeldVertex> aParts (0, aNbVerts - 1);
+      OSD_Parallel::For (0, aNbBlocks, WeldScatterFunctor (aVerts, aCounts, aParts));
+      OSD_Parallel::For (0, THE_WELD_NB_PARTS, WeldPartFunctor (aVerts, aParts, aPartStarts, aFirst));
+    }
+    aPSentry.Next();
+
+    // number the nodes in the order of their first appearance;
+    // aFirst is reused to store node indices as negative values
+    Standard_Integer aNbNodes = 0, aNbTris = 0;
+    for (Standard_Integer aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+    {
+      const Standard_Integer aRef = aFirst.Value (aVertIter);
+      aFirst.ChangeValue (aVertIter) = aRef == aVertIter ? -(++aNbNodes) : aFirst.Value (aRef);
+    }
+    for (Standard_Integer aVertIter = 0; aVertIter < aNbVerts; aVertIter += 3)
+    {
+      const Standard_Integer aN1 = aFirst.Value (aVertIter), aN2 = aFirst.Value (aVertIter + 1), aN3 = aFirst.Value (aVertIter + 2);
+      if (aN1 != aN2 && aN2 != aN3 && aN3 != aN1)
+      {
+        ++aNbTris;
+      }
+    }
+    if (aNbTris == 0)
+    {
+      return Standard_True;
+    }
+
+    theMesh = new Poly_Triangulation (aNbNodes, aNbTris, Standard_False);
+    TColgp_Array1OfPnt&    aNodes = theMesh->ChangeNodes();
+    Poly_Array1OfTriangle& aTris  = theMesh->ChangeTriangles();
+    Standard_Integer aTriIter = 1, aLastNode = 0;
+    for (Standard_Integer aVertIter = 0; aVertIter < aNbVerts; aVertIter += 3)
+    {
+      const Standard_Integer aN1 = -aFirst.Value (aVertIter), aN2 = -aFirst.Value (aVertIter + 1), aN3 = -aFirst.Value (aVertIter + 2);
+      for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        // nodes are numbered incrementally, so a new number means the first occurrence
+        const Standard_Integer aNode = -aFirst.Value (aVertIter + aNodeIter);
+        if (aNode > aLastNode)
+        {
+          const Vec3f& aVert = aVerts.Value (aVertIter + aNodeIter);
+          aNodes.ChangeValue (aNode).SetCoord (aVert.x(), aVert.y(), aVert.z());
+          aLastNode = aNode;
+        }
+      }
+      if (aN1 != aN2 && aN2 != aN3 && aN3 != aN1)
+      {
+        aTris.ChangeValue (aTriIter++).Set (aN1, aN2, aN3);
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Reads the file with readBinaryMesh() if it is a binary STL file containing a single solid.
+  //! Returns FALSE if the file should be read by generic reader;
+  //! otherwise the resulting triangulation is null in case of error or user break.
+  static Standard_Boolean readBinaryFile (const TCollection_AsciiString&           thePath,
+                                          const Handle(Message_ProgressIndicator)& theProgress,
+                                          Handle(Poly_Triangulation)&              theMesh)
+  {
+    std::filebuf aBuf;
+    OSD_OpenStream (aBuf, thePath, std::ios::in | std::ios::binary);
+    if (!aBuf.is_open())
+    {
+      return Standard_False;
+    }
+
+    Standard_IStream aStream (&aBuf);
+    aStream.seekg (0, aStream.end);
+    const int64_t aFileSize = (int64_t )aStream.tellg();
+    aStream.seekg (0, aStream.beg);
+    if (aFileSize < int64_t(THE_STL_HEADER_SIZE + THE_STL_SIZEOF_FACET))
+    {
+      return Standard_False;
+    }
+
+    // the number of facets should match the file size exactly
+    // (otherwise the file contains several solids or is corrupted)
+    const int64_t aNbFacets = (aFileSize - int64_t(THE_STL_HEADER_SIZE)) / THE_STL_SIZEOF_FACET;
+    if (aNbFacets * THE_STL_SIZEOF_FACET + int64_t(THE_STL_HEADER_SIZE) != aFileSize
+     || aNbFacets > IntegerLast() / 3)
+    {
+      return Standard_False;
+    }
+
+    // number of facets is stored as 32-bit little-endian integer at position 80
+    char aHeader[THE_STL_HEADER_SIZE];
+    if (aStream.read (aHeader, THE_STL_HEADER_SIZE).gcount() != std::streamsize(THE_STL_HEADER_SIZE))
+    {
+      return Standard_False;
+    }
+    uint32_t aNbFacetsHeader = 0;
+    for (Standard_Integer aByteIter = 3; aByteIter >= 0; --aByteIter)
+    {
+      aNbFacetsHeader = (aNbFacetsHeader << 8) | (unsigned char )aHeader[80 + aByteIter];
+    }
+    if (int64_t(aNbFacetsHeader) != aNbFacets)
+    {
+      return Standard_False;
+    }
+
+    aStream.seekg (0, aStream.beg);
+    Reader aReader;
+    if (aReader.IsAscii (aStream))
+    {
+      return Standard_False;
+    }
+    aStream.seekg (0, aStream.beg);
+    theMesh.Nullify();
+    readBinaryMesh (aStream, Standard_Integer(aNbFacets), theProgress, theMesh);
+    return Standard_True;
+  }
+
+  //! Number of facets formatted by one task of binary writing.
+  static const Standard_Integer THE_WRITE_BLOCK_NBFACETS = 4096;
+
+  //! Triangulation of a face to be written.
+  struct FaceMesh
+  {
+    Handle(Poly_Triangulation) Triangulation;
+    gp_Trsf                    Trsf;
+    Standard_Boolean           IsReversed;
+    Standard_Integer           FirstFacet; //!< index of the first facet of the face within the file, from 0
+  };
+
+  //! Formats blocks of binary facet records of facets [theFirst, theLast) into the chunk buffer.
+  class FacetFormatFunctor
+  {
+  public:
+    FacetFormatFunctor (const NCollection_Array1<FaceMesh>& theFaces,
+                        const Standard_Integer              theFirst,
+                        const Standard_Integer              theLast,
+                        Standard_Character*                 theChunk)
+    : myFaces (theFaces), myFirst (theFirst), myLast (theLast), myChunk (theChunk) {}
+
+    void operator() (const Standard_Integer theBlock) const
+    {
+      const Standard_Integer aFirst = myFirst + theBlock * THE_WRITE_BLOCK_NBFACETS;
+      const Standard_Integer aLast  = Min (aFirst + THE_WRITE_BLOCK_NBFACETS, myLast);
+
+      // find the face containing the first facet of the block
+      Standard_Integer aFaceLower = myFaces.Lower(), aFaceUpper = myFaces.Upper();
+      while (aFaceLower < aFaceUpper)
+      {
+        const Standard_Integer aMid = (aFaceLower + aFaceUpper + 1) / 2;
+        if (myFaces (aMid).FirstFacet <= aFirst)
+          aFaceLower = aMid;
+        else
+          aFaceUpper = aMid - 1;
+      }
+
+      Standard_Character* aData = myChunk + Standard_Size(aFirst - myFirst) * THE_STL_SIZEOF_FACET;
+      for (Standard_Integer aFaceIter = aFaceLower, aFacet = aFirst; aFacet < aLast; ++aFaceIter)
+      {
+        const FaceMesh& aFace = myFaces (aFaceIter);
+        const TColgp_Array1OfPnt&    aNodes     = aFace.Triangulation->Nodes();
+        const Poly_Array1OfTriangle& aTriangles = aFace.Triangulation->Triangles();
+        for (Standard_Integer aTriIter = aTriangles.Lower() + aFacet - aFace.FirstFacet;
+             aTriIter <= aTriangles.Upper() && aFacet < aLast; ++aTriIter, ++aFacet, aData += THE_STL_SIZEOF_FACET)
+        {
+          Standard_Integer id[3];
+          aTriangles (aTriIter).Get (id[0], id[1], id[2]);
+          if (aFace.IsReversed)
+          {
+            std::swap (id[1], id[2]);
+          }
+
+          gp_Pnt aP1 = aNodes (id[0]);
+          gp_Pnt aP2 = aNodes (id[1]);
+          gp_Pnt aP3 = aNodes (id[2]);
+          if (aFace.Trsf.Form() != gp_Identity)
+          {
+            aP1.Transform (aFace.Trsf);
+            aP2.Transform (aFace.Trsf);
+            aP3.Transform (aFace.Trsf);
+          }
+
+          gp_Vec aVNorm = gp_Vec (aP1, aP2).Crossed (gp_Vec (aP1, aP3));
+          if (aVNorm.SquareMagnitude() > gp::Resolution())
+          {
+            aVNorm.Normalize();
+          }
+          else
+          {
+            aVNorm.SetCoord (0.0, 0.0, 0.0);
+          }
+
+          convertDouble (aVNorm.X(), aData);      convertDouble (aVNorm.Y(), aData + 4);  convertDouble (aVNorm.Z(), aData + 8);
+          convertDouble (aP1.X(),    aData + 12); convertDouble (aP1.Y(),    aData + 16); convertDouble (aP1.Z(),    aData + 20);
+          convertDouble (aP2.X(),    aData + 24); convertDouble (aP2.Y(),    aData + 28); convertDouble (aP2.Z(),    aData + 32);
+          convertDouble (aP3.X(),    aData + 36); convertDouble (aP3.Y(),    aData + 40); convertDouble (aP3.Z(),    aData + 44);
+          aData[48] = 0;
+          aData[49] = 0;
+        }
+      }
+    }
+
+  private:
+    FacetFormatFunctor& operator= (const FacetFormatFunctor&);
+
+  private:
+    const NCollection_Array1<FaceMesh>& myFaces;
+    const Standard_Integer              myFirst;
+    const Standard_Integer              myLast;
+    Standard_Character*                 myChunk;
+  };
+
+  //! Writes binary STL file with the facets of the given face triangulations.
+  //! The facet records are formatted in parallel into the chunk buffer and written sequentially,
+  //! so that the memory overhead does not depend on the number of facets.
+  static Standard_Boolean writeBinaryFaces (const NCollection_Array1<FaceMesh>&      theFaces,
+                                            const Standard_Integer                   theNbFacets,
+                                            FILE*                                    theFile,
+                                            const Handle(Message_ProgressIndicator)& theProgInd)
+  {
+    char aHeader[80] = "STL Exported by OpenCASCADE [www.opencascade.com]";
+    if (fwrite (aHeader, 1, 80, theFile) != 80)
+    {
+      return Standard_False;
+    }
+
+    Message_ProgressSentry aPS (theProgInd, "Triangles", 0,
+                                theNbFacets, IND_THRESHOLD);
+
+    Standard_Character aConv[4];
+    convertInteger (theNbFacets, aConv);
+    if (fwrite (aConv, 1, 4, theFile) != 4)
+    {
+      return Standard_False;
+    }
+    if (theNbFacets == 0)
+    {
+      return Standard_True;
+    }
+
+    const Standard_Integer aNbChunkBlocks    = 16;
+    const Standard_Integer aNbChunkTriangles = THE_WRITE_BLOCK_NBFACETS * aNbChunkBlocks;
+    NCollection_Array1<Standard_Character> aData (1, Standard_Size(Min (aNbChunkTriangles, theNbFacets)) * THE_STL_SIZEOF_FACET);
+    Standard_Character* aDataChunk = &aData.ChangeFirst();
+    for (Standard_Integer aFirst = 0; aFirst < theNbFacets; aFirst += aNbChunkTriangles)
+    {
+      const Standard_Integer aLast = Min (aFirst + aNbChunkTriangles, theNbFacets);
+      const Standard_Integer aNbBlocks = (aLast - aFirst + THE_WRITE_BLOCK_NBFACETS - 1) / THE_WRITE_BLOCK_NBFACETS;
+      OSD_Parallel::For (0, aNbBlocks, FacetFormatFunctor (theFaces, aFirst, aLast, aDataChunk));
+
+      const Standard_Size aChunkSize = Standard_Size(aLast - aFirst) * THE_STL_SIZEOF_FACET;
+      if (fwrite (aDataChunk, 1, aChunkSize, theFile) != aChunkSize)
+      {
+        return Standard_False;
+      }
+
+      // update progress only per 1k triangles
+      for (Standard_Integer anIndIter = aLast / IND_THRESHOLD - aFirst / IND_THRESHOLD; anIndIter > 0; --anIndIter)
+      {
+        aPS.Next();
+      }
+    }
+
+    return Standard_True;
+  }
+}
+
 //=============================================================================
 //function : Read
 //purpose  :
@@ -111,6 +643,12 @@ namespace
 Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
                                             const Handle(Message_ProgressIndicator)& theProgress)
 {
+  Handle(Poly_Triangulation) aMesh;
+  if (readBinaryFile (theFile, theProgress, aMesh))
+  {
+    return aMesh;
+  }
+
   Reader aReader;
   aReader.Read (theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
@@ -152,6 +690,12 @@ Handle(Poly_Triangulation) RWStl::ReadBinary (const OSD_Path& theFile,
   TCollection_AsciiString aPath;
   theFile.SystemName (aPath);
 
+  Handle(Poly_Triangulation) aMesh;
+  if (readBinaryFile (aPath, theProgress, aMesh))
+  {
+    return aMesh;
+  }
+
   std::filebuf aBuf;
   OSD_OpenStream (aBuf, aPath, std::ios::in | std::ios::binary);
   if (!aBuf.is_open())
@@ -235,6 +779,59 @@ Standard_Boolean RWStl::WriteBinary (const Handle(Poly_Triangulation)& theMesh,
   return isOK;
 }
 
+//=============================================================================
+//function : WriteBinary
+//purpose  :
+//=============================================================================
+Standard_Boolean RWStl::WriteBinary (const TopoDS_Shape& theShape,
+                                     const OSD_Path& thePath,
+                                     const Handle(Message_ProgressIndicator)& theProgInd)
+{
+  NCollection_Vector<FaceMesh> aFaceVec;
+  Standard_Integer aNbFacets = 0;
+  for (TopExp_Explorer anExpSF (theShape, TopAbs_FACE); anExpSF.More(); anExpSF.Next())
+  {
+    TopLoc_Location aLoc;
+    FaceMesh aFace;
+    aFace.Triangulation = BRep_Tool::Triangulation (TopoDS::Face (anExpSF.Current()), aLoc);
+    if (aFace.Triangulation.IsNull()
+     || aFace.Triangulation->NbTriangles() <= 0)
+    {
+      continue;
+    }
+    aFace.Trsf       = aLoc.Transformation();
+    aFace.IsReversed = anExpSF.Current().Orientation() == TopAbs_REVERSED;
+    aFace.FirstFacet = aNbFacets;
+    aNbFacets += aFace.Triangulation->NbTriangles();
+    aFaceVec.Append (aFace);
+  }
+  if (aNbFacets <= 0)
+  {
+    return Standard_False;
+  }
+
+  NCollection_Array1<FaceMesh> aFaces (0, aFaceVec.Length() - 1);
+  for (Standard_Integer aFaceIter = 0; aFaceIter < aFaceVec.Length(); ++aFaceIter)
+  {
+    aFaces.ChangeValue (aFaceIter) = aFaceVec (aFaceIter);
+  }
+  aFaceVec.Clear();
+
+  TCollection_AsciiString aPath;
+  thePath.SystemName (aPath);
+
+  FILE* aFile = OSD_OpenFile (aPath, "wb");
+  if (aFile == NULL)
+  {
+    return Standard_False;
+  }
+
+  Standard_Boolean isOK = writeBinaryFaces (aFaces, aNbFacets, aFile, theProgInd);
+
+  fclose (aFile);
+  return isOK;
+}
+
 //=============================================================================
 //function : Write
 //purpose  :
@@ -348,99 +945,10 @@ Standard_Boolean RWStl::writeBinary (const Handle(Poly_Triangulation)& theMesh,
                                      FILE* theFile,
                                      const Handle(Message_ProgressIndicator)& theProgInd)
 {
-  char aHeader[80] = "STL Exported by OpenCASCADE [www.opencascade.com]";
-  if (fwrite (aHeader, 1, 80, theFile) != 80)
-  {
-    return Standard_False;
-  }
-
-  Message_ProgressSentry aPS (theProgInd, "Triangles", 0,
-                              theMesh->NbTriangles(), IND_THRESHOLD);
-
-  const Standard_Size aNbChunkTriangles = 4096;
-  const Standard_Size aChunkSize = aNbChunkTriangles * THE_STL_SIZEOF_FACET;
-  NCollection_Array1<Standard_Character> aData (1, aChunkSize);
-  Standard_Character* aDataChunk = &aData.ChangeFirst();
-
-  const TColgp_Array1OfPnt& aNodes = theMesh->Nodes();
-  const Poly_Array1OfTriangle& aTriangles = theMesh->Triangles();
-  const Standard_Integer aNBTriangles = theMesh->NbTriangles();
-
-  Standard_Character aConv[4];
-  convertInteger (aNBTriangles, aConv);
-  if (fwrite (aConv, 1, 4, theFile) != 4)
-  {
-    return Standard_False;
-  }
-
-  Standard_Size aByteCount = 0;
-  for (Standard_Integer aTriIter = 1; aTriIter <= aNBTriangles; ++aTriIter)
-  {
-    Standard_Integer id[3];
-    const Poly_Triangle& aTriangle = aTriangles (aTriIter);
-    aTriangle.Get (id[0], id[1], id[2]);
-
-    const gp_Pnt aP1 = aNodes (id[0]);
-    const gp_Pnt aP2 = aNodes (id[1]);
-    const gp_Pnt aP3 = aNodes (id[2]);
-
-    gp_Vec aVec1 (aP1, aP2);
-    gp_Vec aVec2 (aP1, aP3);
-    gp_Vec aVNorm = aVec1.Crossed(aVec2);
-    if (aVNorm.SquareMagnitude() > gp::Resolution())
-    {
-      aVNorm.Normalize();
-    }
-    else
-    {
-      aVNorm.SetCoord (0.0, 0.0, 0.0);
-    }
-
-    convertDouble (aVNorm.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aVNorm.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aVNorm.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    convertDouble (aP1.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP1.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP1.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    convertDouble (aP2.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP2.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP2.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    convertDouble (aP3.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP3.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP3.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    aDataChunk[aByteCount] = 0; aByteCount += 1;
-    aDataChunk[aByteCount] = 0; aByteCount += 1;
-
-    // Chunk is filled. Dump it to the file.
-    if (aByteCount == aChunkSize)
-    {
-      if (fwrite (aDataChunk, 1, aChunkSize, theFile) != aChunkSize)
-      {
-        return Standard_False;
-      }
-
-      aByteCount = 0;
-    }
-
-    // update progress only per 1k triangles
-    if ((aTriIter % IND_THRESHOLD) == 0)
-    {
-      aPS.Next();
-    }
-  }
-
-  // Write last part if necessary.
-  if (aByteCount != aChunkSize)
-  {
-    if (fwrite (aDataChunk, 1, aByteCount, theFile) != aByteCount)
-    {
-      return Standard_False;
-    }
-  }
-
-  return Standard_True;
+  NCollection_Array1<FaceMesh> aFaces (0, 0);
+  FaceMesh& aFace = aFaces.ChangeFirst();
+  aFace.Triangulation = theMesh;
+  aFace.IsReversed    = Standard_False;
+  aFace.FirstFacet    = 0;
+  return writeBinaryFaces (aFaces, theMesh->NbTriangles(), theFile, theProgInd);
 }
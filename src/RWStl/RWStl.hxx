@@ -20,6 +20,7 @@
 #include <OSD_Path.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Standard_Macro.hxx>
+#include <TopoDS_Shape.hxx>
 
 //! This class provides methods to read and write triangulation from / to the STL files.
 class RWStl
@@ -33,6 +34,14 @@ public:
                                                        const OSD_Path& thePath,
                                                        const Handle(Message_ProgressIndicator)& theProgInd = Handle(Message_ProgressIndicator)());
   
+  //! Write triangulations of the faces of the shape to binary STL file,
+  //! taking into account their locations and orientations.
+  //! The facets are written directly, without building the merged triangulation.
+  //! Returns false if the shape has no triangles or the file cannot be opened.
+  Standard_EXPORT static Standard_Boolean WriteBinary (const TopoDS_Shape& theShape,
+                                                       const OSD_Path& thePath,
+                                                       const Handle(Message_ProgressIndicator)& theProgInd = Handle(Message_ProgressIndicator)());
+
   //! write the meshing in a file following the
   //! Ascii  format of an STL file.
   //! Returns false if the cannot be opened;
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <string.h>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
 
@@ -85,37 +86,43 @@ namespace
     NCollection_DataMap<gp_XYZ, Standard_Integer, MergeNodeTool> myMap;
   };
 
-  //! Read a Little Endian 32 bits float
-  inline static float readStlFloat (const char* theData)
-  {
-  #if OCCT_BINARY_FILE_DO_INVERSE
-    // on big-endian platform, map values byte-per-byte
-    union
-    {
-      uint32_t i;
-      float    f;
-    } bidargum;
-    bidargum.i  =  theData[0] & 0xFF;
-    bidargum.i |= (theData[1] & 0xFF) << 0x08;
-    bidargum.i |= (theData[2] & 0xFF) << 0x10;
-    bidargum.i |= (theData[3] & 0xFF) << 0x18;
-    return bidargum.f;
-  #else
-    // on little-endian platform, use plain cast
-    return *reinterpret_cast<const float*>(theData);
-  #endif
-  }
-
   //! Read a Little Endian 32 bits float
   inline static gp_XYZ readStlFloatVec3 (const char* theData)
   {
-    return gp_XYZ (readStlFloat (theData),
-                   readStlFloat (theData + sizeof(float)),
-                   readStlFloat (theData + sizeof(float) * 2));
+    return gp_XYZ (RWStl_Reader::ReadFloat (theData),
+                   RWStl_Reader::ReadFloat (theData + sizeof(float)),
+                   RWStl_Reader::ReadFloat (theData + sizeof(float) * 2));
   }
 
 }
 
+//==============================================================================
+//function : ReadFloat
+//purpose  :
+//==============================================================================
+
+Standard_ShortReal RWStl_Reader::ReadFloat (const char* theData)
+{
+#if OCCT_BINARY_FILE_DO_INVERSE
+  // on big-endian platform, map values byte-per-byte
+  union
+  {
+    uint32_t i;
+    float    f;
+  } bidargum;
+  bidargum.i  =  theData[0] & 0xFF;
+  bidargum.i |= (theData[1] & 0xFF) << 0x08;
+  bidargum.i |= (theData[2] & 0xFF) << 0x10;
+  bidargum.i |= (theData[3] & 0xFF) << 0x18;
+  return bidargum.f;
+#else
+  // on little-endian platform, copy the bytes (the data may be unaligned)
+  Standard_ShortReal aValue;
+  memcpy (&aValue, theData, sizeof(aValue));
+  return aValue;
+#endif
+}
+
 //==============================================================================
 //function : Read
 //purpose  :
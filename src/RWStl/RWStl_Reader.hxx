@@ -64,6 +64,9 @@ public:
                                               const std::streampos theUntilPos,
                                               const Handle(Message_ProgressIndicator)& theProgress);
 
+  //! Reads Little Endian 32 bits float from binary STL data.
+  Standard_EXPORT static Standard_ShortReal ReadFloat (const char* theData);
+
 public:
 
   //! Callback function to be implemented in descendant.
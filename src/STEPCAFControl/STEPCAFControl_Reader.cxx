@@ -24,6 +24,7 @@
 #include <HeaderSection_FileSchema.hxx>
 #include <Interface_Static.hxx>
 #include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <Quantity_Color.hxx>
 #include <StepAP214_AppliedExternalIdentificationAssignment.hxx>
@@ -191,6 +192,7 @@
 #include <StepVisual_HArray1OfCameraModelD3MultiClippingInterectionSelect.hxx>
 #include <StepVisual_HArray1OfCameraModelD3MultiClippingUnionSelect.hxx>
 #include <StepVisual_DraughtingCallout.hxx>
+#include <StepVisual_Colour.hxx>
 #include <StepVisual_DraughtingCalloutElement.hxx>
 #include <StepVisual_DraughtingModel.hxx>
 #include <StepVisual_Invisibility.hxx>
@@ -208,6 +210,7 @@
 #include <TColStd_HArray1OfTransient.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
 #include <TColStd_IndexedDataMapOfTransientTransient.hxx>
+#include <TColStd_IndexedMapOfTransient.hxx>
 #include <TColStd_MapIteratorOfMapOfTransient.hxx>
 #include <TColStd_MapOfTransient.hxx>
 #include <TColStd_SequenceOfHAsciiString.hxx>
@@ -867,6 +870,113 @@ static void findStyledSR (const Handle(StepVisual_StyledItem) &style,
 }
 
 
+namespace
+{
+  //! Colors defined by presentation style(s) of styled item.
+  //! The labels of colors in the document are added on first use.
+  struct STEPCAFControl_DecodedColors
+  {
+    Handle(StepVisual_StyledItem) Style;       //!< styled item the colors are taken from
+    Quantity_Color                Colors[3];   //!< surface, boundary and curve colors
+    Standard_Boolean              IsSet[3];    //!< flags indicating that color is defined
+    TDF_Label                     Labels[3];   //!< labels of colors in the document
+    Standard_Boolean              IsComponent; //!< flag indicating that style is defined by presentation style
+
+    STEPCAFControl_DecodedColors() : IsComponent (Standard_False)
+    {
+      IsSet[0] = IsSet[1] = IsSet[2] = Standard_False;
+    }
+
+    Standard_Boolean HasColors() const { return IsSet[0] || IsSet[1] || IsSet[2]; }
+  };
+
+  //! Decodes colors of the styled items; each item refers to its own element of array.
+  class STEPCAFControl_ColorsDecoder
+  {
+  public:
+    STEPCAFControl_ColorsDecoder (const STEPConstruct_Styles&                        theStyles,
+                                  NCollection_Array1<STEPCAFControl_DecodedColors>& theColors)
+    : myStyles (theStyles), myColors (theColors) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      STEPCAFControl_DecodedColors& aColors = myColors.ChangeValue (theIndex);
+      Handle(StepVisual_Colour) aStepColors[3];
+      myStyles.GetColors (aColors.Style, aStepColors[0], aStepColors[1], aStepColors[2], aColors.IsComponent);
+      for (Standard_Integer aColIter = 0; aColIter < 3; ++aColIter)
+      {
+        if (aStepColors[aColIter].IsNull())
+          continue;
+        aColors.IsSet[aColIter] = Standard_True;
+        STEPConstruct_Styles::DecodeColor (aStepColors[aColIter], aColors.Colors[aColIter]);
+      }
+    }
+
+  private:
+    STEPCAFControl_ColorsDecoder& operator= (const STEPCAFControl_ColorsDecoder&);
+
+  private:
+    const STEPConstruct_Styles&                        myStyles;
+    NCollection_Array1<STEPCAFControl_DecodedColors>& myColors;
+  };
+
+  //! Styled item to be assigned to shapes
+  struct STEPCAFControl_StyleTargets
+  {
+    Handle(StepVisual_StyledItem)    Style;   //!< styled item
+    Standard_Integer                 Colors;  //!< index of decoded colors
+    Standard_Boolean                 IsVisible;
+    TopTools_ListOfShape             Shapes;  //!< shapes of the styled items (null if not transferred)
+
+    STEPCAFControl_StyleTargets() : Colors (0), IsVisible (Standard_True) {}
+  };
+
+  //! Finds the shapes transferred from the items of styled items.
+  class STEPCAFControl_TargetsFinder
+  {
+  public:
+    STEPCAFControl_TargetsFinder (const Handle(Transfer_TransientProcess)&                theTP,
+                                  const NCollection_Array1<STEPCAFControl_DecodedColors>& theColors,
+                                  NCollection_Array1<STEPCAFControl_StyleTargets>&        theTargets)
+    : myTP (theTP), myColors (theColors), myTargets (theTargets) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      STEPCAFControl_StyleTargets& aTargets = myTargets.ChangeValue (theIndex);
+      if (!myColors.Value (aTargets.Colors).HasColors() && aTargets.IsVisible)
+        return;
+
+      const Handle(StepVisual_StyledItem)& aStyle = aTargets.Style;
+      if (!aStyle->Item().IsNull()) {
+        aTargets.Shapes.Append (STEPConstruct::FindShape (myTP, aStyle->Item()));
+      }
+      else if (!aStyle->ItemAP242().Representation().IsNull()) {
+        //special case for AP242: item can be Reprsentation
+        Handle(StepRepr_Representation) aRepr = aStyle->ItemAP242().Representation();
+        for (Standard_Integer j = 1; j <= aRepr->Items()->Length(); j++)
+          aTargets.Shapes.Append (STEPConstruct::FindShape (myTP, aRepr->Items()->Value(j)));
+      }
+    }
+
+  private:
+    STEPCAFControl_TargetsFinder& operator= (const STEPCAFControl_TargetsFinder&);
+
+  private:
+    Handle(Transfer_TransientProcess)                       myTP;
+    const NCollection_Array1<STEPCAFControl_DecodedColors>& myColors;
+    NCollection_Array1<STEPCAFControl_StyleTargets>&        myTargets;
+  };
+
+  //! Shape of assembly component the style is defined for
+  struct STEPCAFControl_StyledComponent
+  {
+    TopoDS_Shape     Shape;     //!< shape of component, null if not found
+    Standard_Boolean IsSHUO;    //!< flag indicating that style refers to SHUO
+
+    STEPCAFControl_StyledComponent() : IsSHUO (Standard_False) {}
+  };
+}
+
 //=======================================================================
 //function : ReadColors
 //purpose  : 
@@ -886,148 +996,154 @@ Standard_Boolean STEPCAFControl_Reader::ReadColors (const Handle(XSControl_WorkS
   // searching for invisible items in the model
   Handle(TColStd_HSequenceOfTransient) aHSeqOfInvisStyle = new TColStd_HSequenceOfTransient;
   Styles.LoadInvisStyles( aHSeqOfInvisStyle );
+  TColStd_MapOfTransient anInvisStyles;
+  for (TColStd_HSequenceOfTransient::Iterator anInvisIter (*aHSeqOfInvisStyle); anInvisIter.More(); anInvisIter.Next())
+    anInvisStyles.Add (anInvisIter.Value());
   
   Handle(XCAFDoc_ColorTool) CTool = XCAFDoc_DocumentTool::ColorTool( Doc->Main() );
   if ( CTool.IsNull() ) return Standard_False;
   Handle(XCAFDoc_ShapeTool) STool = XCAFDoc_DocumentTool::ShapeTool(Doc->Main());
   if (STool.IsNull()) return Standard_False;
 
-  // parse and search for color attributes
+  // styled items usually share a few presentation styles,
+  // so that colors are decoded once per presentation style
   Standard_Integer nb = Styles.NbStyles();
+  TColStd_IndexedMapOfTransient aStyleKeys;
+  NCollection_Vector<Handle(StepVisual_StyledItem)> aKeyStyles;
+  NCollection_Array1<STEPCAFControl_StyleTargets> aTargets (1, Max (nb, 1));
+  Standard_Integer aNbTargets = 0;
   for ( Standard_Integer i=1; i <= nb; i++ ) {
     Handle(StepVisual_StyledItem) style = Styles.Style ( i );
     if ( style.IsNull() ) continue;
-    
-    Standard_Boolean IsVisible = Standard_True;
-    // check the visibility of styled item.
-    for (Standard_Integer si = 1; si <= aHSeqOfInvisStyle->Length(); si++ ) {
-      if ( style != aHSeqOfInvisStyle->Value( si ) )
-        continue;
-      // found that current style is invisible.
-      IsVisible = Standard_False;
-      break;
-    }
 
-    Handle(StepVisual_Colour) SurfCol, BoundCol, CurveCol;
-    // check if it is component style
-    Standard_Boolean IsComponent = Standard_False;
-    if ( ! Styles.GetColors ( style, SurfCol, BoundCol, CurveCol, IsComponent ) && IsVisible )
+    Handle(Standard_Transient) aKey = style;
+    if (style->NbStyles() == 1 && !style->StylesValue (1).IsNull())
+      aKey = style->StylesValue (1);
+    const Standard_Integer aNbKeys = aStyleKeys.Extent();
+    STEPCAFControl_StyleTargets& aTarget = aTargets.ChangeValue (++aNbTargets);
+    aTarget.Style = style;
+    aTarget.Colors = aStyleKeys.Add (aKey);
+    aTarget.IsVisible = !anInvisStyles.Contains (style);
+    if (aTarget.Colors > aNbKeys)
+      aKeyStyles.Append (style);
+  }
+  if (aNbTargets == 0) {
+    CTool->ReverseChainsOfTreeNodes();
+    return Standard_True;
+  }
+
+  // decode colors and find shapes of the styled items
+  NCollection_Array1<STEPCAFControl_DecodedColors> aColors (1, aKeyStyles.Length());
+  for (Standard_Integer aKeyIter = 1; aKeyIter <= aKeyStyles.Length(); ++aKeyIter)
+    aColors.ChangeValue (aKeyIter).Style = aKeyStyles.Value (aKeyIter - 1);
+  OSD_Parallel::For (1, aColors.Upper() + 1, STEPCAFControl_ColorsDecoder (Styles, aColors));
+  OSD_Parallel::For (1, aNbTargets + 1, STEPCAFControl_TargetsFinder (Styles.TransientProcess(), aColors, aTargets));
+
+  // assign colors to the shapes
+  NCollection_DataMap<Handle(Standard_Transient), STEPCAFControl_StyledComponent> aComponents;
+  STEPConstruct_Tool Tool( WS );
+  const XCAFDoc_ColorType aColorTypes[3] = { XCAFDoc_ColorSurf, XCAFDoc_ColorCurv, XCAFDoc_ColorCurv };
+  for ( Standard_Integer i=1; i <= aNbTargets; i++ ) {
+    const STEPCAFControl_StyleTargets& aTarget = aTargets.Value (i);
+    STEPCAFControl_DecodedColors& aStyleColors = aColors.ChangeValue (aTarget.Colors);
+    Standard_Boolean IsVisible = aTarget.IsVisible;
+    if ( ! aStyleColors.HasColors() && IsVisible )
       continue;
     
-    // find shape
-    NCollection_Vector<Handle(Standard_Transient)> anItems;
-    if (!style->Item().IsNull()) {
-      anItems.Append(style->Item());
-    }
-    else if (!style->ItemAP242().Representation().IsNull()){
-      //special case for AP242: item can be Reprsentation
-      Handle(StepRepr_Representation) aRepr = style->ItemAP242().Representation();
-      for (Standard_Integer j = 1; j <= aRepr->Items()->Length(); j++)
-        anItems.Append(aRepr->Items()->Value(j));
-    }
-    for (Standard_Integer itemIt = 0; itemIt < anItems.Length(); itemIt++) {
-      TopoDS_Shape S = STEPConstruct::FindShape ( Styles.TransientProcess(),
-        Handle(StepRepr_RepresentationItem)::DownCast(anItems.Value(itemIt)) );
-      Standard_Boolean isSkipSHUOstyle = Standard_False;
-      // take shape with real location.
-      while ( IsComponent ) {
-        // take SR of NAUO
-        Handle(StepShape_ShapeRepresentation) aSR;
-        findStyledSR( style, aSR );
-        // search for SR along model
-        if (aSR.IsNull())
-          break;
-        Interface_EntityIterator subs = WS->HGraph()->Graph().Sharings( aSR );
-        Handle(StepShape_ShapeDefinitionRepresentation) aSDR;
-        for (subs.Start(); subs.More(); subs.Next()) {
-          aSDR = Handle(StepShape_ShapeDefinitionRepresentation)::DownCast(subs.Value());
-          if ( aSDR.IsNull() )
-            continue;
-          StepRepr_RepresentedDefinition aPDSselect = aSDR->Definition();
-          Handle(StepRepr_ProductDefinitionShape) PDS = 
-            Handle(StepRepr_ProductDefinitionShape)::DownCast(aPDSselect.PropertyDefinition());
-          if ( PDS.IsNull() )
-            continue;
-          StepRepr_CharacterizedDefinition aCharDef = PDS->Definition();
-          
-          Handle(StepRepr_AssemblyComponentUsage) ACU = 
-            Handle(StepRepr_AssemblyComponentUsage)::DownCast(aCharDef.ProductDefinitionRelationship());
-          if (ACU.IsNull())
-            continue;
-          // PTV 10.02.2003 skip styled item that refer to SHUO
-          if (ACU->IsKind(STANDARD_TYPE(StepRepr_SpecifiedHigherUsageOccurrence))) {
-            isSkipSHUOstyle = Standard_True;
-            break;
-          }
-          Handle(StepRepr_NextAssemblyUsageOccurrence) NAUO =
-            Handle(StepRepr_NextAssemblyUsageOccurrence)::DownCast(ACU);
-          if ( NAUO.IsNull() )
-            continue;
-          
-          TopoDS_Shape aSh;
-          // PTV 10.02.2003 to find component of assembly CORRECTLY
-          STEPConstruct_Tool Tool( WS );
-          TDF_Label aShLab = FindInstance ( NAUO, CTool->ShapeTool(), Tool, ShapeLabelMap );
-          aSh = CTool->ShapeTool()->GetShape(aShLab);
-          if (!aSh.IsNull()) {
-            S = aSh;
-            break;
+    // take shape with real location.
+    TopoDS_Shape aCompShape;
+    if ( aStyleColors.IsComponent ) {
+      // take SR of NAUO
+      Handle(StepShape_ShapeRepresentation) aSR;
+      findStyledSR( aTarget.Style, aSR );
+      // search for SR along model
+      if (!aSR.IsNull()) {
+        STEPCAFControl_StyledComponent* aComp = aComponents.ChangeSeek (aSR);
+        if (aComp == NULL) {
+          aComp = aComponents.Bound (aSR, STEPCAFControl_StyledComponent());
+          Interface_EntityIterator subs = WS->HGraph()->Graph().Sharings( aSR );
+          Handle(StepShape_ShapeDefinitionRepresentation) aSDR;
+          for (subs.Start(); subs.More(); subs.Next()) {
+            aSDR = Handle(StepShape_ShapeDefinitionRepresentation)::DownCast(subs.Value());
+            if ( aSDR.IsNull() )
+              continue;
+            StepRepr_RepresentedDefinition aPDSselect = aSDR->Definition();
+            Handle(StepRepr_ProductDefinitionShape) PDS = 
+              Handle(StepRepr_ProductDefinitionShape)::DownCast(aPDSselect.PropertyDefinition());
+            if ( PDS.IsNull() )
+              continue;
+            StepRepr_CharacterizedDefinition aCharDef = PDS->Definition();
+            
+            Handle(StepRepr_AssemblyComponentUsage) ACU = 
+              Handle(StepRepr_AssemblyComponentUsage)::DownCast(aCharDef.ProductDefinitionRelationship());
+            if (ACU.IsNull())
+              continue;
+            // PTV 10.02.2003 skip styled item that refer to SHUO
+            if (ACU->IsKind(STANDARD_TYPE(StepRepr_SpecifiedHigherUsageOccurrence))) {
+              aComp->IsSHUO = Standard_True;
+              break;
+            }
+            Handle(StepRepr_NextAssemblyUsageOccurrence) NAUO =
+              Handle(StepRepr_NextAssemblyUsageOccurrence)::DownCast(ACU);
+            if ( NAUO.IsNull() )
+              continue;
+            
+            // PTV 10.02.2003 to find component of assembly CORRECTLY
+            TDF_Label aShLab = FindInstance ( NAUO, CTool->ShapeTool(), Tool, ShapeLabelMap );
+            TopoDS_Shape aSh = CTool->ShapeTool()->GetShape(aShLab);
+            if (!aSh.IsNull()) {
+              aComp->Shape = aSh;
+              break;
+            }
           }
         }
-        break;
+        if (aComp->IsSHUO)
+          continue; // skip styled item which refer to SHUO
+        aCompShape = aComp->Shape;
       }
-      if (isSkipSHUOstyle)
-        continue; // skip styled item which refer to SHUO
-      
+    }
+
+    for (TopTools_ListIteratorOfListOfShape anItemIter (aTarget.Shapes); anItemIter.More(); anItemIter.Next()) {
+      const TopoDS_Shape& S = !aCompShape.IsNull() ? aCompShape : anItemIter.Value();
       if ( S.IsNull() )
         continue;
       
-      if (!SurfCol.IsNull() || !BoundCol.IsNull() || !CurveCol.IsNull() || !IsVisible)
+      TDF_Label aL;
+      Standard_Boolean isFound = STool->SearchUsingMap(S, aL, Standard_False, Standard_True);
+      if (aStyleColors.HasColors())
       {
-        TDF_Label aL;
-        Standard_Boolean isFound = STool->SearchUsingMap(S, aL, Standard_False, Standard_True);
-        if (!SurfCol.IsNull() || !BoundCol.IsNull() || !CurveCol.IsNull())
+        TDF_LabelSequence aLabels;
+        if (isFound)
         {
-          Quantity_Color aSCol, aBCol, aCCol;
-          if (!SurfCol.IsNull())
-            Styles.DecodeColor(SurfCol, aSCol);
-          if (!BoundCol.IsNull())
-            Styles.DecodeColor(BoundCol, aBCol);
-          if (!CurveCol.IsNull())
-            Styles.DecodeColor(CurveCol, aCCol);
-          if (isFound)
+          aLabels.Append (aL);
+        }
+        else
+        {
+          for (TopoDS_Iterator it(S); it.More(); it.Next())
           {
-            if (!SurfCol.IsNull())
-              CTool->SetColor(aL, aSCol, XCAFDoc_ColorSurf);
-            if (!BoundCol.IsNull())
-              CTool->SetColor(aL, aBCol, XCAFDoc_ColorCurv);
-            if (!CurveCol.IsNull())
-              CTool->SetColor(aL, aCCol, XCAFDoc_ColorCurv);
-          }
-          else
-          {
-            for (TopoDS_Iterator it(S); it.More(); it.Next())
-            {
-              TDF_Label aL1;
-              if (STool->SearchUsingMap(it.Value(), aL1, Standard_False, Standard_True))
-              {
-                if (!SurfCol.IsNull())
-                  CTool->SetColor(aL1, aSCol, XCAFDoc_ColorSurf);
-                if (!BoundCol.IsNull())
-                  CTool->SetColor(aL1, aBCol, XCAFDoc_ColorCurv);
-                if (!CurveCol.IsNull())
-                  CTool->SetColor(aL1, aCCol, XCAFDoc_ColorCurv);
-              }
-            }
+            TDF_Label aL1;
+            if (STool->SearchUsingMap(it.Value(), aL1, Standard_False, Standard_True))
+              aLabels.Append (aL1);
           }
         }
-        if (!IsVisible)
+        for (TDF_LabelSequence::Iterator aLabIter (aLabels); aLabIter.More(); aLabIter.Next())
         {
-          // sets the invisibility for shape.
-          if (isFound)
-            CTool->SetVisibility(aL, Standard_False);
+          for (Standard_Integer aColIter = 0; aColIter < 3; ++aColIter)
+          {
+            if (!aStyleColors.IsSet[aColIter])
+              continue;
+            if (aStyleColors.Labels[aColIter].IsNull())
+              aStyleColors.Labels[aColIter] = CTool->AddColor (aStyleColors.Colors[aColIter]);
+            CTool->SetColor (aLabIter.Value(), aStyleColors.Labels[aColIter], aColorTypes[aColIter]);
+          }
         }
       }
+      if (!IsVisible)
+      {
+        // sets the invisibility for shape.
+        if (isFound)
+          CTool->SetVisibility(aL, Standard_False);
+      }
     }
   }
   CTool->ReverseChainsOfTreeNodes();
@@ -1378,6 +1494,7 @@ Standard_Boolean STEPCAFControl_Reader::ReadLayers (const Handle(XSControl_WorkS
     Handle(TCollection_HAsciiString) descr = SVPLA->Description();
     Handle(TCollection_HAsciiString) hName = SVPLA->Name();
     TCollection_ExtendedString aLayerName ( hName->String() );
+    TDF_Label aLayerLabel;
      
     // find a target shape and its label in the document
     for (Standard_Integer j = 1; j <= SVPLA->NbAssignedItems(); j++ ) {
@@ -1390,7 +1507,10 @@ Standard_Boolean STEPCAFControl_Reader::ReadLayers (const Handle(XSControl_WorkS
 	
       TDF_Label shL;
       if ( ! STool->Search ( S, shL, Standard_True, Standard_True, Standard_True ) ) continue;
-      LTool->SetLayer ( shL, aLayerName );
+      // the layer is searched by name once per assignment
+      if ( aLayerLabel.IsNull() )
+        aLayerLabel = LTool->AddLayer ( aLayerName );
+      LTool->SetLayer ( shL, aLayerLabel );
     }
     
     // check invisibility
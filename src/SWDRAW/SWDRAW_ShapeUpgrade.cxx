@@ -1290,7 +1290,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
 {
   if (n < 3)
   {
-    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]\n";
+    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [+p] [-t val] [-a val]\n";
     di << "options:\n";
     di << "s1 s2 ... to keep the given edges during unification of faces\n";
     di << "-f to switch off 'unify-faces' mode \n";
@@ -1298,6 +1298,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
     di << "-nosafe to switch off 'safe input shape' mode\n";
     di << "+b to switch on 'concat bspline' mode\n";
     di << "+i to switch on 'allow internal edges' mode\n";
+    di << "+p to switch on 'parallel' mode\n";
     di << "-t val to set linear tolerance\n";
     di << "-a val to set angular tolerance (in degrees)\n";
     di << "'unify-faces' and 'unify-edges' modes are switched on by default";
@@ -1314,6 +1315,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Standard_Boolean anConBS = Standard_False;
   Standard_Boolean isAllowInternal = Standard_False;
   Standard_Boolean isSafeInputMode = Standard_True;
+  Standard_Boolean isParallel = Standard_False;
   Standard_Real aLinTol = Precision::Confusion();
   Standard_Real aAngTol = Precision::Angular();
   TopoDS_Shape aKeepShape;
@@ -1337,6 +1339,8 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
           anConBS = Standard_True;
         else if (!strcmp(a[i], "+i"))
           isAllowInternal = Standard_True;
+        else if (!strcmp(a[i], "+p"))
+          isParallel = Standard_True;
         else if (!strcmp(a[i], "-t") || !strcmp(a[i], "-a"))
         {
           if (++i < n)
@@ -1358,6 +1362,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Unifier().Initialize(aShape, anUEdges, anUFaces, anConBS);
   Unifier().KeepShapes(aMapOfShapes);
   Unifier().SetSafeInputMode(isSafeInputMode);
+  Unifier().SetRunParallel(isParallel);
   Unifier().AllowInternalEdges(isAllowInternal);
   Unifier().SetLinearTolerance(aLinTol);
   Unifier().SetAngularTolerance(aAngTol);
@@ -1583,7 +1588,7 @@ static Standard_Integer reshape(Draw_Interpretor& /*theDI*/,
   theCommands.Add ("removeloc","result shape [remove_level(see ShapeEnum)]",__FILE__,removeloc,g);
   
   theCommands.Add ("unifysamedom",
-                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]",
+                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [+p] [-t val] [-a val]",
                     __FILE__,unifysamedom,g);
 
   theCommands.Add ("copytranslate","result shape dx dy dz",__FILE__,copytranslate,g);
@@ -20,6 +20,7 @@
 #include <Resource_Manager.hxx>
 #include <ShapeProcess_Context.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Type.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -75,10 +76,13 @@ Standard_Boolean ShapeProcess_Context::Init (const Standard_CString file,
 Handle(Resource_Manager) ShapeProcess_Context::LoadResourceManager (const Standard_CString name)
 {
   // Optimisation of loading resource file: file is load only once
-  // and reloaded only if file date has changed
+  // and reloaded only if file date has changed;
+  // the cache is protected as contexts may be created in parallel threads
   static Handle(Resource_Manager) sRC;
   static Standard_Time sMtime, sUMtime;
   static TCollection_AsciiString sName;
+  static Standard_Mutex sMutex;
+  Standard_Mutex::Sentry aSentry (sMutex);
 
   struct stat buf;
   Standard_Time aMtime(0), aUMtime(0);
@@ -141,6 +145,16 @@ const Handle(Resource_Manager) &ShapeProcess_Context::ResourceManager () const
   return myRC;
 }
 
+//=======================================================================
+//function : SetResourceManager
+//purpose  : 
+//=======================================================================
+
+void ShapeProcess_Context::SetResourceManager (const Handle(Resource_Manager)& theRM)
+{
+  myRC = theRM;
+}
+
 //=======================================================================
 //function : SetScope
 //purpose  : 
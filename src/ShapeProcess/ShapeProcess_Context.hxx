@@ -67,6 +67,12 @@ public:
   //! Returns internal Resource_Manager object
   Standard_EXPORT const Handle(Resource_Manager)& ResourceManager() const;
   
+  //! Sets the resource manager used by the context instead of
+  //! the one loaded by Init(); the loaded resource manager is
+  //! shared by all contexts using the same resource file, thus
+  //! a context modifying the resources should be given a copy
+  Standard_EXPORT void SetResourceManager (const Handle(Resource_Manager)& theRM);
+  
   //! Set a new (sub)scope
   Standard_EXPORT void SetScope (const Standard_CString scope);
   
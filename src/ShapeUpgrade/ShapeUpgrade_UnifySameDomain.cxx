@@ -46,6 +46,9 @@
 #include <gp_Dir.hxx>
 #include <gp_Lin.hxx>
 #include <IntPatch_ImpImpIntersection.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <ShapeAnalysis_WireOrder.hxx>
 #include <ShapeBuild_Edge.hxx>
@@ -55,6 +58,8 @@
 #include <ShapeFix_Shell.hxx>
 #include <ShapeFix_Wire.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_Type.hxx>
 #include <TColGeom2d_Array1OfBSplineCurve.hxx>
 #include <TColGeom2d_HArray1OfBSplineCurve.hxx>
@@ -70,6 +75,7 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
@@ -80,6 +86,9 @@
 #include <BRepAdaptor_Curve2d.hxx>
 #include <gp_Vec2d.hxx>
 
+#include <algorithm>
+#include <vector>
+
 IMPLEMENT_STANDARD_RTTIEXT(ShapeUpgrade_UnifySameDomain,Standard_Transient)
 
 struct SubSequenceOfEdges
@@ -288,50 +297,108 @@ static Standard_Boolean GetNormalToSurface(const TopoDS_Face& theFace,
   return Standard_True;
 }
 
+//=======================================================================
+//struct   : FaceSurfaceInfo
+//purpose  : Canonical form of the face surface used to check if two
+//           faces lie on the same domain; computed once per face
+//=======================================================================
+struct FaceSurfaceInfo
+{
+  Handle(Geom_Surface) BaseSurface;  //!< surface of the face
+  TopLoc_Location      BaseLocation; //!< location of the surface
+  Handle(Geom_Surface) Surface;      //!< located surface without trimming
+  gp_Pln               Plane;        //!< plane if the surface is planar
+  gp_Cylinder          Cylinder;     //!< cylinder if the surface is cylindrical
+  Standard_Boolean     IsPlanar;
+  Standard_Boolean     IsCylinder;
+  Standard_Boolean     IsDone;
+
+  FaceSurfaceInfo() : IsPlanar (Standard_False), IsCylinder (Standard_False), IsDone (Standard_False) {}
+};
+
+//=======================================================================
+//function : ComputeSurfaceInfo
+//purpose  : 
+//=======================================================================
+static void ComputeSurfaceInfo(const TopoDS_Face& theFace,
+                               const Standard_Real theLinTol,
+                               FaceSurfaceInfo& theInfo)
+{
+  theInfo.BaseSurface = BRep_Tool::Surface(theFace, theInfo.BaseLocation);
+  theInfo.Surface = ClearRts(BRep_Tool::Surface(theFace));
+
+  // all kinds of surfaces checked, including b-spline and bezier
+  GeomLib_IsPlanarSurface aPlanarityChecker(theInfo.Surface, theLinTol);
+  theInfo.IsPlanar = aPlanarityChecker.IsPlanar();
+  if (theInfo.IsPlanar)
+    theInfo.Plane = aPlanarityChecker.Plan();
+
+  if (theInfo.Surface->IsKind(STANDARD_TYPE(Geom_CylindricalSurface)) ||
+      theInfo.Surface->IsKind(STANDARD_TYPE(Geom_SweptSurface)))
+    theInfo.IsCylinder = getCylinder(theInfo.Surface, theInfo.Cylinder);
+  theInfo.IsDone = Standard_True;
+}
+
+//=======================================================================
+//class    : FaceSurfaceInfoFunctor
+//purpose  : Computes the surface infos of the faces in parallel threads;
+//           the info of the failed face is left not done
+//=======================================================================
+class FaceSurfaceInfoFunctor
+{
+public:
+
+  FaceSurfaceInfoFunctor (const TopTools_IndexedMapOfShape& theFaces,
+                          const Standard_Real theLinTol,
+                          NCollection_Array1<FaceSurfaceInfo>& theInfos)
+  : myFaces (theFaces), myLinTol (theLinTol), myInfos (theInfos) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    try {
+      OCC_CATCH_SIGNALS
+      ComputeSurfaceInfo(TopoDS::Face(myFaces(theIndex)), myLinTol, myInfos(theIndex));
+    }
+    catch (Standard_Failure const&) {
+      myInfos(theIndex) = FaceSurfaceInfo();
+    }
+  }
+
+private:
+  FaceSurfaceInfoFunctor& operator= (const FaceSurfaceInfoFunctor&);
+
+private:
+  const TopTools_IndexedMapOfShape& myFaces;
+  Standard_Real myLinTol;
+  NCollection_Array1<FaceSurfaceInfo>& myInfos;
+};
+
 //=======================================================================
 //function : IsSameDomain
 //purpose  : 
 //=======================================================================
-static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
-                                     const TopoDS_Face& aCheckedFace,
+static Standard_Boolean IsSameDomain(const FaceSurfaceInfo& theInfo1,
+                                     const FaceSurfaceInfo& theInfo2,
                                      const Standard_Real theLinTol,
                                      const Standard_Real theAngTol)
 {
   //checking the same handles
-  TopLoc_Location L1, L2;
-  Handle(Geom_Surface) S1, S2;
-
-  S1 = BRep_Tool::Surface(aFace,L1);
-  S2 = BRep_Tool::Surface(aCheckedFace,L2);
-
-  if (S1 == S2 && L1 == L2)
+  if (theInfo1.BaseSurface == theInfo2.BaseSurface &&
+      theInfo1.BaseLocation == theInfo2.BaseLocation)
     return Standard_True;
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
-
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
-
-  //Handle(Geom_OffsetSurface) aGOFS1, aGOFS2;
-  //aGOFS1 = Handle(Geom_OffsetSurface)::DownCast(S1);
-  //aGOFS2 = Handle(Geom_OffsetSurface)::DownCast(S2);
-  //if (!aGOFS1.IsNull()) S1 = aGOFS1->BasisSurface();
-  //if (!aGOFS2.IsNull()) S2 = aGOFS2->BasisSurface();
+  const Handle(Geom_Surface)& S1 = theInfo1.Surface;
+  const Handle(Geom_Surface)& S2 = theInfo2.Surface;
 
   // case of two planar surfaces:
   // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar()) {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar()) {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
-
-      if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
-        aPln1.Distance(aPln2) < theLinTol) {
-        return Standard_True;
-      }
+  if (theInfo1.IsPlanar && theInfo2.IsPlanar) {
+    const gp_Pln& aPln1 = theInfo1.Plane;
+    const gp_Pln& aPln2 = theInfo2.Plane;
+
+    if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
+      aPln1.Distance(aPln2) < theLinTol) {
+      return Standard_True;
     }
   }
 
@@ -361,24 +428,19 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
 
   // case of two cylindrical surfaces, at least one of which is a swept surface
   // swept surfaces: SurfaceOfLinearExtrusion, SurfaceOfRevolution
-  if ((S1->IsKind(STANDARD_TYPE(Geom_CylindricalSurface)) ||
-       S1->IsKind(STANDARD_TYPE(Geom_SweptSurface))) &&
-      (S2->IsKind(STANDARD_TYPE(Geom_CylindricalSurface)) ||
-       S2->IsKind(STANDARD_TYPE(Geom_SweptSurface))))
-  {
-    gp_Cylinder aCyl1, aCyl2;
-    if (getCylinder(S1, aCyl1) && getCylinder(S2, aCyl2)) {
-      if (fabs(aCyl1.Radius() - aCyl2.Radius()) < theLinTol) {
-        gp_Dir aDir1 = aCyl1.Position().Direction();
-        gp_Dir aDir2 = aCyl2.Position().Direction();
-        if (aDir1.IsParallel(aDir2, Precision::Angular())) {
-          gp_Pnt aLoc1 = aCyl1.Location();
-          gp_Pnt aLoc2 = aCyl2.Location();
-          gp_Vec aVec12 (aLoc1, aLoc2);
-          if (aVec12.SquareMagnitude() < theLinTol*theLinTol ||
-              aVec12.IsParallel(aDir1, Precision::Angular())) {
-            return Standard_True;
-          }
+  if (theInfo1.IsCylinder && theInfo2.IsCylinder) {
+    const gp_Cylinder& aCyl1 = theInfo1.Cylinder;
+    const gp_Cylinder& aCyl2 = theInfo2.Cylinder;
+    if (fabs(aCyl1.Radius() - aCyl2.Radius()) < theLinTol) {
+      gp_Dir aDir1 = aCyl1.Position().Direction();
+      gp_Dir aDir2 = aCyl2.Position().Direction();
+      if (aDir1.IsParallel(aDir2, Precision::Angular())) {
+        gp_Pnt aLoc1 = aCyl1.Location();
+        gp_Pnt aLoc2 = aCyl2.Location();
+        gp_Vec aVec12 (aLoc1, aLoc2);
+        if (aVec12.SquareMagnitude() < theLinTol*theLinTol ||
+            aVec12.IsParallel(aDir1, Precision::Angular())) {
+          return Standard_True;
         }
       }
     }
@@ -387,6 +449,21 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
   return Standard_False;
 }
 
+//=======================================================================
+//function : GetSurfaceInfo
+//purpose  : Returns the surface info of the face computing it if necessary
+//=======================================================================
+static const FaceSurfaceInfo& GetSurfaceInfo(const TopoDS_Face& theFace,
+                                             const TopTools_IndexedMapOfShape& theFaces,
+                                             NCollection_Array1<FaceSurfaceInfo>& theInfos,
+                                             const Standard_Real theLinTol)
+{
+  FaceSurfaceInfo& anInfo = theInfos(theFaces.FindIndex(theFace));
+  if (!anInfo.IsDone)
+    ComputeSurfaceInfo(theFace, theLinTol, anInfo);
+  return anInfo;
+}
+
 //=======================================================================
 //function : UpdateMapOfShapes
 //purpose  :
@@ -1153,6 +1230,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
     myConcatBSplines (Standard_False),
     myAllowInternal (Standard_False),
     mySafeInputMode(Standard_True),
+    myRunParallel(Standard_False),
     myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -1175,6 +1253,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
     myConcatBSplines (ConcatBSplines),
     myAllowInternal (Standard_False),
     mySafeInputMode (Standard_True),
+    myRunParallel (Standard_False),
     myShape (aShape),
     myHistory(new BRepTools_History)
 {
@@ -1294,6 +1373,327 @@ static void SetFixWireModes(ShapeFix_Face& theSff)
   aFixWire->FixSmallMode() = 0;
 }
 
+//=======================================================================
+//function : BuildUnifiedFace
+//purpose  : Builds the face on the base surface bounded by the edges
+//           of the unified area. The context is given in safe input mode.
+//           Returns false if the face could not be fixed.
+//=======================================================================
+
+static Standard_Boolean BuildUnifiedFace(const TopTools_SequenceOfShape& faces,
+                                         TopTools_SequenceOfShape& edges,
+                                         const Handle(Geom_Surface)& aBaseSurface,
+                                         const TopLoc_Location& aBaseLocation,
+                                         const Handle(ShapeBuild_ReShape)& theContext,
+                                         TopoDS_Face& theResult)
+{
+  TopoDS_Face aResult;
+  BRep_Builder B;
+  B.MakeFace(aResult,aBaseSurface,aBaseLocation,0);
+  Standard_Integer nbWires = 0;
+
+  TopoDS_Face tmpF = TopoDS::Face(faces(1).Oriented(TopAbs_FORWARD));
+
+  // connecting wires
+  while (edges.Length()>0) {
+
+    Standard_Boolean isEdge3d = Standard_False;
+    nbWires++;
+    TopTools_MapOfShape aVertices;
+    TopoDS_Wire aWire;
+    B.MakeWire(aWire);
+
+    TopoDS_Edge anEdge = TopoDS::Edge(edges(1));
+    edges.Remove(1);
+    // collect internal edges in separate wires
+    Standard_Boolean isInternal = (anEdge.Orientation() == TopAbs_INTERNAL);
+
+    isEdge3d |= !BRep_Tool::Degenerated(anEdge);
+    B.Add(aWire,anEdge);
+    TopoDS_Vertex V1,V2;
+    TopExp::Vertices(anEdge,V1,V2);
+    aVertices.Add(V1);
+    aVertices.Add(V2);
+
+    Standard_Boolean isNewFound = Standard_False;
+    do {
+      isNewFound = Standard_False;
+      for(Standard_Integer j = 1; j <= edges.Length(); j++) {
+        anEdge = TopoDS::Edge(edges(j));
+        // check if the current edge orientation corresponds to the first one
+        Standard_Boolean isCurrInternal = (anEdge.Orientation() == TopAbs_INTERNAL);
+        if (isCurrInternal != isInternal)
+          continue;
+        TopExp::Vertices(anEdge,V1,V2);
+        if(aVertices.Contains(V1) || aVertices.Contains(V2)) {
+          isEdge3d |= !BRep_Tool::Degenerated(anEdge);
+          aVertices.Add(V1);
+          aVertices.Add(V2);
+          B.Add(aWire,anEdge);
+          edges.Remove(j);
+          j--;
+          isNewFound = Standard_True;
+        }
+      }
+    } while (isNewFound);
+
+    // sorting any type of edges
+    aWire.Closed (BRep_Tool::IsClosed (aWire));
+
+    Handle(ShapeFix_Wire) sfw = new ShapeFix_Wire(aWire,tmpF,Precision::Confusion());
+    if (!theContext.IsNull())
+      sfw->SetContext(theContext);
+    sfw->FixReorder();
+    Standard_Boolean isDegRemoved = Standard_False;
+    if(!sfw->StatusReorder ( ShapeExtend_FAIL )) {
+      // clear degenerated edges if at least one with 3d curve exist
+      if(isEdge3d) {
+        Handle(ShapeExtend_WireData) sewd = sfw->WireData();
+        for(Standard_Integer j = 1; j<=sewd->NbEdges();j++) {
+          TopoDS_Edge E = sewd->Edge(j);
+          if(BRep_Tool::Degenerated(E)) {
+            sewd->Remove(j);
+            isDegRemoved = Standard_True;
+            j--;
+          }
+        }
+      }
+      sfw->FixShifted();
+      if(isDegRemoved)
+        sfw->FixDegenerated();
+    }
+    aWire = sfw->Wire();
+
+    // add resulting wire
+    if(isEdge3d) {
+      B.Add(aResult,aWire);
+    }
+    else  {
+      // sorting edges
+      Handle(ShapeExtend_WireData) sbwd = sfw->WireData();
+      Standard_Integer nbEdges = sbwd->NbEdges();
+      // sort degenerated edges and create one edge instead of several ones
+      ShapeAnalysis_WireOrder sawo(Standard_False, 0);
+      ShapeAnalysis_Edge sae;
+      Standard_Integer aLastEdge = nbEdges;
+      for(Standard_Integer j = 1; j <= nbEdges; j++) {
+        Standard_Real f,l;
+        //smh protection on NULL pcurve
+        Handle(Geom2d_Curve) c2d;
+        if(!sae.PCurve(sbwd->Edge(j),tmpF,c2d,f,l)) {
+          aLastEdge--;
+          continue;
+        }
+        sawo.Add(c2d->Value(f).XY(),c2d->Value(l).XY());
+      }
+      if (sawo.NbEdges() == 0)
+        continue;
+      sawo.Perform();
+
+      // constructind one degenerative edge
+      gp_XY aStart, anEnd, tmp;
+      Standard_Integer nbFirst = sawo.Ordered(1);
+      TopoDS_Edge anOrigE = TopoDS::Edge(sbwd->Edge(nbFirst).Oriented(TopAbs_FORWARD));
+      ShapeBuild_Edge sbe;
+      TopoDS_Vertex aDummyV;
+      TopoDS_Edge E = sbe.CopyReplaceVertices(anOrigE,aDummyV,aDummyV);
+      sawo.XY(nbFirst,aStart,tmp);
+      sawo.XY(sawo.Ordered(aLastEdge),tmp,anEnd);
+
+      gp_XY aVec = anEnd-aStart;
+      Handle(Geom2d_Line) aLine = new Geom2d_Line(aStart,gp_Dir2d(anEnd-aStart));
+
+      B.UpdateEdge(E,aLine,tmpF,0.);
+      B.Range(E,tmpF,0.,aVec.Modulus());
+      Handle(Geom_Curve) C3d;
+      B.UpdateEdge(E,C3d,0.);
+      B.Degenerated(E,Standard_True);
+      TopoDS_Wire aW;
+      B.MakeWire(aW);
+      B.Add(aW,E);
+      aW.Closed (Standard_True);
+      B.Add(aResult,aW);
+    }
+  }
+
+  ShapeFix_Face sff (aResult);
+  //Initializing by tolerances
+  sff.SetPrecision(Precision::Confusion());
+  sff.SetMinTolerance(Precision::Confusion());
+  sff.SetMaxTolerance(1.);
+  //Setting modes
+  SetFixWireModes(sff);
+  if (!theContext.IsNull())
+    sff.SetContext(theContext);
+  // Applying the fixes
+  sff.Perform();
+  if(sff.Status(ShapeExtend_FAIL))
+    return Standard_False;
+  theResult = sff.Face();
+  return Standard_True;
+}
+
+//=======================================================================
+//class    : BoundaryEdges
+//purpose  : Sequence of the boundary edges of the area being unified.
+//           Works as AddOrdinaryEdges() on a sequence, but the removed
+//           edges are only marked, so adding a face costs the number of
+//           its edges instead of the length of the whole boundary.
+//=======================================================================
+
+class BoundaryEdges
+{
+public:
+
+  //! Adds the edges of the shape dropping seams and the edges already
+  //! present, which are removed. Returns true if one of the present edges
+  //! is removed; <theSlot> is set to the slot of the first removed edge.
+  Standard_Boolean Add (const TopoDS_Shape& theShape, Standard_Integer& theSlot)
+  {
+    //map of edges
+    TopTools_IndexedMapOfShape aNewEdges;
+    //add edges without seams
+    for (TopExp_Explorer exp(theShape,TopAbs_EDGE); exp.More(); exp.Next()) {
+      const TopoDS_Shape& edge = exp.Current();
+      if (aNewEdges.Contains(edge))
+        aNewEdges.RemoveKey(edge);
+      else
+        aNewEdges.Add(edge);
+    }
+
+    // find the present edges in the order of the sequence
+    std::vector<Standard_Integer> aDropped;
+    for (Standard_Integer i = 1; i <= aNewEdges.Extent(); i++) {
+      const Standard_Integer* aSlot = mySlotOfEdge.Seek(aNewEdges(i));
+      if (aSlot != NULL)
+        aDropped.push_back(*aSlot);
+    }
+    std::sort(aDropped.begin(), aDropped.end());
+
+    //merge edges and drop seams
+    for (size_t i = 0; i < aDropped.size(); i++) {
+      TopoDS_Shape& current = mySlots.ChangeValue(aDropped[i]);
+      aNewEdges.RemoveKey(current);
+      mySlotOfEdge.UnBind(current);
+      current.Nullify();
+    }
+
+    //add edges to the sequence
+    for (Standard_Integer i = 1; i <= aNewEdges.Extent(); i++) {
+      mySlotOfEdge.Bind(aNewEdges(i), mySlots.Length());
+      mySlots.Append(aNewEdges(i));
+    }
+
+    if (aDropped.empty())
+      return Standard_False;
+    theSlot = aDropped.front();
+    return Standard_True;
+  }
+
+  //! Returns the first present edge slot after the given one or -1.
+  Standard_Integer Next (const Standard_Integer theSlot) const
+  {
+    for (Standard_Integer aSlot = theSlot + 1; aSlot < mySlots.Length(); ++aSlot) {
+      if (!mySlots(aSlot).IsNull())
+        return aSlot;
+    }
+    return -1;
+  }
+
+  //! Returns the edge in the slot.
+  const TopoDS_Shape& Value (const Standard_Integer theSlot) const
+  {
+    return mySlots(theSlot);
+  }
+
+  //! Appends the present edges to the sequence.
+  void Fill (TopTools_SequenceOfShape& theEdges) const
+  {
+    for (Standard_Integer aSlot = Next(-1); aSlot >= 0; aSlot = Next(aSlot))
+      theEdges.Append(mySlots(aSlot));
+  }
+
+private:
+  NCollection_Vector<TopoDS_Shape> mySlots;
+  TopTools_DataMapOfShapeInteger   mySlotOfEdge;
+};
+
+//=======================================================================
+//struct   : UnifiedFacesGroup
+//purpose  : Faces to be unified collected before building
+//=======================================================================
+
+struct UnifiedFacesGroup
+{
+  TopTools_SequenceOfShape Faces;
+  TopTools_SequenceOfShape Edges;
+  Handle(Geom_Surface)     Surface;
+  TopLoc_Location          Location;
+  TopoDS_Face              Result;
+  Standard_Boolean         IsBuilt; //!< building has been performed
+  Standard_Boolean         IsDone;  //!< the face is built successfully
+
+  UnifiedFacesGroup() : IsBuilt (Standard_False), IsDone (Standard_False) {}
+};
+
+//=======================================================================
+//class    : UnifiedFacesFunctor
+//purpose  : Builds the unified faces of the groups having no common
+//           vertices; a failed group is left not built
+//=======================================================================
+
+class UnifiedFacesFunctor
+{
+public:
+
+  UnifiedFacesFunctor (NCollection_Vector<UnifiedFacesGroup>& theGroups)
+  : myGroups (theGroups) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    UnifiedFacesGroup& aGroup = myGroups.ChangeValue(theIndex);
+    try {
+      OCC_CATCH_SIGNALS
+      TopTools_SequenceOfShape anEdges = aGroup.Edges;
+      aGroup.IsDone = BuildUnifiedFace(aGroup.Faces, anEdges, aGroup.Surface, aGroup.Location,
+                                       Handle(ShapeBuild_ReShape)(), aGroup.Result);
+      aGroup.IsBuilt = Standard_True;
+    }
+    catch (Standard_Failure const&) {
+      aGroup.IsBuilt = Standard_False;
+    }
+  }
+
+private:
+  UnifiedFacesFunctor& operator= (const UnifiedFacesFunctor&);
+
+private:
+  NCollection_Vector<UnifiedFacesGroup>& myGroups;
+};
+
+//=======================================================================
+//function : BuildUnifiedFaces
+//purpose  : Builds the unified faces of the independent groups in
+//           parallel and substitutes them in the order of groups
+//=======================================================================
+
+static void BuildUnifiedFaces(NCollection_Vector<UnifiedFacesGroup>& theGroups,
+                              const Handle(ShapeBuild_ReShape)& theContext)
+{
+  UnifiedFacesFunctor aFunctor(theGroups);
+  OSD_Parallel::For(0, theGroups.Length(), aFunctor);
+
+  for (Standard_Integer aGroupIt = 0; aGroupIt < theGroups.Length(); ++aGroupIt) {
+    UnifiedFacesGroup& aGroup = theGroups.ChangeValue(aGroupIt);
+    if (!aGroup.IsBuilt)
+      aGroup.IsDone = BuildUnifiedFace(aGroup.Faces, aGroup.Edges, aGroup.Surface,
+                                       aGroup.Location, Handle(ShapeBuild_ReShape)(), aGroup.Result);
+    if (aGroup.IsDone)
+      theContext->Merge(aGroup.Faces, aGroup.Result);
+  }
+  theGroups.Clear();
+}
+
 //=======================================================================
 //function : IntUnifyFaces
 //purpose  : 
@@ -1309,23 +1709,44 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
   // map of processed shapes
   TopTools_MapOfShape aProcessed;
 
+  // surfaces of the faces prepared for the same domain check
+  TopTools_IndexedMapOfShape aFaces;
+  TopExp::MapShapes(theInpShape, TopAbs_FACE, aFaces);
+  NCollection_Array1<FaceSurfaceInfo> aSurfInfos(0, aFaces.Extent());
+  if (myRunParallel && aFaces.Extent() > 1) {
+    FaceSurfaceInfoFunctor aFunctor(aFaces, myLinTol, aSurfInfos);
+    OSD_Parallel::For(1, aFaces.Extent() + 1, aFunctor);
+  }
+
+  // groups of faces to be unified in parallel; building of a face
+  // modifies its edges and vertices in place, so the pending groups
+  // share no vertices and are built before collecting a dependent group
+  const Standard_Boolean isParallelBuild = myRunParallel && !mySafeInputMode;
+  NCollection_Vector<UnifiedFacesGroup> aGroups;
+  TopTools_MapOfShape aGroupsVertices;
+
   // processing each face
-  TopExp_Explorer exp;
-  for (exp.Init(theInpShape, TopAbs_FACE); exp.More(); exp.Next()) {
+  TopExp_Explorer exp(theInpShape, TopAbs_FACE);
+  while (exp.More()) {
     const TopoDS_Face& aFaceOriginal = TopoDS::Face(exp.Current());
     TopoDS_Face aFace = TopoDS::Face(aFaceOriginal.Oriented(TopAbs_FORWARD));
 
-    if (aProcessed.Contains(aFace))
+    if (aProcessed.Contains(aFace)) {
+      exp.Next();
       continue;
+    }
 
     // Boundary edges for the new face
     TopTools_SequenceOfShape edges;
+    BoundaryEdges aBoundary;
 
     Standard_Integer dummy;
-    AddOrdinaryEdges(edges, aFace, dummy);
+    aBoundary.Add(aFace, dummy);
 
     // Faces to get unified with the current faces
     TopTools_SequenceOfShape faces;
+    // Faces marked as processed by the current face
+    TopTools_ListOfShape aNewProcessed;
 
     // Add the current face for unification
     faces.Append(aFace);
@@ -1335,10 +1756,12 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
     Handle(Geom_Surface) aBaseSurface = BRep_Tool::Surface(aFace,aBaseLocation);
     aBaseSurface = ClearRts(aBaseSurface);
 
+    const FaceSurfaceInfo& aSurfInfo = GetSurfaceInfo(aFace, aFaces, aSurfInfos, myLinTol);
+
     // find adjacent faces to union
     Standard_Integer i;
-    for (i = 1; i <= edges.Length(); i++) {
-      TopoDS_Edge edge = TopoDS::Edge(edges(i));
+    for (Standard_Integer aSlot = aBoundary.Next(-1); aSlot >= 0; aSlot = aBoundary.Next(aSlot)) {
+      TopoDS_Edge edge = TopoDS::Edge(aBoundary.Value(aSlot));
       if (BRep_Tool::Degenerated(edge))
         continue;
 
@@ -1393,23 +1816,26 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
           }
         }
         //
-        if (IsSameDomain(aFace,anCheckedFace, myLinTol, myAngTol)) {
+        if (IsSameDomain(aSurfInfo, GetSurfaceInfo(anCheckedFace, aFaces, aSurfInfos, myLinTol),
+                         myLinTol, myAngTol)) {
 
           // hotfix for 27271: prevent merging along periodic direction.
           if (IsLikeSeam(edge, anCheckedFace, aBaseSurface))
             continue;
 
-          if (AddOrdinaryEdges(edges,anCheckedFace,dummy)) {
+          if (aBoundary.Add(anCheckedFace,dummy)) {
             // sequence edges is modified
-            i = dummy;
+            aSlot = dummy;
           }
 
           faces.Append(anCheckedFace);
           aProcessed.Add(anCheckedFace);
+          aNewProcessed.Append(anCheckedFace);
           break;
         }
       }
     }
+    aBoundary.Fill(edges);
 
     if (faces.Length() > 1) {
       // fill in the connectivity map for selected faces
@@ -1505,154 +1931,47 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
 
     // all faces collected in the sequence. Perform union of faces
     if (faces.Length() > 1) {
-      TopoDS_Face aResult;
-      BRep_Builder B;
-      B.MakeFace(aResult,aBaseSurface,aBaseLocation,0);
-      Standard_Integer nbWires = 0;
-
-      TopoDS_Face tmpF = TopoDS::Face(faces(1).Oriented(TopAbs_FORWARD));
-
-      // connecting wires
-      while (edges.Length()>0) {
-
-        Standard_Boolean isEdge3d = Standard_False;
-        nbWires++;
-        TopTools_MapOfShape aVertices;
-        TopoDS_Wire aWire;
-        B.MakeWire(aWire);
-
-        TopoDS_Edge anEdge = TopoDS::Edge(edges(1));
-        edges.Remove(1);
-        // collect internal edges in separate wires
-        Standard_Boolean isInternal = (anEdge.Orientation() == TopAbs_INTERNAL);
-
-        isEdge3d |= !BRep_Tool::Degenerated(anEdge);
-        B.Add(aWire,anEdge);
-        TopoDS_Vertex V1,V2;
-        TopExp::Vertices(anEdge,V1,V2);
-        aVertices.Add(V1);
-        aVertices.Add(V2);
-
-        Standard_Boolean isNewFound = Standard_False;
-        do {
-          isNewFound = Standard_False;
-          for(Standard_Integer j = 1; j <= edges.Length(); j++) {
-            anEdge = TopoDS::Edge(edges(j));
-            // check if the current edge orientation corresponds to the first one
-            Standard_Boolean isCurrInternal = (anEdge.Orientation() == TopAbs_INTERNAL);
-            if (isCurrInternal != isInternal)
-              continue;
-            TopExp::Vertices(anEdge,V1,V2);
-            if(aVertices.Contains(V1) || aVertices.Contains(V2)) {
-              isEdge3d |= !BRep_Tool::Degenerated(anEdge);
-              aVertices.Add(V1);
-              aVertices.Add(V2);
-              B.Add(aWire,anEdge);
-              edges.Remove(j);
-              j--;
-              isNewFound = Standard_True;
-            }
-          }
-        } while (isNewFound);
-
-        // sorting any type of edges
-        aWire.Closed (BRep_Tool::IsClosed (aWire));
-
-        Handle(ShapeFix_Wire) sfw = new ShapeFix_Wire(aWire,tmpF,Precision::Confusion());
-        if (mySafeInputMode)
-          sfw->SetContext(myContext);
-        sfw->FixReorder();
-        Standard_Boolean isDegRemoved = Standard_False;
-        if(!sfw->StatusReorder ( ShapeExtend_FAIL )) {
-          // clear degenerated edges if at least one with 3d curve exist
-          if(isEdge3d) {
-            Handle(ShapeExtend_WireData) sewd = sfw->WireData();
-            for(Standard_Integer j = 1; j<=sewd->NbEdges();j++) {
-              TopoDS_Edge E = sewd->Edge(j);
-              if(BRep_Tool::Degenerated(E)) {
-                sewd->Remove(j);
-                isDegRemoved = Standard_True;
-                j--;
-              }
-            }
-          }
-          sfw->FixShifted();
-          if(isDegRemoved)
-            sfw->FixDegenerated();
-        }
-        aWire = sfw->Wire();
-
-        // add resulting wire
-        if(isEdge3d) {
-          B.Add(aResult,aWire);
-        }
-        else  {
-          // sorting edges
-          Handle(ShapeExtend_WireData) sbwd = sfw->WireData();
-          Standard_Integer nbEdges = sbwd->NbEdges();
-          // sort degenerated edges and create one edge instead of several ones
-          ShapeAnalysis_WireOrder sawo(Standard_False, 0);
-          ShapeAnalysis_Edge sae;
-          Standard_Integer aLastEdge = nbEdges;
-          for(Standard_Integer j = 1; j <= nbEdges; j++) {
-            Standard_Real f,l;
-            //smh protection on NULL pcurve
-            Handle(Geom2d_Curve) c2d;
-            if(!sae.PCurve(sbwd->Edge(j),tmpF,c2d,f,l)) {
-              aLastEdge--;
-              continue;
-            }
-            sawo.Add(c2d->Value(f).XY(),c2d->Value(l).XY());
-          }
-          if (sawo.NbEdges() == 0)
-            continue;
-          sawo.Perform();
-
-          // constructind one degenerative edge
-          gp_XY aStart, anEnd, tmp;
-          Standard_Integer nbFirst = sawo.Ordered(1);
-          TopoDS_Edge anOrigE = TopoDS::Edge(sbwd->Edge(nbFirst).Oriented(TopAbs_FORWARD));
-          ShapeBuild_Edge sbe;
-          TopoDS_Vertex aDummyV;
-          TopoDS_Edge E = sbe.CopyReplaceVertices(anOrigE,aDummyV,aDummyV);
-          sawo.XY(nbFirst,aStart,tmp);
-          sawo.XY(sawo.Ordered(aLastEdge),tmp,anEnd);
-
-          gp_XY aVec = anEnd-aStart;
-          Handle(Geom2d_Line) aLine = new Geom2d_Line(aStart,gp_Dir2d(anEnd-aStart));
-
-          B.UpdateEdge(E,aLine,tmpF,0.);
-          B.Range(E,tmpF,0.,aVec.Modulus());
-          Handle(Geom_Curve) C3d;
-          B.UpdateEdge(E,C3d,0.);
-          B.Degenerated(E,Standard_True);
-          TopoDS_Wire aW;
-          B.MakeWire(aW);
-          B.Add(aW,E);
-          aW.Closed (Standard_True);
-          B.Add(aResult,aW);
+      if (isParallelBuild) {
+        TopTools_IndexedMapOfShape aVertices;
+        for (i = 1; i <= faces.Length(); i++)
+          TopExp::MapShapes(faces(i), TopAbs_VERTEX, aVertices);
+        for (i = 1; i <= edges.Length(); i++)
+          TopExp::MapShapes(edges(i), TopAbs_VERTEX, aVertices);
+        Standard_Boolean isDependent = Standard_False;
+        for (i = 1; i <= aVertices.Extent() && !isDependent; i++)
+          isDependent = aGroupsVertices.Contains(aVertices(i));
+        if (isDependent) {
+          // the faces have been collected on the edges to be modified
+          // by the pending groups; build them and collect the faces again
+          TopTools_ListIteratorOfListOfShape it(aNewProcessed);
+          for (; it.More(); it.Next())
+            aProcessed.Remove(it.Value());
+          BuildUnifiedFaces(aGroups, myContext);
+          aGroupsVertices.Clear();
+          continue;
         }
+        // postpone building to process independent groups simultaneously
+        UnifiedFacesGroup& aGroup = aGroups.Appended();
+        aGroup.Faces = faces;
+        aGroup.Edges = edges;
+        aGroup.Surface = aBaseSurface;
+        aGroup.Location = aBaseLocation;
+        for (i = 1; i <= aVertices.Extent(); i++)
+          aGroupsVertices.Add(aVertices(i));
       }
-
-      ShapeFix_Face sff (aResult);
-      //Initializing by tolerances
-      sff.SetPrecision(Precision::Confusion());
-      sff.SetMinTolerance(Precision::Confusion());
-      sff.SetMaxTolerance(1.);
-      //Setting modes
-      SetFixWireModes(sff);
-      if (mySafeInputMode)
-        sff.SetContext(myContext);
-      // Applying the fixes
-      sff.Perform();
-      if(!sff.Status(ShapeExtend_FAIL))
-      {
-        // perform substitution of faces
-        aResult = sff.Face();
-        myContext->Merge(faces, aResult);
+      else {
+        TopoDS_Face aResult;
+        if (BuildUnifiedFace(faces, edges, aBaseSurface, aBaseLocation,
+                             mySafeInputMode ? myContext : Handle(ShapeBuild_ReShape)(), aResult))
+          // perform substitution of faces
+          myContext->Merge(faces, aResult);
       }
     }
+    exp.Next();
   } // end processing each face
+
+  if (!aGroups.IsEmpty())
+    BuildUnifiedFaces(aGroups, myContext);
 }
 
 //=======================================================================
@@ -125,6 +125,21 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag defining whether the surfaces of faces are analyzed
+  //! and the unified faces are built in parallel threads. The unified
+  //! faces are built in parallel only if safe input mode is switched off.
+  //! Default value is false.
+  void SetRunParallel (const Standard_Boolean theFlag)
+  {
+    myRunParallel = theFlag;
+  }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const
+  {
+    return myRunParallel;
+  }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
   
@@ -174,6 +189,7 @@ private:
   Standard_Boolean myConcatBSplines;
   Standard_Boolean myAllowInternal;
   Standard_Boolean mySafeInputMode;
+  Standard_Boolean myRunParallel;
   TopoDS_Shape myShape;
   Handle(ShapeBuild_ReShape) myContext;
   TopTools_MapOfShape myKeepShapes;
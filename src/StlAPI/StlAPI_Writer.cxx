@@ -41,6 +41,13 @@ StlAPI_Writer::StlAPI_Writer()
 Standard_Boolean StlAPI_Writer::Write (const TopoDS_Shape&    theShape,
                                        const Standard_CString theFileName)
 {
+  if (!myASCIIMode)
+  {
+    // the facets are written face by face, without building the merged triangulation
+    OSD_Path aPath (theFileName);
+    return RWStl::WriteBinary (theShape, aPath);
+  }
+
   Standard_Integer aNbNodes = 0;
   Standard_Integer aNbTriangles = 0;
 
@@ -66,6 +73,10 @@ Standard_Boolean StlAPI_Writer::Write (const TopoDS_Shape&    theShape,
   {
     TopLoc_Location aLoc;
     Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (TopoDS::Face (anExpSF.Current()), aLoc);
+    if (aTriangulation.IsNull())
+    {
+      continue;
+    }
 
     const TColgp_Array1OfPnt& aNodes = aTriangulation->Nodes();
     const Poly_Array1OfTriangle& aTriangles = aTriangulation->Triangles();
@@ -109,7 +120,5 @@ Standard_Boolean StlAPI_Writer::Write (const TopoDS_Shape&    theShape,
   }
 
   OSD_Path aPath (theFileName);
-  return myASCIIMode
-       ? RWStl::WriteAscii  (aMesh, aPath)
-       : RWStl::WriteBinary (aMesh, aPath);
+  return RWStl::WriteAscii (aMesh, aPath);
 }
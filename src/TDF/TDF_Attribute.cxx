@@ -18,6 +18,7 @@
 //Version	Date		Purpose
 //		0.0	Feb  7 1997	Creation
 
+#include <Standard_Atomic.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_GUID.hxx>
 #include <Standard_ImmutableObject.hxx>
@@ -257,6 +258,9 @@ void TDF_Attribute::Backup()
 
     const Standard_Integer currentTransaction =
       aData->Transaction();
+    // atomic: the retrieval drivers may paste attributes of one document concurrently
+    if (currentTransaction == 0 && aData->NotUndoMode())
+      Standard_Atomic_Increment (&aData->myNbOutOfTransaction);
     if (myTransaction < currentTransaction) {//"!=" is less secure.
       Handle(TDF_Attribute) backup = BackupCopy();
 #ifdef TDF_DATA_COMMIT_OPTIMIZED
@@ -287,6 +291,17 @@ Handle(TDF_Attribute) TDF_Attribute::BackupCopy() const
 }
 
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_Attribute::MemorySize() const
+{
+  return sizeof(TDF_Attribute);
+}
+
+
 //=======================================================================
 //function : RemoveBackup
 //purpose  : 
@@ -291,6 +291,13 @@ public:
   //! transaction.
   Standard_EXPORT virtual void Restore (const Handle(TDF_Attribute)& anAttribute) = 0;
   
+  //! Returns an estimation of the memory occupied by
+  //! the attribute, in bytes. It is used to bound the
+  //! memory taken by the undo history. The default
+  //! implementation returns the size of the object
+  //! itself; attributes holding big data redefine it.
+  Standard_EXPORT virtual Standard_Size MemorySize() const;
+  
   //! Makes an AttributeDelta because <me>
   //! appeared. The only known use of a redefinition of
   //! this method is to return a null handle (no delta).
@@ -60,6 +60,12 @@ public:
   //! Returns the ID of the attribute concerned by <me>.
   Standard_EXPORT Standard_GUID ID() const;
   
+  //! Returns an estimation of the memory kept by the
+  //! delta, in bytes. The default implementation
+  //! counts the delta itself only, the attribute being
+  //! referred being alive in the data framework.
+  Standard_EXPORT virtual Standard_Size MemorySize() const;
+  
   //! Dumps the contents.
   Standard_EXPORT virtual Standard_OStream& Dump (Standard_OStream& OS) const;
 Standard_OStream& operator<< (Standard_OStream& OS) const
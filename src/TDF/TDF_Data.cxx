@@ -93,7 +93,8 @@ myTransaction           (0),
 myNbTouchedAtt          (0),
 myNotUndoMode           (Standard_True),
 myTime                  (0),
-myAllowModification     (Standard_True)
+myAllowModification     (Standard_True),
+myNbOutOfTransaction    (0)
 {
   const Handle(NCollection_IncAllocator) anIncAllocator=
     new NCollection_IncAllocator (16000);
@@ -149,6 +150,8 @@ Handle(TDF_Delta) TDF_Data::CommitTransaction
 
     if (myNbTouchedAtt && !(withDelta && delta->IsEmpty())) ++myTime;
     --myTransaction;
+    if (myTransaction == 0 && !withDelta && myNbTouchedAtt)
+      myNbOutOfTransaction += myNbTouchedAtt;
     if (withDelta) {
       if (!delta->IsEmpty()) {
         delta->Validity(myTimes.First(),myTime);
@@ -100,6 +100,12 @@ Standard_OStream& operator<< (Standard_OStream& anOS) const
   //! returns modification mode.
     Standard_Boolean IsModificationAllowed() const;
   
+  //! Returns the number of attribute modifications (additions,
+  //! removals and changes) which are not recorded in deltas:
+  //! the ones done while no transaction was open and the ones
+  //! committed by a top-level transaction without delta.
+    Standard_Integer NbModificationsOutOfTransaction() const;
+  
   //! Returns TDF_HAllocator, which is an
   //! incremental allocator used by
   //! TDF_LabelNode.
@@ -136,6 +142,8 @@ Standard_OStream& operator<< (Standard_OStream& anOS) const
 
 friend class TDF_Transaction;
 friend class TDF_LabelNode;
+friend class TDF_Label;
+friend class TDF_Attribute;
 
 
   DEFINE_STANDARD_RTTIEXT(TDF_Data,Standard_Transient)
@@ -195,6 +203,7 @@ private:
   TColStd_ListOfInteger myTimes;
   TDF_HAllocator myLabelNodeAllocator;
   Standard_Boolean myAllowModification;
+  Standard_Integer myNbOutOfTransaction;
 
 
 };
@@ -49,3 +49,13 @@ void TDF_DefaultDeltaOnModification::Apply()
     refAtt->DeltaOnModification(this);
 }
 
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_DefaultDeltaOnModification::MemorySize() const
+{
+  return sizeof(TDF_DefaultDeltaOnModification) + Attribute()->MemorySize();
+}
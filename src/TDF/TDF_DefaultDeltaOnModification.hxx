@@ -40,6 +40,10 @@ public:
   
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
+  
+  //! Returns the memory kept by the delta including
+  //! the backup copy it holds.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
 
 
 
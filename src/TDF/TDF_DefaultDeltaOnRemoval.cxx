@@ -44,3 +44,14 @@ void TDF_DefaultDeltaOnRemoval::Apply()
 {
   Label().AddAttribute(Attribute(), Standard_True);
 }
+
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_DefaultDeltaOnRemoval::MemorySize() const
+{
+  return sizeof(TDF_DefaultDeltaOnRemoval) + Attribute()->MemorySize();
+}
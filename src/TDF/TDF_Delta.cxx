@@ -204,6 +204,20 @@ void TDF_Delta::Labels(TDF_LabelList& aLabelList) const
   }
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_Delta::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDF_Delta);
+  for (TDF_ListIteratorOfAttributeDeltaList anIter (myAttDeltaList);
+       anIter.More(); anIter.Next())
+    aSize += anIter.Value()->MemorySize();
+  return aSize;
+}
+
 //=======================================================================
 //function : Dump
 //purpose  : 
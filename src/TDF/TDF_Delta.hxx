@@ -69,6 +69,10 @@ public:
   //! Returns the field <myAttDeltaList>.
     const TDF_AttributeDeltaList& AttributeDeltas() const;
   
+  //! Returns an estimation of the memory kept by the
+  //! attribute deltas, in bytes.
+  Standard_EXPORT Standard_Size MemorySize() const;
+  
   //! Returns a name associated with this delta.
     TCollection_ExtendedString Name() const;
   
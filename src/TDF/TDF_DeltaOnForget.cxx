@@ -49,3 +49,14 @@ void TDF_DeltaOnForget::Apply()
   cout<<"Resume attribute"<<endl;
 #endif
 }
+
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_DeltaOnForget::MemorySize() const
+{
+  return sizeof(TDF_DeltaOnForget) + Attribute()->MemorySize();
+}
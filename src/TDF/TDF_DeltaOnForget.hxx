@@ -42,6 +42,10 @@ public:
   
   //! Applies the delta to the attribute.
   Standard_EXPORT void Apply() Standard_OVERRIDE;
+  
+  //! Returns the memory kept by the delta including
+  //! the forgotten attribute it holds.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
 
 
 
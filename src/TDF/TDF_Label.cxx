@@ -554,6 +554,8 @@ void TDF_Label::AddToNode (const TDF_LabelNodePtr& toNode,
 
   anAttribute->myTransaction = toNode->Data()->Transaction();  /// myData->Transaction();
   anAttribute->mySavedTransaction = 0;
+  if (anAttribute->myTransaction == 0 && toNode->Data()->NotUndoMode())
+    ++toNode->Data()->myNbOutOfTransaction;
 
   //append to the end of the attribute list
   dummyAtt.Nullify();
@@ -590,6 +592,8 @@ void TDF_Label::ForgetFromNode (const TDF_LabelNodePtr& fromNode,
     throw Standard_DomainError("Attribute to forget not attached to my label.");
 
   Standard_Integer curTrans = fromNode->Data()->Transaction();
+  if (curTrans == 0 && fromNode->Data()->NotUndoMode())
+    ++fromNode->Data()->myNbOutOfTransaction;
   if (!anAttribute->IsForgotten()) {
     if ( (curTrans == 0) ||
         ( (anAttribute->myTransaction == curTrans) &&
@@ -250,6 +250,19 @@ void TDataStd_BooleanArray::SetID()
   Backup();
   myID = GetID();
 }
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_BooleanArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_BooleanArray);
+  if (!myValues.IsNull())
+    aSize += myValues->Length() * sizeof(Standard_Byte);
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
@@ -93,6 +93,9 @@ public:
   
   Standard_EXPORT void Restore (const Handle(TDF_Attribute)& with) Standard_OVERRIDE;
   
+  //! Returns the memory occupied by the array.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+  
   Standard_EXPORT Handle(TDF_Attribute) NewEmpty() const Standard_OVERRIDE;
   
   Standard_EXPORT void Paste (const Handle(TDF_Attribute)& into, const Handle(TDF_RelocationTable)& RT) const Standard_OVERRIDE;
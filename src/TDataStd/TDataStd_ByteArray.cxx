@@ -234,6 +234,19 @@ void TDataStd_ByteArray::SetID()
   myID = GetID();
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_ByteArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_ByteArray);
+  if (!myValue.IsNull())
+    aSize += myValue->Length() * sizeof(Standard_Byte);
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
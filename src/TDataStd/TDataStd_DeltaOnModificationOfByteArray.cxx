@@ -176,4 +176,17 @@ void TDataStd_DeltaOnModificationOfByteArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfByteArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_DeltaOnModificationOfByteArray);
+  if (!myIndxes.IsNull())
+    aSize += myIndxes->Length() * sizeof(Standard_Integer);
+  if (!myValues.IsNull())
+    aSize += myValues->Length() * sizeof(Standard_Byte);
+  return aSize;
+}
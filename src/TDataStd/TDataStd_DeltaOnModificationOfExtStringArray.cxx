@@ -179,4 +179,21 @@ void TDataStd_DeltaOnModificationOfExtStringArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfExtStringArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_DeltaOnModificationOfExtStringArray);
+  if (!myIndxes.IsNull())
+    aSize += myIndxes->Length() * sizeof(Standard_Integer);
+  if (!myValues.IsNull())
+  {
+    for (Standard_Integer i = myValues->Lower(); i <= myValues->Upper(); i++)
+      aSize += sizeof(TCollection_ExtendedString)
+             + myValues->Value (i).Length() * sizeof(Standard_ExtCharacter);
+  }
+  return aSize;
+}
@@ -174,4 +174,17 @@ void TDataStd_DeltaOnModificationOfIntArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfIntArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_DeltaOnModificationOfIntArray);
+  if (!myIndxes.IsNull())
+    aSize += myIndxes->Length() * sizeof(Standard_Integer);
+  if (!myValues.IsNull())
+    aSize += myValues->Length() * sizeof(Standard_Integer);
+  return aSize;
+}
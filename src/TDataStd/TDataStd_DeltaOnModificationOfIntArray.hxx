@@ -41,6 +41,10 @@ public:
   
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
+  
+  //! Returns the memory kept by the delta, that is the
+  //! modified items only.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
 
 
 
@@ -174,4 +174,17 @@ void TDataStd_DeltaOnModificationOfRealArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfRealArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_DeltaOnModificationOfRealArray);
+  if (!myIndxes.IsNull())
+    aSize += myIndxes->Length() * sizeof(Standard_Integer);
+  if (!myValues.IsNull())
+    aSize += myValues->Length() * sizeof(Standard_Real);
+  return aSize;
+}
@@ -249,6 +249,23 @@ void TDataStd_ExtStringArray::SetID()
   myID = GetID();
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_ExtStringArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_ExtStringArray);
+  if (!myValue.IsNull())
+  {
+    for (Standard_Integer i = myValue->Lower(); i <= myValue->Upper(); i++)
+      aSize += sizeof(TCollection_ExtendedString)
+             + myValue->Value (i).Length() * sizeof(Standard_ExtCharacter);
+  }
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
@@ -246,6 +246,19 @@ void TDataStd_IntegerArray::SetID()
   myID = GetID();
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_IntegerArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_IntegerArray);
+  if (!myValue.IsNull())
+    aSize += myValue->Length() * sizeof(Standard_Integer);
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
@@ -119,6 +119,9 @@ public:
   
   Standard_EXPORT void Restore (const Handle(TDF_Attribute)& With) Standard_OVERRIDE;
   
+  //! Returns the memory occupied by the array.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+  
   Standard_EXPORT Handle(TDF_Attribute) NewEmpty() const Standard_OVERRIDE;
   
   //! Note. Uses inside ChangeArray() method
@@ -245,6 +245,19 @@ void TDataStd_RealArray::SetID()
   myID = GetID();
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_RealArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_RealArray);
+  if (!myValue.IsNull())
+    aSize += myValue->Length() * sizeof(Standard_Real);
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
@@ -237,6 +237,19 @@ void TDataStd_ReferenceArray::SetID()
   myID = GetID();
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_ReferenceArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_ReferenceArray);
+  if (!myArray.IsNull())
+    aSize += myArray->Length() * sizeof(TDF_Label);
+  return aSize;
+}
+
 //=======================================================================
 //function : NewEmpty
 //purpose  : 
@@ -75,9 +75,14 @@ TDocStd_Document::TDocStd_Document(const TCollection_ExtendedString& aStorageFor
 myStorageFormat(aStorageFormat),
 myData (new TDF_Data()),
 myUndoLimit(0),
+myUndoMemoryLimit(0),
+myUndoMemorySize(0),
 mySaveTime(0),
 myIsNestedTransactionMode(0),
-mySaveEmptyLabels(Standard_False)
+mySaveEmptyLabels(Standard_False),
+myIsJournalMode(Standard_False),
+myIsJournalComplete(Standard_False),
+myJournalBase(0)
 {
   TDF_Transaction* pTr =  new TDF_Transaction (myData,"UNDO");
   myUndoTransaction    = *pTr; delete pTr;
@@ -130,6 +135,8 @@ TCollection_ExtendedString TDocStd_Document::GetPath () const
 void TDocStd_Document::SetData (const Handle(TDF_Data)& D)
 {
   myData = D;
+  myJournal.Clear();
+  myIsJournalComplete = Standard_False;
   TDF_Transaction* pTr = new TDF_Transaction(myData,"UNDO");
   myUndoTransaction = *pTr; delete pTr;  
 }
@@ -326,8 +333,11 @@ Standard_Boolean TDocStd_Document::CommitTransaction()
     }
     else {
       if(!D->IsEmpty()) {
+        AppendToJournal(D);
         myUndos.Append(D);
+        myUndoMemorySize += D->MemorySize();
         myRedos.Clear(); // if we push an Undo we clear the redos
+        CheckUndoMemoryLimit();
         isDone = Standard_True;
       }
     }
@@ -348,12 +358,15 @@ Standard_Boolean TDocStd_Document::CommitTransaction()
         isDone = Standard_True;
 
         myRedos.Clear(); // if we push an Undo we clear the redos
+        AppendToJournal(D);
         myUndos.Append(D); // New undos are at the end of the list
+        myUndoMemorySize += D->MemorySize();
         // Check  the limit to remove the oldest one
         if (myUndos.Extent() > myUndoLimit) {
 #ifdef SRN_DELTA_COMPACT
           Handle(TDF_Delta) aDelta = myUndos.First();
 #endif
+          myUndoMemorySize -= myUndos.First()->MemorySize();
           myUndos.RemoveFirst();
 #ifdef SRN_DELTA_COMPACT
           if(myFromUndo == aDelta) {
@@ -367,6 +380,7 @@ Standard_Boolean TDocStd_Document::CommitTransaction()
           }
 #endif
         }
+        CheckUndoMemoryLimit();
       }
 
     }
@@ -482,6 +496,7 @@ void TDocStd_Document::SetUndoLimit(const Standard_Integer L)
   myUndoLimit = (L > 0) ? L : 0;
   Standard_Integer n = myUndos.Extent() - myUndoLimit;
   while (n > 0) {
+    myUndoMemorySize -= myUndos.First()->MemorySize();
     myUndos.RemoveFirst();
     --n;
   }
@@ -503,6 +518,37 @@ Standard_Integer TDocStd_Document::GetUndoLimit() const
   return myUndoLimit;
 }
 
+//=======================================================================
+//function : SetUndoMemoryLimit
+//purpose  : 
+//=======================================================================
+
+void TDocStd_Document::SetUndoMemoryLimit (const Standard_Size theLimit)
+{
+  myUndoMemoryLimit = theLimit;
+  CheckUndoMemoryLimit();
+}
+
+//=======================================================================
+//function : GetUndoMemoryLimit
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDocStd_Document::GetUndoMemoryLimit() const
+{
+  return myUndoMemoryLimit;
+}
+
+//=======================================================================
+//function : GetUndoMemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDocStd_Document::GetUndoMemorySize() const
+{
+  return myUndoMemorySize;
+}
+
 //=======================================================================
 //function : Undos
 //purpose  : 
@@ -521,6 +567,7 @@ Standard_Integer TDocStd_Document::GetAvailableUndos() const
 void TDocStd_Document::ClearUndos()
 {
   myUndos.Clear();
+  myUndoMemorySize = 0;
   myRedos.Clear();
 #ifdef SRN_DELTA_COMPACT
   myFromRedo.Nullify();
@@ -576,8 +623,10 @@ Standard_Boolean TDocStd_Document::Undo()
 #ifdef OCCT_DEBUG_DELTA
     cout<<"DF before Undo =================================="<<endl; TDF_Tool::DeepDump(cout,myData);
 #endif
+    myUndoMemorySize -= myUndos.Last()->MemorySize();
     Handle(TDF_Delta) D = myData->Undo(myUndos.Last(),Standard_True);
     D->SetName(myUndos.Last()->Name());
+    AppendToJournal(D);
 #ifdef OCCT_DEBUG_DELTA
     cout<<"DF after Undo =================================="<<endl; TDF_Tool::DeepDump(cout,myData);
 #endif
@@ -637,13 +686,16 @@ Standard_Boolean TDocStd_Document::Redo()
 #endif
     Handle(TDF_Delta) D = myData->Undo(myRedos.First(),Standard_True);
     D->SetName(myRedos.First()->Name());
+    AppendToJournal(D);
 #ifdef OCCT_DEBUG_DELTA
     cout<<"DF after Redo =================================="<<endl; TDF_Tool::DeepDump(cout,myData);
 #endif
     // Push the redo of the redo as an undo (got it !)
     myUndos.Append(D);
+    myUndoMemorySize += D->MemorySize();
     // remove the Redo from the head
     myRedos.RemoveFirst();
+    CheckUndoMemoryLimit();
     undoDone = Standard_True;
   }
   
@@ -772,6 +824,10 @@ Standard_Boolean TDocStd_Document::PerformDeltaCompaction()
   myUndos.Assign(aList); 
   myUndos.Append(aCompoundDelta); 
 
+  myUndoMemorySize = 0;
+  for(anIterator.Initialize(myUndos); anIterator.More(); anIterator.Next())
+    myUndoMemorySize += anIterator.Value()->MemorySize();
+
   //Process Redos
 
   if(myFromRedo.IsNull()) {
@@ -877,15 +933,63 @@ void TDocStd_Document::AppendDeltaToTheFirst
   }
 }
 
+//=======================================================================
+//function : AppendToJournal
+//purpose  : 
+//=======================================================================
+
+void TDocStd_Document::AppendToJournal (const Handle(TDF_Delta)& theDelta)
+{
+  if (theDelta.IsNull())
+    return;
+  if (!myIsJournalMode)
+  {
+    // the modification is missed by the journal until the next save
+    myIsJournalComplete = Standard_False;
+    return;
+  }
+
+  TDF_ListIteratorOfAttributeDeltaList anIter (theDelta->AttributeDeltas());
+  for (; anIter.More(); anIter.Next())
+    myJournal.Add (anIter.Value()->Label());
+}
+
 //=======================================================================
 //function : RemoveFirstUndo
 //purpose  : 
 //=======================================================================
 void TDocStd_Document::RemoveFirstUndo() {
   if (myUndos.IsEmpty()) return;
+  myUndoMemorySize -= myUndos.First()->MemorySize();
   myUndos.RemoveFirst();
 }
 
+//=======================================================================
+//function : CheckUndoMemoryLimit
+//purpose  : 
+//=======================================================================
+void TDocStd_Document::CheckUndoMemoryLimit()
+{
+  if (myUndoMemoryLimit == 0)
+    return;
+
+  while (myUndoMemorySize > myUndoMemoryLimit && myUndos.Extent() > 1) {
+    const Handle(TDF_Delta) aDelta = myUndos.First();
+    myUndoMemorySize -= aDelta->MemorySize();
+    myUndos.RemoveFirst();
+#ifdef SRN_DELTA_COMPACT
+    if (myFromUndo == aDelta) {
+      if (myUndos.Extent() == 1) {
+        myFromUndo.Nullify();
+        myFromRedo.Nullify();
+      }
+      else
+        myFromUndo = myUndos.First();
+    }
+#endif
+  }
+}
+
 //=======================================================================
 //function : BeforeClose
 //purpose  : 
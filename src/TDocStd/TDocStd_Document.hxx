@@ -149,6 +149,19 @@ public:
   //! NewCommand. Of course this limit is the same for Redo
   Standard_EXPORT void SetUndoLimit (const Standard_Integer L);
   
+  //! The current limit on the memory taken by the undos, in bytes.
+  Standard_EXPORT Standard_Size GetUndoMemoryLimit() const;
+  
+  //! Sets the limit on the memory taken by the stored Undo
+  //! Deltas, in bytes, as estimated by TDF_Delta::MemorySize().
+  //! When the limit is exceeded the oldest deltas are removed,
+  //! the most recent one being always kept. 0 means no limit
+  //! (default). This limit acts together with SetUndoLimit().
+  Standard_EXPORT void SetUndoMemoryLimit (const Standard_Size theLimit);
+  
+  //! Returns the estimated memory taken by the stored undos, in bytes.
+  Standard_EXPORT Standard_Size GetUndoMemorySize() const;
+  
   //! Remove all stored Undos and Redos
   Standard_EXPORT void ClearUndos();
   
@@ -245,6 +258,32 @@ public:
   //! Prepares document for closing
   Standard_EXPORT virtual void BeforeClose();
 
+  //! Enables or disables recording of the labels modified by committed
+  //! commands, undo and redo into the modification journal.
+  //! The journal is used by storage drivers to save the document incrementally.
+  //! Modifications are taken from the transaction deltas, thus the journal
+  //! is complete only if undo is enabled (see SetUndoLimit()) and the
+  //! document is modified within commands.
+  void SetJournalMode (const Standard_Boolean theIsOn);
+
+  //! Returns True if the modification journal is recorded.
+  Standard_Boolean IsJournalMode() const;
+
+  //! Returns the labels modified since the last call of ClearJournal().
+  const TDF_LabelMap& JournalLabels() const;
+
+  //! Returns True if the journal covers all modifications of the document
+  //! since the last call of ClearJournal(). This is not the case if a command
+  //! was committed, undone or redone while the journal mode was off,
+  //! if the data were modified outside of commands or with undo disabled
+  //! (see TDF_Data::NbModificationsOutOfTransaction()),
+  //! or if the data have been replaced by SetData().
+  Standard_Boolean IsJournalComplete() const;
+
+  //! Clears the modification journal; called by storage and retrieval
+  //! drivers once the document matches its file.
+  void ClearJournal();
+
 
 
 
@@ -274,8 +313,16 @@ private:
   //! ===============
   Standard_EXPORT static void AppendDeltaToTheFirst (const Handle(TDocStd_CompoundDelta)& theDelta1, const Handle(TDF_Delta)& theDelta2);
 
+  //! Records the labels modified by <theDelta> in the modification journal.
+  Standard_EXPORT void AppendToJournal (const Handle(TDF_Delta)& theDelta);
+
+  //! Removes the oldest undos while their memory exceeds the limit.
+  Standard_EXPORT void CheckUndoMemoryLimit();
+
   Handle(TDF_Data) myData;
   Standard_Integer myUndoLimit;
+  Standard_Size myUndoMemoryLimit;
+  Standard_Size myUndoMemorySize;
   TDF_Transaction myUndoTransaction;
   Handle(TDF_Delta) myFromUndo;
   Handle(TDF_Delta) myFromRedo;
@@ -284,6 +331,10 @@ private:
   TDF_DeltaList myUndoFILO;
   Standard_Boolean myOnlyTransactionModification;
   Standard_Boolean mySaveEmptyLabels;
+  Standard_Boolean myIsJournalMode;
+  Standard_Boolean myIsJournalComplete;
+  Standard_Integer myJournalBase;
+  TDF_LabelMap myJournal;
 
 };
 
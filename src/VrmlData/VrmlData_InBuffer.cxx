@@ -0,0 +1,132 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <VrmlData_InBuffer.hxx>
+
+#include <Standard_CString.hxx>
+
+#include <stdlib.h>
+
+namespace
+{
+  //! Powers of 10 exactly representable in double precision.
+  static const double THE_POW10[] =
+  {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  //! Largest mantissa converted to double without rounding.
+  static const uint64_t THE_MAX_EXACT_MANTISSA = (uint64_t )1 << 53;
+
+  inline bool isDigit (const char theChar)
+  {
+    return theChar >= '0' && theChar <= '9';
+  }
+}
+
+//=======================================================================
+//function : ParseReal
+//purpose  : When both the mantissa and the power of 10 are exact doubles,
+//           their product (or quotient) is correctly rounded, i.e. equal
+//           to the result of Strtod().
+//=======================================================================
+
+Standard_Real VrmlData_InBuffer::ParseReal (const char * theStr,
+                                            char **      theEnd)
+{
+  const char * ptr = theStr;
+  const Standard_Boolean isNegative = (* ptr == '-');
+  if (* ptr == '-' || * ptr == '+')
+    ptr++;
+
+  uint64_t aMantissa (0);
+  Standard_Integer aNbDigits (0), anExp (0);
+  Standard_Boolean hasDigits (Standard_False);
+  for (; isDigit (* ptr); ptr++) {
+    hasDigits = Standard_True;
+    if (aNbDigits < 19) {
+      aMantissa = aMantissa * 10 + (* ptr - '0');
+      if (aMantissa)
+        aNbDigits++;
+    } else
+      anExp++;
+  }
+  if (* ptr == '.') {
+    for (ptr++; isDigit (* ptr); ptr++) {
+      hasDigits = Standard_True;
+      if (aNbDigits < 19) {
+        aMantissa = aMantissa * 10 + (* ptr - '0');
+        if (aMantissa)
+          aNbDigits++;
+        anExp--;
+      }
+    }
+  }
+  if (* ptr == 'e' || * ptr == 'E') {
+    const char * ptrExp = ptr + 1;
+    const Standard_Boolean isNegExp = (* ptrExp == '-');
+    if (* ptrExp == '-' || * ptrExp == '+')
+      ptrExp++;
+    if (isDigit (* ptrExp)) {
+      Standard_Integer aValue (0);
+      for (; isDigit (* ptrExp); ptrExp++)
+        if (aValue < 10000)
+          aValue = aValue * 10 + (* ptrExp - '0');
+      anExp += isNegExp ? -aValue : aValue;
+      ptr = ptrExp;
+    }
+  }
+
+  // special values, hexadecimal and long numbers are left to Strtod()
+  if (hasDigits == Standard_False || aNbDigits >= 19 ||
+      * ptr == 'x' || * ptr == 'X' ||
+      aMantissa > THE_MAX_EXACT_MANTISSA || anExp < -22 || anExp > 22)
+    return Strtod (theStr, theEnd);
+
+  Standard_Real aResult = static_cast<Standard_Real> (aMantissa);
+  if (anExp < 0)
+    aResult /= THE_POW10[-anExp];
+  else
+    aResult *= THE_POW10[anExp];
+  if (theEnd)
+    * theEnd = const_cast<char *> (ptr);
+  return isNegative ? -aResult : aResult;
+}
+
+//=======================================================================
+//function : ParseInteger
+//purpose  : 
+//=======================================================================
+
+long VrmlData_InBuffer::ParseInteger (const char * theStr,
+                                      char **      theEnd)
+{
+  const char * ptr = theStr;
+  const Standard_Boolean isNegative = (* ptr == '-');
+  if (* ptr == '-' || * ptr == '+')
+    ptr++;
+
+  long aResult (0);
+  Standard_Integer aNbDigits (0);
+  for (; isDigit (* ptr) && aNbDigits < 9; ptr++, aNbDigits++)
+    aResult = aResult * 10 + (* ptr - '0');
+
+  // empty input and values that might overflow are left to strtol()
+  if (aNbDigits == 0 || isDigit (* ptr))
+    return strtol (theStr, theEnd, 10);
+
+  if (theEnd)
+    * theEnd = const_cast<char *> (ptr);
+  return isNegative ? -aResult : aResult;
+}
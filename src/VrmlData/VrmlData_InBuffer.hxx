@@ -18,21 +18,56 @@
 
 #include <Standard_IStream.hxx>
 #include <Standard_Boolean.hxx>
+#include <Standard.hxx>
 /**
  * Structure passed to the methods dealing with input stream.
+ * The stream is read by large blocks; lines are delimited inside the block
+ * in place, so that no data is copied until it is converted into values.
  */
 struct VrmlData_InBuffer {
   Standard_IStream& Input;
-  char              Line[8096];
+  char *            Line;       ///< current line (zero-terminated, inside Block)
   char *            LinePtr;
   Standard_Boolean  IsProcessed;
   Standard_Integer  LineCount;
+  char *            Block;      ///< data read from the stream
+  Standard_Size     BlockSize;  ///< allocated size of Block
+  Standard_Size     DataEnd;    ///< end of valid data in Block
+  Standard_Size     NextLine;   ///< offset of the line following the current one
   VrmlData_InBuffer (Standard_IStream& theStream)
     : Input       (theStream),
-      LinePtr     (&Line[0]),
       IsProcessed (Standard_False),
-      LineCount   (0) {};
+      LineCount   (0),
+      BlockSize   (1 << 20),
+      DataEnd     (0),
+      NextLine    (0)
+  {
+    Block = static_cast<char *> (Standard::Allocate (BlockSize));
+    Block[0] = '\0';
+    Line = LinePtr = Block;
+  }
+  ~VrmlData_InBuffer () { Standard::Free (Block); }
+
+  /**
+   * Parse the decimal real number starting at theStr.
+   * The common case of numbers with up to 15 significant digits
+   * is converted exactly without calling Strtod(), which is used otherwise.
+   * @param theEnd
+   *   receives the pointer to the character following the number,
+   *   or theStr if no number could be parsed
+   */
+  Standard_EXPORT static Standard_Real ParseReal    (const char * theStr,
+                                                     char **      theEnd);
+
+  /**
+   * Parse the decimal integer number starting at theStr (same as strtol()
+   * with base 10).
+   */
+  Standard_EXPORT static long          ParseInteger (const char * theStr,
+                                                     char **      theEnd);
+
   private:
+    VrmlData_InBuffer (const VrmlData_InBuffer&);
     void operator= (const VrmlData_InBuffer&);
 };
 
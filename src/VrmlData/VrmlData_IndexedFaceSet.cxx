@@ -25,7 +25,7 @@
 #include <VrmlData_Scene.hxx>
 #include <Precision.hxx>
 #include <NCollection_Vector.hxx>
-#include <NCollection_DataMap.hxx>
+#include <NCollection_Array1.hxx>
 #include <Poly.hxx>
 #include <TShort_HArray1OfShortReal.hxx>
 
@@ -84,13 +84,16 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
     const gp_XYZ * arrNodes = myCoords->Values();
     Standard_Integer i, nTri(0);
 
-    NCollection_DataMap <int, int> mapNodeId;
+    // Index of each used node in the triangulation (0 for unused nodes)
+    const int nNodes = (int)myCoords->Length();
+    NCollection_Array1<Standard_Integer> arrNodeId (0, Max (nNodes, 1) - 1);
+    arrNodeId.Init (0);
 
     // Count non-degenerated triangles
-    const int nNodes = (int)myCoords->Length();
     for (i = 0; i < (int)myNbPolygons; i++) {
       const Standard_Integer * arrIndice;
-      if (Polygon(i, arrIndice) == 3) {
+      const Standard_Integer nIndice = Polygon(i, arrIndice);
+      if (nIndice == 3) {
         //Check indices for out of bound
         if (arrIndice[0] < 0 ||
             arrIndice[0] >= nNodes ||
@@ -111,14 +114,14 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
           continue;
         }
       }
-      if (mapNodeId.IsBound (arrIndice[0]) == Standard_False)
-        mapNodeId.Bind (arrIndice[0], 0);
-      if (mapNodeId.IsBound (arrIndice[1]) == Standard_False)
-        mapNodeId.Bind (arrIndice[1], 0);
-      if (mapNodeId.IsBound (arrIndice[2]) == Standard_False)
-        mapNodeId.Bind (arrIndice[2], 0);
+      for (Standard_Integer j = 0; j < Min (nIndice, 3); j++)
+        if (arrIndice[j] >= 0 && arrIndice[j] < nNodes)
+          arrNodeId(arrIndice[j]) = 1;
     }
-    const Standard_Integer nbNodes (mapNodeId.Extent());
+    Standard_Integer nbNodes (0);
+    for (i = 0; i < nNodes; i++)
+      if (arrNodeId(i))
+        arrNodeId(i) = ++nbNodes;
     if (!nbNodes)
     {
         myIsModified = Standard_False;
@@ -134,13 +137,9 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
 
     // Copy the triangulation vertices
     TColgp_Array1OfPnt& aNodes = aTriangulation->ChangeNodes();
-    NCollection_DataMap <int, int>::Iterator anIterN(mapNodeId);
-    for (i = 1; anIterN.More(); anIterN.Next()) {
-      const int aKey = anIterN.Key();
-      const gp_XYZ& aNodePnt = arrNodes[aKey];
-      aNodes(i) = gp_Pnt (aNodePnt);
-      anIterN.ChangeValue() = i++;
-    }
+    for (i = 0; i < nNodes; i++)
+      if (arrNodeId(i))
+        aNodes(arrNodeId(i)) = gp_Pnt (arrNodes[i]);
 
     // Copy the triangles. Only the triangle-type polygons are supported.
     // In this loop we also get rid of any possible degenerated triangles.
@@ -153,9 +152,9 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
             arrIndice[0] < nNodes &&
             arrIndice[1] < nNodes &&
             arrIndice[2] < nNodes)  // check to avoid previously skipped faces
-          aTriangles(++nTri).Set (mapNodeId(arrIndice[0]),
-                                  mapNodeId(arrIndice[1]),
-                                  mapNodeId(arrIndice[2]));
+          aTriangles(++nTri).Set (arrNodeId(arrIndice[0]),
+                                  arrNodeId(arrIndice[1]),
+                                  arrNodeId(arrIndice[2]));
     }
 
     // Normals should be defined; if they are not, compute them
@@ -169,10 +168,11 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
         new TShort_HArray1OfShortReal (1, 3*nbNodes);
       if (myNormalPerVertex) {
         if (myArrNormalInd == 0L) {
-          NCollection_DataMap <int, int>::Iterator anIterNN (mapNodeId);
-          for (; anIterNN.More (); anIterNN.Next ()) {
-            Standard_Integer anIdx = (anIterNN.Value() - 1) * 3 + 1;
-            const gp_XYZ& aNormal = myNormals->Normal (anIterNN.Key ());
+          for (i = 0; i < nNodes; i++) {
+            if (arrNodeId(i) == 0)
+              continue;
+            Standard_Integer anIdx = (arrNodeId(i) - 1) * 3 + 1;
+            const gp_XYZ& aNormal = myNormals->Normal (i);
             Normals->SetValue (anIdx + 0, Standard_ShortReal (aNormal.X ()));
             Normals->SetValue (anIdx + 1, Standard_ShortReal (aNormal.Y ()));
             Normals->SetValue (anIdx + 2, Standard_ShortReal (aNormal.Z ()));
@@ -193,7 +193,7 @@ const Handle(TopoDS_TShape)& VrmlData_IndexedFaceSet::TShape ()
               if (IndiceNormals(i, arrIndice) == 3) {
                 for (Standard_Integer j = 0; j < 3; j++) {
                   const gp_XYZ& aNormal = myNormals->Normal (arrIndice[j]);
-                  Standard_Integer anInd = (mapNodeId(anArrNodes[j]) - 1) * 3 + 1;
+                  Standard_Integer anInd = (arrNodeId(anArrNodes[j]) - 1) * 3 + 1;
                   Normals->SetValue (anInd + 0, Standard_ShortReal (aNormal.X()));
                   Normals->SetValue (anInd + 1, Standard_ShortReal (aNormal.Y()));
                   Normals->SetValue (anInd + 2, Standard_ShortReal (aNormal.Z()));
@@ -207,7 +207,7 @@ VrmlData_ErrorStatus VrmlData_Node::ReadInteger (VrmlData_InBuffer& theBuffer,
   if (OK(aStatus, VrmlData_Scene::ReadLine(theBuffer))) {
     char * endptr;
     long aResult;
-    aResult = strtol (theBuffer.LinePtr, &endptr, 10);
+    aResult = VrmlData_InBuffer::ParseInteger (theBuffer.LinePtr, &endptr);
     if (endptr == theBuffer.LinePtr)
       aStatus = VrmlData_NumericInputError;
     else {
@@ -201,28 +201,51 @@ const Handle(VrmlData_WorldInfo)& VrmlData_Scene::WorldInfo() const
 
 VrmlData_ErrorStatus VrmlData_Scene::readLine (VrmlData_InBuffer& theBuffer)
 {
-  VrmlData_ErrorStatus aStatus = VrmlData_StatusOK;
-  if (theBuffer.Input.eof())
-    aStatus = VrmlData_EndOfFile;
-  else {
-    theBuffer.Input.getline (theBuffer.Line, sizeof(theBuffer.Line));
-    theBuffer.LineCount++;
-    const int stat = theBuffer.Input.rdstate();
-    if (stat & ios::badbit) {
-      aStatus = VrmlData_UnrecoverableError;
+  // Find the end of the next line in the block, reading the stream if the
+  // block contains no complete line
+  Standard_Size aLineEnd = theBuffer.NextLine;
+  for (;;) {
+    const char * anEol = static_cast<const char *>
+      (memchr (theBuffer.Block + aLineEnd, '\n', theBuffer.DataEnd - aLineEnd));
+    if (anEol) {
+      aLineEnd = Standard_Size(anEol - theBuffer.Block);
+      break;
     }
-    else if (stat & ios::failbit) {
-      if (stat & ios::eofbit) {
-        aStatus = VrmlData_EndOfFile;
-      }
-      else {
-        aStatus = VrmlData_GeneralError;
-      }
+    aLineEnd = theBuffer.DataEnd;
+    if (!theBuffer.Input.good())
+      break;
+
+    // Move the incomplete line to the beginning of the block, enlarge the
+    // block if this line occupies it completely
+    const Standard_Size aTail = theBuffer.DataEnd - theBuffer.NextLine;
+    memmove (theBuffer.Block, theBuffer.Block + theBuffer.NextLine, aTail);
+    theBuffer.NextLine = 0;
+    theBuffer.DataEnd  = aTail;
+    if (aTail + 1 >= theBuffer.BlockSize) {
+      theBuffer.BlockSize *= 2;
+      theBuffer.Block = static_cast<char *>
+        (Standard::Reallocate (theBuffer.Block, theBuffer.BlockSize));
     }
-    theBuffer.LinePtr = &theBuffer.Line[0];
-    theBuffer.IsProcessed = Standard_False;
+    // one byte is reserved for the terminating zero
+    theBuffer.Input.read (theBuffer.Block + aTail,
+                          theBuffer.BlockSize - 1 - aTail);
+    theBuffer.DataEnd += Standard_Size(theBuffer.Input.gcount());
+    if (theBuffer.Input.bad())
+      return VrmlData_UnrecoverableError;
+    aLineEnd = aTail;
   }
-  return aStatus;
+
+  if (aLineEnd == theBuffer.DataEnd && theBuffer.NextLine == aLineEnd)
+    // neither a line nor its terminator have been found
+    return VrmlData_EndOfFile;
+
+  theBuffer.Block[aLineEnd] = '\0';
+  theBuffer.Line = theBuffer.Block + theBuffer.NextLine;
+  theBuffer.NextLine = aLineEnd < theBuffer.DataEnd ? aLineEnd + 1 : aLineEnd;
+  theBuffer.LineCount++;
+  theBuffer.LinePtr = theBuffer.Line;
+  theBuffer.IsProcessed = Standard_False;
+  return VrmlData_StatusOK;
 }
 
 //=======================================================================
@@ -686,7 +709,7 @@ VrmlData_ErrorStatus VrmlData_Scene::ReadReal
   VrmlData_ErrorStatus aStatus;
   if (VrmlData_Node::OK(aStatus, VrmlData_Scene::ReadLine(theBuffer))) {
     char * endptr;
-    aResult = Strtod (theBuffer.LinePtr, &endptr);
+    aResult = VrmlData_InBuffer::ParseReal (theBuffer.LinePtr, &endptr);
     if (endptr == theBuffer.LinePtr)
       aStatus = VrmlData_NumericInputError;
     else if (isOnlyPositive && aResult < 0.001*Precision::Confusion())
@@ -716,7 +739,7 @@ VrmlData_ErrorStatus VrmlData_Scene::ReadXYZ
     if (!VrmlData_Node::OK(aStatus, VrmlData_Scene::ReadLine(theBuffer)))
       break;
     char * endptr;
-    aVal[i] = Strtod (theBuffer.LinePtr, &endptr);
+    aVal[i] = VrmlData_InBuffer::ParseReal (theBuffer.LinePtr, &endptr);
     if (endptr == theBuffer.LinePtr) {
       aStatus = VrmlData_NumericInputError;
       break;
@@ -758,7 +781,7 @@ VrmlData_ErrorStatus VrmlData_Scene::ReadXY
     if (!VrmlData_Node::OK(aStatus, VrmlData_Scene::ReadLine(theBuffer)))
       break;
     char * endptr;
-    aVal[i] = Strtod (theBuffer.LinePtr, &endptr);
+    aVal[i] = VrmlData_InBuffer::ParseReal (theBuffer.LinePtr, &endptr);
     if (endptr == theBuffer.LinePtr) {
       aStatus = VrmlData_NumericInputError;
       break;
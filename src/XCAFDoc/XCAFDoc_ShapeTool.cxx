@@ -30,11 +30,13 @@
 #include <TDF_Attribute.hxx>
 #include <TDF_ChildIDIterator.hxx>
 #include <TDF_ChildIterator.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_Label.hxx>
 #include <TDF_LabelMap.hxx>
 #include <TDF_LabelSequence.hxx>
 #include <TDF_MapIteratorOfLabelMap.hxx>
 #include <TDF_RelocationTable.hxx>
+#include <TDF_TagSource.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <TNaming_Builder.hxx>
@@ -93,6 +95,9 @@ Handle(XCAFDoc_ShapeTool) XCAFDoc_ShapeTool::Set(const TDF_Label& L)
 //=======================================================================
 
 XCAFDoc_ShapeTool::XCAFDoc_ShapeTool()
+: myIndexedTag (0),
+  myIndexedTime (0),
+  myIndexedTransaction (0)
 {
   hasSimpleShapes = Standard_False;
 }
@@ -255,22 +260,8 @@ Standard_Boolean XCAFDoc_ShapeTool::Search (const TopoDS_Shape &S,
     if ( findInstance && FindShape ( S, L, Standard_True ) )
       return Standard_True;
     // try to find component of assembly
-    if ( findComponent ) {
-      TDF_LabelSequence labels;
-      GetShapes ( labels );
-      for ( Standard_Integer i=1; i <= labels.Length(); i++ ) {
-	if ( ! IsAssembly ( labels.Value(i) ) ) continue;
-	TDF_LabelSequence comp;
-	GetComponents ( labels.Value(i), comp );
-	for ( Standard_Integer j=1; j <= comp.Length(); j++ ) {
-	  TopoDS_Shape c = GetShape ( comp.Value(j) );
-	  if ( c.IsSame ( S ) ) {
-	    L = comp.Value(j);
-	    return Standard_True;
-	  }
-	}
-      }
-    }
+    if ( findComponent && searchComponent ( S, L ) )
+      return Standard_True;
   }
   // try to find top-level simple shape
   if ( FindShape ( S, L, Standard_False ) ) return Standard_True;
@@ -417,6 +408,11 @@ void XCAFDoc_ShapeTool::SetShape (const TDF_Label& L, const TopoDS_Shape& S)
   if(!myShapeLabels.IsBound(S)) {
     myShapeLabels.Bind(S,L);
   }
+
+  // label already indexed : add its new subshapes
+  // (entries left for the former shape are checked when found)
+  if ( IsTopLevel ( L ) && L.Tag() <= myIndexedTag )
+    indexLabel ( L );
 }
 
 //=======================================================================
@@ -465,6 +461,9 @@ TDF_Label XCAFDoc_ShapeTool::addShape (const TopoDS_Shape& S, const Standard_Boo
     S0.Location ( loc );
     TDF_Label L = addShape ( S0, makeAssembly );
     MakeReference ( ShapeLabel, L, S.Location() );
+    // the tag of the label may be reused after undo : index it now
+    if ( ShapeLabel.Tag() <= myIndexedTag )
+      indexLabel ( ShapeLabel );
     return ShapeLabel;
   }
   
@@ -505,18 +504,10 @@ TDF_Label XCAFDoc_ShapeTool::addShape (const TopoDS_Shape& S, const Standard_Boo
     }
   }
   
-  if(!IsAssembly(ShapeLabel)) {
-    //const TopTools_IndexedMapOfShape tmpMap = A->GetMap();
-    //for(Standard_Integer i=1; i<=tmpMap.Extent(); i++)
-    //mySubShapes.Bind(tmpMap.FindKey(i),ShapeLabel);
-    for(Standard_Integer i=1; i<=A->GetMap().Extent(); i++)
-    {
-      TopoDS_Shape aSh = A->GetMap().FindKey(i);
-      mySubShapes.Bind(aSh,ShapeLabel);
-    }
-    //mySubShapes.Bind(ShapeLabel,A->GetMap());
-  }
-
+  // subshapes of the new label are indexed at next search,
+  // unless its tag is reused after undo
+  if ( ShapeLabel.Tag() <= myIndexedTag )
+    indexLabel ( ShapeLabel );
   return ShapeLabel;
 }
 
@@ -955,6 +946,8 @@ TDF_Label XCAFDoc_ShapeTool::AddComponent (const TDF_Label& assembly,
   {
     if (!myShapeLabels.IsBound(aShape))
       myShapeLabels.Bind(aShape, L);
+    if (IsTopLevel(assembly) && assembly.Tag() <= myIndexedTag && !myComponents.IsBound(aShape))
+      myComponents.Bind(aShape, L);
   }
 
   return L;
@@ -1133,14 +1126,7 @@ TDF_Label XCAFDoc_ShapeTool::AddSubShape (const TDF_Label &shapeL,
 
 TDF_Label XCAFDoc_ShapeTool::FindMainShapeUsingMap(const TopoDS_Shape &sub) const
 {
-  //for(Standard_Integer i=1; i<=myNotAssemblies.Length(); i++) {
-  //  TDF_Label L = myNotAssemblies.Value(i);
-  //  if(IsSubShape(L,sub)) return L;
-  //}
-  if(mySubShapes.IsBound(sub))
-    return mySubShapes.Find(sub);
-  TDF_Label L0;
-  return L0;
+  return FindMainShape(sub);
 }
 
 
@@ -1151,13 +1137,136 @@ TDF_Label XCAFDoc_ShapeTool::FindMainShapeUsingMap(const TopoDS_Shape &sub) cons
 
 TDF_Label XCAFDoc_ShapeTool::FindMainShape (const TopoDS_Shape &sub) const
 {
-  TDF_ChildIterator it(Label());
-  for (; it.More(); it.Next()) {
-    TDF_Label L = it.Value();
-    if ( ! IsAssembly ( L ) && IsSubShape ( L, sub ) ) return L;
+  TDF_Label L;
+  if ( sub.IsNull() ) return L;
+  Standard_Mutex::Sentry aSentry ( myIndexMutex );
+  updateIndex();
+  if ( ! mySubShapes.Find ( sub, L ) ) return TDF_Label();
+  if ( ! IsAssembly ( L ) && IsSubShape ( L, sub ) ) return L;
+
+  // the label has been modified since it was indexed : replace
+  // this entry only, by the first top-level shape containing <sub>
+  mySubShapes.UnBind ( sub );
+  for ( TDF_ChildIterator it ( Label() ); it.More(); it.Next() ) {
+    L = it.Value();
+    if ( ! IsAssembly ( L ) && IsSubShape ( L, sub ) ) {
+      mySubShapes.Bind ( sub, L );
+      return L;
+    }
   }
-  TDF_Label L0;
-  return L0;
+  return TDF_Label();
+}
+
+//=======================================================================
+//function : searchComponent
+//purpose  : private
+//=======================================================================
+
+Standard_Boolean XCAFDoc_ShapeTool::searchComponent (const TopoDS_Shape& theShape,
+                                                     TDF_Label& theLabel) const
+{
+  Standard_Mutex::Sentry aSentry ( myIndexMutex );
+  updateIndex();
+  if ( ! myComponents.Find ( theShape, theLabel ) ) return Standard_False;
+  if ( IsComponent ( theLabel ) && GetShape ( theLabel ).IsSame ( theShape ) ) return Standard_True;
+
+  // the component has been modified since it was indexed : replace
+  // this entry only, by the first component equal to <theShape>
+  myComponents.UnBind ( theShape );
+  for ( TDF_ChildIterator it ( Label() ); it.More(); it.Next() ) {
+    if ( ! IsAssembly ( it.Value() ) ) continue;
+    for ( TDF_ChildIterator itComp ( it.Value() ); itComp.More(); itComp.Next() ) {
+      TopoDS_Shape aComp;
+      if ( IsComponent ( itComp.Value() ) && GetShape ( itComp.Value(), aComp ) && aComp.IsSame ( theShape ) ) {
+        theLabel = itComp.Value();
+        myComponents.Bind ( theShape, theLabel );
+        return Standard_True;
+      }
+    }
+  }
+  return Standard_False;
+}
+
+//=======================================================================
+//function : updateIndex
+//purpose  : private
+//=======================================================================
+
+void XCAFDoc_ShapeTool::updateIndex() const
+{
+  // top-level labels are created by TDF_TagSource, so the labels
+  // to be indexed are the ones with tags above the last indexed one
+  Standard_Integer aLastTag = 0;
+  Handle(TDF_TagSource) aTagSource;
+  if ( Label().FindAttribute ( TDF_TagSource::GetID(), aTagSource ) )
+    aLastTag = aTagSource->Get();
+  else {
+    for ( TDF_ChildIterator it ( Label() ); it.More(); it.Next() )
+      aLastTag = Max ( aLastTag, it.Value().Tag() );
+  }
+
+  // undo and abort of transaction roll back the tag source and the time
+  // of the data framework, the tags of removed labels being reused then
+  Handle(TDF_Data) aData = Label().Data();
+  if ( aLastTag < myIndexedTag
+    || aData->Time() < myIndexedTime
+    || aData->Transaction() < myIndexedTransaction )
+    resetIndex();
+
+  for ( Standard_Integer aTag = myIndexedTag + 1; aTag <= aLastTag; aTag++ ) {
+    TDF_Label L = Label().FindChild ( aTag, Standard_False );
+    if ( ! L.IsNull() )
+      indexLabel ( L );
+  }
+  if ( aLastTag > myIndexedTag )
+    myIndexedTag = aLastTag;
+  myIndexedTime = aData->Time();
+  myIndexedTransaction = aData->Transaction();
+}
+
+//=======================================================================
+//function : indexLabel
+//purpose  : private
+//=======================================================================
+
+void XCAFDoc_ShapeTool::indexLabel (const TDF_Label& theLabel) const
+{
+  // the first label found keeps the shape, as in the search by iteration
+  if ( IsAssembly ( theLabel ) ) {
+    for ( TDF_ChildIterator it ( theLabel ); it.More(); it.Next() ) {
+      TopoDS_Shape aComp;
+      if ( IsComponent ( it.Value() ) && GetShape ( it.Value(), aComp ) && ! myComponents.IsBound ( aComp ) )
+        myComponents.Bind ( aComp, it.Value() );
+    }
+    return;
+  }
+
+  Handle(XCAFDoc_ShapeMapTool) A;
+  if ( ! theLabel.FindAttribute ( XCAFDoc_ShapeMapTool::GetID(), A ) ) {
+    TopoDS_Shape aShape = GetShape ( theLabel );
+    if ( aShape.IsNull() ) return;
+    A = XCAFDoc_ShapeMapTool::Set ( theLabel );
+    A->SetShape ( aShape );
+  }
+  const TopTools_IndexedMapOfShape& aMap = A->GetMap();
+  for ( Standard_Integer i = 1; i <= aMap.Extent(); i++ ) {
+    if ( ! mySubShapes.IsBound ( aMap.FindKey ( i ) ) )
+      mySubShapes.Bind ( aMap.FindKey ( i ), theLabel );
+  }
+}
+
+//=======================================================================
+//function : resetIndex
+//purpose  : private
+//=======================================================================
+
+void XCAFDoc_ShapeTool::resetIndex() const
+{
+  mySubShapes.Clear();
+  myComponents.Clear();
+  myIndexedTag = 0;
+  myIndexedTime = 0;
+  myIndexedTransaction = 0;
 }
 
 
@@ -21,6 +21,7 @@
 
 #include <XCAFDoc_DataMapOfShapeLabel.hxx>
 #include <Standard_Boolean.hxx>
+#include <Standard_Mutex.hxx>
 #include <TDF_Attribute.hxx>
 #include <TDF_LabelSequence.hxx>
 #include <Standard_Integer.hxx>
@@ -171,6 +172,8 @@ public:
   //! among top-level shapes
   //! * If not found and findSubshape is True, tries to find a
   //! shape as a subshape of top-level simple shapes
+  //! Components and subshapes are found using the index
+  //! described in FindMainShape()
   //! Returns False if nothing is found
   Standard_EXPORT Standard_Boolean Search (const TopoDS_Shape& S, TDF_Label& L, const Standard_Boolean findInstance = Standard_True, const Standard_Boolean findComponent = Standard_True, const Standard_Boolean findSubshape = Standard_True) const;
   
@@ -299,12 +302,18 @@ public:
   //! Returns Null label if it is not subshape
   Standard_EXPORT TDF_Label AddSubShape (const TDF_Label& shapeL, const TopoDS_Shape& sub) const;
   
+  //! Same as FindMainShape()
   Standard_EXPORT TDF_Label FindMainShapeUsingMap (const TopoDS_Shape& sub) const;
   
   //! Performs a search among top-level shapes to find
   //! the shape containing <sub> as subshape
   //! Checks only simple shapes, and returns the first found
   //! label (which should be the only one for valid model)
+  //! The search uses an index of subshapes of top-level shapes,
+  //! built at first call and then completed with the shapes added
+  //! to the document. Concurrent searches are serialized by a lock
+  //! on the index, while modifications of the document must not run
+  //! concurrently with them.
   Standard_EXPORT TDF_Label FindMainShape (const TopoDS_Shape& sub) const;
   
   //! Returns list of labels identifying subshapes of the given shape
@@ -436,8 +445,30 @@ private:
   //! Recursively iterate all subshapes of shape from thePart, current shape to iterate its subshapes is theShape.
   Standard_EXPORT void makeSubShape(const TDF_Label& theMainShapeL, const TDF_Label& thePart, const TopoDS_Shape& theShape, const TopLoc_Location& theLoc);
 
+  //! Adds to the index of subshapes and components
+  //! the top-level labels created since its last update.
+  //! The index is built again if the data framework has been
+  //! rolled back since (undo or abort of transaction).
+  Standard_EXPORT void updateIndex() const;
+
+  //! Adds to the index the subshapes of top-level simple shape
+  //! or the components of top-level assembly <theLabel>
+  Standard_EXPORT void indexLabel (const TDF_Label& theLabel) const;
+
+  //! Clears the index of subshapes and components
+  Standard_EXPORT void resetIndex() const;
+
+  //! Searches the component of an assembly equal to <theShape>
+  //! (same TShape and location) using the index of components
+  Standard_EXPORT Standard_Boolean searchComponent (const TopoDS_Shape& theShape, TDF_Label& theLabel) const;
+
   XCAFDoc_DataMapOfShapeLabel myShapeLabels;
-  XCAFDoc_DataMapOfShapeLabel mySubShapes;
+  mutable XCAFDoc_DataMapOfShapeLabel mySubShapes;
+  mutable XCAFDoc_DataMapOfShapeLabel myComponents;
+  mutable Standard_Integer myIndexedTag;         //!< last top-level tag in the index
+  mutable Standard_Integer myIndexedTime;        //!< time of the data framework at the last update of the index
+  mutable Standard_Integer myIndexedTransaction; //!< transaction of the data framework at the last update of the index
+  mutable Standard_Mutex   myIndexMutex;         //!< lock of the index updated by the searches
   XCAFDoc_DataMapOfShapeLabel mySimpleShapes;
   Standard_Boolean hasSimpleShapes;
 
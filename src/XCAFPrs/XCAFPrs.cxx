@@ -34,6 +34,7 @@
 #include <XCAFPrs_Style.hxx>
 
 static Standard_Boolean viewnameMode = Standard_False;
+static Standard_Boolean instancedMode = Standard_False;
 
 static Standard_Boolean getShapesOfSHUO (TopLoc_IndexedMapOfLocation& theaPrevLocMap,
                                          const Handle(XCAFDoc_ShapeTool)& theSTool,
@@ -336,3 +337,23 @@ Standard_Boolean XCAFPrs::GetViewNameMode()
 {
   return viewnameMode;
 }
+
+//=======================================================================
+//function : SetInstancedMode
+//purpose  :
+//=======================================================================
+
+void XCAFPrs::SetInstancedMode (const Standard_Boolean theIsInstanced)
+{
+  instancedMode = theIsInstanced;
+}
+
+//=======================================================================
+//function : GetInstancedMode
+//purpose  :
+//=======================================================================
+
+Standard_Boolean XCAFPrs::GetInstancedMode()
+{
+  return instancedMode;
+}
@@ -49,6 +49,14 @@ public:
   
   Standard_EXPORT static Standard_Boolean GetViewNameMode();
 
+  //! Set InstancedMode to display assemblies by XCAFPrs_AISAssembly
+  //! sharing presentations of repeated parts (by XCAFPrs_Driver).
+  Standard_EXPORT static void SetInstancedMode (const Standard_Boolean theIsInstanced);
+
+  //! Return TRUE if assemblies are displayed with shared presentations of repeated parts;
+  //! FALSE by default.
+  Standard_EXPORT static Standard_Boolean GetInstancedMode();
+
 
 
 
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <XCAFPrs_AISAssembly.hxx>
+
+#include <Graphic3d_MaterialAspect.hxx>
+#include <Prs3d_Drawer.hxx>
+#include <Prs3d_ShadingAspect.hxx>
+#include <TDF_AttributeSequence.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_LayerTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(XCAFPrs_AISAssembly, AIS_MultipleConnectedInteractive)
+
+//=======================================================================
+//function : XCAFPrs_AISAssembly
+//purpose  :
+//=======================================================================
+XCAFPrs_AISAssembly::XCAFPrs_AISAssembly (const TDF_Label& theLabel)
+: myLabel (theLabel),
+  myToRebuild (Standard_True)
+{
+  //
+}
+
+//=======================================================================
+//function : Rebuild
+//purpose  :
+//=======================================================================
+void XCAFPrs_AISAssembly::Rebuild()
+{
+  myToRebuild = Standard_False;
+  DisconnectAll();
+  myPrototypes.Clear();
+  myDedicated.Clear();
+  if (myLabel.IsNull())
+  {
+    return;
+  }
+
+  myColorTool = XCAFDoc_DocumentTool::ColorTool (myLabel);
+  myLayerTool = XCAFDoc_DocumentTool::LayerTool (myLabel);
+  addInstances (myLabel, TopLoc_Location());
+  if (hasOwnMaterial)
+  {
+    SetMaterial (myDrawer->ShadingAspect()->Material());
+  }
+}
+
+//=======================================================================
+//function : Compute
+//purpose  :
+//=======================================================================
+void XCAFPrs_AISAssembly::Compute (const Handle(PrsMgr_PresentationManager3d)& thePrsMgr,
+                                   const Handle(Prs3d_Presentation)&           thePrs,
+                                   const Standard_Integer                      theMode)
+{
+  // children should be added before they are displayed by presentation manager
+  if (myToRebuild)
+  {
+    Rebuild();
+  }
+  AIS_MultipleConnectedInteractive::Compute (thePrsMgr, thePrs, theMode);
+}
+
+//=======================================================================
+//function : createPresentation
+//purpose  :
+//=======================================================================
+Handle(XCAFPrs_AISObject) XCAFPrs_AISAssembly::createPresentation (const TDF_Label& theLabel) const
+{
+  return new XCAFPrs_AISObject (theLabel);
+}
+
+//=======================================================================
+//function : hasOwnStyle
+//purpose  :
+//=======================================================================
+Standard_Boolean XCAFPrs_AISAssembly::hasOwnStyle (const TDF_Label& theLabel) const
+{
+  if (myColorTool->IsSet (theLabel, XCAFDoc_ColorGen)
+   || myColorTool->IsSet (theLabel, XCAFDoc_ColorSurf)
+   || myColorTool->IsSet (theLabel, XCAFDoc_ColorCurv)
+   || myColorTool->IsColorByLayer (theLabel)
+   || !myColorTool->IsVisible (theLabel))
+  {
+    return Standard_True;
+  }
+
+  // layers might hide the shape or define its color
+  TDF_LabelSequence aLayers;
+  if (myLayerTool->GetLayers (theLabel, aLayers)
+  && !aLayers.IsEmpty())
+  {
+    return Standard_True;
+  }
+
+  // SHUO overrides styles of the nested occurrences
+  TDF_AttributeSequence aShuoAttribs;
+  return XCAFDoc_ShapeTool::IsComponent (theLabel)
+      && XCAFDoc_ShapeTool::GetAllComponentSHUO (theLabel, aShuoAttribs)
+      && !aShuoAttribs.IsEmpty();
+}
+
+//=======================================================================
+//function : addInstances
+//purpose  :
+//=======================================================================
+void XCAFPrs_AISAssembly::addInstances (const TDF_Label& theLabel,
+                                        const TopLoc_Location& theLocation)
+{
+  TDF_Label       aShapeLabel = theLabel;
+  TopLoc_Location aShapeLoc   = theLocation;
+  if (XCAFDoc_ShapeTool::GetReferredShape (theLabel, aShapeLabel))
+  {
+    aShapeLoc = theLocation.Multiplied (XCAFDoc_ShapeTool::GetLocation (theLabel));
+  }
+  else
+  {
+    aShapeLabel = theLabel;
+  }
+
+  const Standard_Boolean isAssembly = XCAFDoc_ShapeTool::IsAssembly (aShapeLabel);
+  if ((theLabel != aShapeLabel && hasOwnStyle (theLabel))
+   || (isAssembly && hasOwnStyle (aShapeLabel)))
+  {
+    // styles of the component (or sub-assembly) are inherited by nested shapes,
+    // which therefore cannot share presentation with other occurrences
+    Handle(XCAFPrs_AISObject) aPrs = createPresentation (theLabel);
+    myDedicated.Append (aPrs);
+    Connect (aPrs, theLocation.Transformation());
+    return;
+  }
+
+  if (isAssembly)
+  {
+    TDF_LabelSequence aComponents;
+    XCAFDoc_ShapeTool::GetComponents (aShapeLabel, aComponents);
+    for (TDF_LabelSequence::Iterator aCompIter (aComponents); aCompIter.More(); aCompIter.Next())
+    {
+      addInstances (aCompIter.Value(), aShapeLoc);
+    }
+    return;
+  }
+
+  Handle(XCAFPrs_AISObject)* aPrototype = myPrototypes.ChangeSeek (aShapeLabel);
+  if (aPrototype == NULL)
+  {
+    aPrototype = myPrototypes.Bound (aShapeLabel, createPresentation (aShapeLabel));
+  }
+  Connect (*aPrototype, aShapeLoc.Transformation());
+}
+
+//=======================================================================
+//function : SetMaterial
+//purpose  :
+//=======================================================================
+void XCAFPrs_AISAssembly::SetMaterial (const Graphic3d_MaterialAspect& theMaterial)
+{
+  AIS_MultipleConnectedInteractive::SetMaterial (theMaterial);
+  for (NCollection_DataMap<TDF_Label, Handle(XCAFPrs_AISObject), TDF_LabelMapHasher>::Iterator aPrsIter (myPrototypes);
+       aPrsIter.More(); aPrsIter.Next())
+  {
+    aPrsIter.Value()->SetMaterial (theMaterial);
+  }
+  for (NCollection_Sequence<Handle(XCAFPrs_AISObject)>::Iterator aPrsIter (myDedicated); aPrsIter.More(); aPrsIter.Next())
+  {
+    aPrsIter.Value()->SetMaterial (theMaterial);
+  }
+}
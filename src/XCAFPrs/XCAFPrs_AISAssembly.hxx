@@ -0,0 +1,101 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _XCAFPrs_AISAssembly_HeaderFile
+#define _XCAFPrs_AISAssembly_HeaderFile
+
+#include <AIS_MultipleConnectedInteractive.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Sequence.hxx>
+#include <TDF_Label.hxx>
+#include <TDF_LabelMapHasher.hxx>
+#include <TopLoc_Location.hxx>
+#include <XCAFPrs_AISObject.hxx>
+
+class XCAFDoc_ColorTool;
+class XCAFDoc_LayerTool;
+
+//! Interactive object displaying the shape label of DECAF document (usually an assembly)
+//! with presentations shared between repeated occurrences of the same part.
+//!
+//! Each distinct part (simple shape label) is presented by a single XCAFPrs_AISObject (prototype),
+//! which is computed and made selectable only once.
+//! Every occurrence of the part is an AIS_ConnectedInteractive instance referring to the prototype
+//! with its own location, so that graphic structures and sensitive entities of the prototype
+//! are reused by all instances.
+//! Memory and computation time thus scale with the number of unique parts rather than with the number of occurrences.
+//!
+//! Styles defined on the part itself (and on its sub-shapes) are shared by all occurrences.
+//! Components or sub-assemblies defining their own styles (colors, visibility, layers or SHUO)
+//! cannot share the presentation with other occurrences;
+//! such sub-tree is displayed by a dedicated XCAFPrs_AISObject instead.
+class XCAFPrs_AISAssembly : public AIS_MultipleConnectedInteractive
+{
+  DEFINE_STANDARD_RTTIEXT(XCAFPrs_AISAssembly, AIS_MultipleConnectedInteractive)
+public:
+
+  //! Creates an object to visualise the shape label.
+  //! The instances tree is filled implicitly within first ::Compute().
+  Standard_EXPORT XCAFPrs_AISAssembly (const TDF_Label& theLabel);
+
+  //! Returns the label which was visualised by this presentation
+  const TDF_Label& GetLabel() const { return myLabel; }
+
+  //! Clears and fills the instances tree from the document.
+  //! By default, this method is called implicitly within first ::Compute();
+  //! application should call it (and redisplay the object) after modification
+  //! of the assembly structure or styles.
+  Standard_EXPORT void Rebuild();
+
+  //! Returns the number of prototypes (unique parts) shared by instances.
+  Standard_Integer NbPrototypes() const { return myPrototypes.Extent(); }
+
+  //! Returns the number of objects displayed without sharing (styled components).
+  Standard_Integer NbDedicated() const { return myDedicated.Length(); }
+
+  //! Sets the material aspect to all prototypes and dedicated objects.
+  Standard_EXPORT virtual void SetMaterial (const Graphic3d_MaterialAspect& theMaterial) Standard_OVERRIDE;
+
+protected:
+
+  //! Redefined method to fill the instances tree on first compute.
+  Standard_EXPORT virtual void Compute (const Handle(PrsMgr_PresentationManager3d)& thePrsMgr,
+                                        const Handle(Prs3d_Presentation)&           thePrs,
+                                        const Standard_Integer                      theMode) Standard_OVERRIDE;
+
+  //! Creates a prototype presentation for the part.
+  //! Can be redefined by subclasses in order to use XCAFPrs_AISObject subclass with custom default style.
+  Standard_EXPORT virtual Handle(XCAFPrs_AISObject) createPresentation (const TDF_Label& theLabel) const;
+
+  //! Adds instances for the shape label located at theLocation.
+  Standard_EXPORT void addInstances (const TDF_Label& theLabel,
+                                     const TopLoc_Location& theLocation);
+
+  //! Returns TRUE if the label defines styles which should not be shared between occurrences.
+  Standard_EXPORT Standard_Boolean hasOwnStyle (const TDF_Label& theLabel) const;
+
+protected:
+
+  NCollection_DataMap<TDF_Label, Handle(XCAFPrs_AISObject), TDF_LabelMapHasher>
+                                                myPrototypes; //!< map of part labels to their shared presentations
+  NCollection_Sequence<Handle(XCAFPrs_AISObject)> myDedicated;  //!< presentations of styled components
+  Handle(XCAFDoc_ColorTool)                     myColorTool;  //!< color tool of the document
+  Handle(XCAFDoc_LayerTool)                     myLayerTool;  //!< layer tool of the document
+  TDF_Label                                     myLabel;      //!< label pointing onto the shape
+  Standard_Boolean                              myToRebuild;  //!< flag indicating that instances tree should be filled within Compute()
+
+};
+
+DEFINE_STANDARD_HANDLE(XCAFPrs_AISAssembly, AIS_MultipleConnectedInteractive)
+
+#endif // _XCAFPrs_AISAssembly_HeaderFile
@@ -20,6 +20,8 @@
 #include <TDF_Label.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFPrs.hxx>
+#include <XCAFPrs_AISAssembly.hxx>
 #include <XCAFPrs_AISObject.hxx>
 #include <XCAFPrs_Driver.hxx>
 
@@ -41,7 +43,17 @@ Standard_Boolean XCAFPrs_Driver::Update (const TDF_Label& L,
   XCAFDoc_ShapeTool shapes;
   if ( ! shapes.IsShape(L) ) return Standard_False;
   
-  ais = new XCAFPrs_AISObject (L);
+  TDF_Label aRefLabel = L;
+  XCAFDoc_ShapeTool::GetReferredShape (L, aRefLabel);
+  if (XCAFPrs::GetInstancedMode()
+   && XCAFDoc_ShapeTool::IsAssembly (aRefLabel))
+  {
+    ais = new XCAFPrs_AISAssembly (L);
+  }
+  else
+  {
+    ais = new XCAFPrs_AISObject (L);
+  }
   
   return Standard_True;
 }
@@ -892,6 +892,28 @@ static Standard_Integer getviewName (Draw_Interpretor&  di, Standard_Integer /*a
 }
 
 
+//=======================================================================
+//function : setInstancedMode
+//purpose  :
+//=======================================================================
+static Standard_Integer setInstancedMode (Draw_Interpretor& di, Standard_Integer argc, const char** argv)
+{
+  if (argc == 1)
+  {
+    di << (XCAFPrs::GetInstancedMode() ? "1" : "0");
+    return 0;
+  }
+  else if (argc != 2)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  XCAFPrs::SetInstancedMode (Draw::Atoi (argv[1]) == 1);
+  return 0;
+}
+
+
 //=======================================================================
 //function : XSetTransparency
 //purpose  :
@@ -1184,6 +1206,10 @@ void XDEDRAW::Init(Draw_Interpretor& di)
   di.Add ("XGetViewNameMode", "\t: Print if  mode of displaying names is turn on.",
 		   __FILE__, getviewName, g);
 
+  di.Add ("XSetInstancedMode", "[1/0]\t: Set/Unset (or print) mode of displaying assemblies"
+          " with presentations shared between repeated parts.",
+		   __FILE__, setInstancedMode, g);
+
   di.Add ("XSetTransparency", "Doc Transparency [label1 label2 ...]\t: Set transparency for given label(s) or whole doc",
 		   __FILE__, XSetTransparency, g);
 
@@ -23,6 +23,7 @@
 #include <IGESCAFControl_Writer.hxx>
 #include <IGESControl_Controller.hxx>
 #include <Interface_Macros.hxx>
+#include <RWGltf_CafWriter.hxx>
 #include <STEPCAFControl_ExternFile.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <STEPCAFControl_Writer.hxx>
@@ -534,6 +535,58 @@ static Standard_Integer Expand (Draw_Interpretor& di, Standard_Integer argc, con
   return 0;
 }
 
+//=======================================================================
+//function : WriteGltf
+//purpose  : Write meshed document into binary glTF file
+//=======================================================================
+static Standard_Integer WriteGltf (Draw_Interpretor& di, Standard_Integer argc, const char** argv)
+{
+  if (argc < 3)
+  {
+    di << "Use: " << argv[0] << " Doc filename [-unitScale factor=0.001] [-zUp {on|off}=on]\n";
+    return 1;
+  }
+
+  Handle(TDocStd_Document) aDoc;
+  DDocStd::GetDocument (argv[1], aDoc);
+  if (aDoc.IsNull())
+  {
+    di << argv[1] << " is not a document\n";
+    return 1;
+  }
+
+  Handle(RWGltf_CafWriter) aWriter = new RWGltf_CafWriter (argv[2]);
+  for (Standard_Integer anArgIter = 3; anArgIter < argc; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (argv[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-unitscale"
+     && anArgIter + 1 < argc)
+    {
+      aWriter->SetLengthUnitScale (Draw::Atof (argv[++anArgIter]));
+    }
+    else if (anArg == "-zup"
+          && anArgIter + 1 < argc)
+    {
+      TCollection_AsciiString aValue (argv[++anArgIter]);
+      aValue.LowerCase();
+      aWriter->SetConvertZUpToYUp (aValue == "on" || aValue == "1");
+    }
+    else
+    {
+      di << "Syntax error at '" << argv[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+
+  if (!aWriter->Perform (aDoc))
+  {
+    di << "Error: document has not been written into " << argv[2] << "\n";
+    return 1;
+  }
+  return 0;
+}
+
 void XDEDRAW_Common::InitCommands(Draw_Interpretor& di)
 {
   static Standard_Boolean initactor = Standard_False;
@@ -549,6 +602,7 @@ void XDEDRAW_Common::InitCommands(Draw_Interpretor& di)
   di.Add("WriteIges" , "Doc filename: Write DECAF document to IGES file" ,__FILE__, WriteIges, g);
   di.Add("ReadStep" , "Doc filename: Read STEP file to DECAF document" ,__FILE__, ReadStep, g);
   di.Add("WriteStep" , "Doc filename [mode=a [multifile_prefix] [label]]: Write DECAF document to STEP file" ,__FILE__, WriteStep, g);  
+  di.Add("WriteGltf" , "Doc filename [-unitScale factor=0.001] [-zUp {on|off}=on]: Write meshed DECAF document to binary glTF (GLB) file" ,__FILE__, WriteGltf, g);
   
   di.Add("XFileList","Print list of files that was transfered by the last transfer" ,__FILE__, GetDicWSList , g);
   di.Add("XFileCur", ": returns name of file which is set as current",__FILE__, GetCurWS, g);
@@ -119,9 +119,13 @@ TopoDS_Shape XSAlgo_AlgoContainer::ProcessShape (const TopoDS_Shape& shape,
   Standard_CString seq = Interface_Static::CVal ( pseq );
   if ( ! seq ) seq = pseq;
   
+  // the loaded resource manager is shared by the contexts, possibly used
+  // in parallel threads: the runtime values are set in a private copy
+  Handle(Resource_Manager) rsc = new Resource_Manager (*context->ResourceManager());
+  context->SetResourceManager ( rsc );
+
   // if resource file is not loaded or does not define <seq>.exec.op, 
   // do default fixes
-  Handle(Resource_Manager) rsc = context->ResourceManager();
   TCollection_AsciiString str ( seq );
   str += ".exec.op";
   if ( ! rsc->Find ( str.ToCString() ) ) {
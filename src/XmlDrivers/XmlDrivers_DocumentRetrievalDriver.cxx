@@ -89,4 +89,12 @@ void XmlDrivers_DocumentRetrievalDriver::ShapeSetCleaning(
     aNamedShapeDriver -> Clear();
 }
 
-
+//=======================================================================
+//function : IsPasteDeferred
+//purpose  : 
+//=======================================================================
+Standard_Boolean XmlDrivers_DocumentRetrievalDriver::IsPasteDeferred
+                              (const Handle(XmlMDF_ADriver)& theDriver) const
+{
+  return theDriver->IsKind (STANDARD_TYPE(XmlMNaming_NamedShapeDriver));
+}
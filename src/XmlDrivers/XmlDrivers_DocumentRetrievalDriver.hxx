@@ -47,6 +47,9 @@ public:
   
   Standard_EXPORT virtual void PropagateDocumentVersion (const Standard_Integer theDocVersion) Standard_OVERRIDE;
 
+  //! Defers the named shapes in streaming mode as they refer to the shapes section.
+  Standard_EXPORT virtual Standard_Boolean IsPasteDeferred (const Handle(XmlMDF_ADriver)& theDriver) const Standard_OVERRIDE;
+
 
 
 
@@ -41,6 +41,9 @@
 #include <XmlObjMgt.hxx>
 #include <XmlObjMgt_Document.hxx>
 #include <XmlObjMgt_RRelocationTable.hxx>
+#include <Storage_Schema.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <NCollection_Sequence.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDriver)
 
@@ -157,6 +160,7 @@ static TCollection_AsciiString AbsolutePath(
 //purpose  : Constructor
 //=======================================================================
 XmlLDrivers_DocumentRetrievalDriver::XmlLDrivers_DocumentRetrievalDriver()
+: myIsStreaming (Standard_False)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -213,6 +217,12 @@ void XmlLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&              t
   Handle(Message_Messenger) aMessageDriver = theApplication -> MessageDriver();
   ::take_time (~0, " +++++ Start RETRIEVE procedures ++++++", aMessageDriver);
 
+  if (myIsStreaming)
+  {
+    ReadStreaming (theIStream, theNewDocument, theApplication);
+    return;
+  }
+
   // 1. Read DOM_Document from file
   LDOMParser aParser;
 
@@ -233,6 +243,241 @@ void XmlLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&              t
   ReadFromDomDocument (anElement, theNewDocument, theApplication);
 }
 
+//=======================================================================
+//class    : StreamParser
+//purpose  : Pastes the attributes at the end of their elements and lets
+//           the parser release the elements of the label tree
+//=======================================================================
+
+IMPLEMENT_DOMSTRING (LabelString, "label")
+IMPLEMENT_DOMSTRING (TagString,   "tag")
+
+class XmlLDrivers_DocumentRetrievalDriver::StreamParser : public LDOMParser
+{
+public:
+
+  StreamParser (XmlLDrivers_DocumentRetrievalDriver& theDriver,
+                const Handle(CDM_Document)&           theNewDocument,
+                const Handle(CDM_Application)&        theApplication)
+  : myDriver         (theDriver),
+    myDocument       (theNewDocument),
+    myApplication    (theApplication),
+    myData           (new TDF_Data()),
+    myStatus         (PCDM_RS_OK),
+    myDepth          (0),
+    myAttributeDepth (0),
+    myIsInfoRead     (Standard_False)
+  {
+    XmlMDF::CreateDrvMap (theDriver.myDrivers, myDriverMap);
+  }
+
+  //! Returns the data framework filled by the parser.
+  const Handle(TDF_Data)& Data() const { return myData; }
+
+  //! Returns the status of the retrieval, not OK if aborted by the parser.
+  PCDM_ReaderStatus Status() const { return myStatus; }
+
+  //! Reads the info section if the document has no label tree.
+  Standard_Boolean ReadInfoSection()
+  {
+    if (myIsInfoRead)
+      return Standard_True;
+    myIsInfoRead = Standard_True;
+    return myDriver.ReadInfoSection (getDocument().getDocumentElement(),
+                                     myDocument, myApplication);
+  }
+
+  //! Pastes the attributes deferred until the end of the file.
+  Standard_Boolean PasteDeferred()
+  {
+    for (Standard_Integer anIndex = 1; anIndex <= myDeferredElements.Length(); ++anIndex)
+    {
+      if (XmlMDF::ReadAttribute (myDeferredElements (anIndex), myDeferredLabels (anIndex),
+                                 myDriver.myRelocTable, myDriverMap) < 0)
+        return Standard_False;
+    }
+    myDeferredElements.Clear();
+    myDeferredLabels.Clear();
+    return Standard_True;
+  }
+
+protected:
+
+  virtual Standard_Boolean startElement() Standard_OVERRIDE
+  {
+    ++myDepth;
+    if (myAttributeDepth > 0)
+      return Standard_False; // contents of an attribute
+
+    const XmlObjMgt_Element anElem = getCurrentElement();
+    const Standard_Boolean isLabel = anElem.getTagName().equals (::LabelString());
+    if (myLabels.IsEmpty())
+    {
+      // children of the document element are info, comments, labels and shapes;
+      // the info precedes the label tree and gives the version to the drivers
+      if (myDepth != 2 || !isLabel)
+        return Standard_False;
+      if (!ReadInfoSection())
+      {
+        myStatus = PCDM_RS_NoVersion;
+        return Standard_True;
+      }
+      myLabels.Append (myData->Root());
+    }
+    else if (isLabel)
+    {
+      Standard_Integer aTag;
+      XmlObjMgt_DOMString aTagStr (anElem.getAttribute (::TagString()));
+      if (!aTagStr.GetInteger (aTag))
+      {
+        myApplication->MessageDriver()->Send
+          (TCollection_ExtendedString ("Wrong Tag value for OCAF Label: ") + aTagStr, Message_Fail);
+        myStatus = PCDM_RS_MakeFailure;
+        return Standard_True;
+      }
+      myLabels.Append (myLabels.Last().FindChild (aTag, Standard_True));
+    }
+    else
+    {
+      myAttributeDepth = myDepth;
+      return Standard_False;
+    }
+    // sub-labels and attributes are released as soon as they are processed
+    detachChildren();
+    return Standard_False;
+  }
+
+  virtual Standard_Boolean endElement() Standard_OVERRIDE
+  {
+    const Standard_Integer aDepth = myDepth--;
+    if (myAttributeDepth > 0)
+    {
+      if (aDepth > myAttributeDepth)
+        return Standard_False;
+      myAttributeDepth = 0;
+
+      const XmlObjMgt_Element anElem = getCurrentElement();
+      const Standard_Boolean isToDefer = isDeferred (anElem);
+      if (isToDefer)
+      {
+        // keeping the element keeps its memory
+        myDeferredElements.Append (anElem);
+        myDeferredLabels.Append (myLabels.Last());
+      }
+      // the deferred attribute is attached at once to keep the order of attributes on the label
+      if (XmlMDF::ReadAttribute (anElem, myLabels.Last(), myDriver.myRelocTable, myDriverMap, !isToDefer) < 0)
+      {
+        myStatus = PCDM_RS_MakeFailure;
+        return Standard_True;
+      }
+    }
+    else if (!myLabels.IsEmpty() && aDepth == myLabels.Length() + 1)
+      myLabels.Remove (myLabels.Length());
+    return Standard_False;
+  }
+
+private:
+
+  //! Returns True if the attribute is to be pasted after the whole file is read.
+  Standard_Boolean isDeferred (const XmlObjMgt_Element& theElement) const
+  {
+    TCollection_AsciiString aName = theElement.getTagName().GetString();
+    TCollection_AsciiString aNewName;
+    if (Storage_Schema::CheckTypeMigration (aName, aNewName))
+      aName = aNewName;
+    const Handle(XmlMDF_ADriver)* aDriver = myDriverMap.Seek (aName);
+    return aDriver != NULL && myDriver.IsPasteDeferred (*aDriver);
+  }
+
+  StreamParser (const StreamParser&);
+  StreamParser& operator= (const StreamParser&);
+
+private:
+
+  XmlLDrivers_DocumentRetrievalDriver& myDriver;
+  Handle(CDM_Document)                 myDocument;
+  Handle(CDM_Application)              myApplication;
+  Handle(TDF_Data)                     myData;
+  XmlMDF_MapOfDriver                   myDriverMap;
+  TDF_LabelSequence                    myLabels;       //!< labels of the open label elements
+  NCollection_Sequence<XmlObjMgt_Element> myDeferredElements;
+  TDF_LabelSequence                    myDeferredLabels;
+  PCDM_ReaderStatus                    myStatus;
+  Standard_Integer                     myDepth;
+  Standard_Integer                     myAttributeDepth;
+  Standard_Boolean                     myIsInfoRead;
+};
+
+//=======================================================================
+//function : ReadStreaming
+//purpose  : 
+//=======================================================================
+
+void XmlLDrivers_DocumentRetrievalDriver::ReadStreaming
+                                (Standard_IStream&              theIStream,
+                                 const Handle(CDM_Document)&    theNewDocument,
+                                 const Handle(CDM_Application)& theApplication)
+{
+  const Handle(Message_Messenger) aMsgDriver = theApplication -> MessageDriver();
+  Handle(TDocStd_Document) aDoc = Handle(TDocStd_Document)::DownCast (theNewDocument);
+  if (aDoc.IsNull())
+  {
+    myReaderStatus = PCDM_RS_NoDocument;
+    return;
+  }
+  if (myDrivers.IsNull()) myDrivers = AttributeDrivers (aMsgDriver);
+  myRelocTable.Clear();
+
+  StreamParser aParser (*this, theNewDocument, theApplication);
+  Handle(XmlMDF_ADriver) aNSDriver;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    // if myFileName is not empty, "document" tag is required to be read
+    // from the received document
+    if (aParser.parse (theIStream, Standard_False, myFileName.IsEmpty()))
+    {
+      if (aParser.Status() != PCDM_RS_OK)
+        myReaderStatus = aParser.Status();
+      else
+      {
+        TCollection_AsciiString aData;
+        cout << aParser.GetError(aData) << ": " << aData << endl;
+        myReaderStatus = PCDM_RS_FormatFailure;
+      }
+      myRelocTable.Clear();
+      return;
+    }
+    ::take_time (0, " +++++ Fin parsing XML and reading labels : ", aMsgDriver);
+
+    const XmlObjMgt_Element anElement = aParser.getDocument().getDocumentElement();
+    if (!aParser.ReadInfoSection())
+    {
+      myRelocTable.Clear();
+      return;
+    }
+    aNSDriver = ReadShapeSection (anElement, aMsgDriver);
+    if (!aParser.PasteDeferred())
+      myReaderStatus = PCDM_RS_MakeFailure;
+    else
+    {
+      aDoc->SetData (aParser.Data());
+      TDocStd_Owner::SetDocument (aParser.Data(), aDoc);
+      myReaderStatus = PCDM_RS_OK;
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_ExtendedString anErrorString (anException.GetMessageString());
+    aMsgDriver ->Send (anErrorString.ToExtString(), Message_Fail);
+    myReaderStatus = PCDM_RS_MakeFailure;
+  }
+
+  ShapeSetCleaning (aNSDriver);
+  myRelocTable.Clear();
+  ::take_time (0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+}
+
 //=======================================================================
 //function : ReadFromDomDocument
 //purpose  : management of the macro-structure of XML document data
@@ -244,6 +489,57 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
                                 (const XmlObjMgt_Element&       theElement,
                                  const Handle(CDM_Document)&    theNewDocument,
                                  const Handle(CDM_Application)& theApplication)
+{
+  const Handle(Message_Messenger) aMsgDriver =
+    theApplication -> MessageDriver();
+  // 1. Read info and comments
+  if (!ReadInfoSection (theElement, theNewDocument, theApplication))
+    return;
+
+  // 2. Read Shapes section
+  if (myDrivers.IsNull()) myDrivers = AttributeDrivers (aMsgDriver);  
+  const Handle(XmlMDF_ADriver) aNSDriver = ReadShapeSection(theElement, aMsgDriver);
+  if(!aNSDriver.IsNull())
+    ::take_time (0, " +++++ Fin reading Shapes :    ", aMsgDriver);
+
+  // 5. Read document contents
+  try
+  {
+    OCC_CATCH_SIGNALS
+#ifdef OCCT_DEBUG
+    TCollection_ExtendedString aMessage ("PasteDocument");
+    aMsgDriver ->Send (aMessage.ToExtString(), Message_Trace);
+#endif
+    if (!MakeDocument(theElement, theNewDocument))
+      myReaderStatus = PCDM_RS_MakeFailure;
+    else
+      myReaderStatus = PCDM_RS_OK;
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_ExtendedString anErrorString (anException.GetMessageString());
+    aMsgDriver ->Send (anErrorString.ToExtString(), Message_Fail);
+  }
+
+  //    Wipe off the shapes written to the <shapes> section
+  ShapeSetCleaning(aNSDriver);
+
+  //    Clean the relocation table.
+  //    If the application needs to use myRelocTable to retrieve additional
+  //    data from LDOM, this method should be reimplemented avoiding this step
+  myRelocTable.Clear();
+  ::take_time (0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+}
+
+//=======================================================================
+//function : ReadInfoSection
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean XmlLDrivers_DocumentRetrievalDriver::ReadInfoSection
+                                (const XmlObjMgt_Element&       theElement,
+                                 const Handle(CDM_Document)&    theNewDocument,
+                                 const Handle(CDM_Application)& theApplication)
 {
   const Handle(Message_Messenger) aMsgDriver =
     theApplication -> MessageDriver();
@@ -276,7 +572,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
       myReaderStatus = PCDM_RS_NoVersion;
       if(!aMsgDriver.IsNull()) 
         aMsgDriver->Send(aMsg.ToExtString(), Message_Fail);
-      return;
+      return Standard_False;
     }
 
     if( aCurDocVersion < 2) aCurDocVersion = 2;
@@ -431,40 +727,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
       }
     }
   }
-
-  // 2. Read Shapes section
-  if (myDrivers.IsNull()) myDrivers = AttributeDrivers (aMsgDriver);  
-  const Handle(XmlMDF_ADriver) aNSDriver = ReadShapeSection(theElement, aMsgDriver);
-  if(!aNSDriver.IsNull())
-    ::take_time (0, " +++++ Fin reading Shapes :    ", aMsgDriver);
-
-  // 5. Read document contents
-  try
-  {
-    OCC_CATCH_SIGNALS
-#ifdef OCCT_DEBUG
-    TCollection_ExtendedString aMessage ("PasteDocument");
-    aMsgDriver ->Send (aMessage.ToExtString(), Message_Trace);
-#endif
-    if (!MakeDocument(theElement, theNewDocument))
-      myReaderStatus = PCDM_RS_MakeFailure;
-    else
-      myReaderStatus = PCDM_RS_OK;
-  }
-  catch (Standard_Failure const& anException)
-  {
-    TCollection_ExtendedString anErrorString (anException.GetMessageString());
-    aMsgDriver ->Send (anErrorString.ToExtString(), Message_Fail);
-  }
-
-  //    Wipe off the shapes written to the <shapes> section
-  ShapeSetCleaning(aNSDriver);
-
-  //    Clean the relocation table.
-  //    If the application needs to use myRelocTable to retrieve additional
-  //    data from LDOM, this method should be reimplemented avoiding this step
-  myRelocTable.Clear();
-  ::take_time (0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+  return Standard_True;
 }
 
 //=======================================================================
@@ -490,6 +753,16 @@ Standard_Boolean XmlLDrivers_DocumentRetrievalDriver::MakeDocument
   return aResult;
 }
 
+//=======================================================================
+//function : IsPasteDeferred
+//purpose  : 
+//=======================================================================
+Standard_Boolean XmlLDrivers_DocumentRetrievalDriver::IsPasteDeferred
+                                (const Handle(XmlMDF_ADriver)& /*theDriver*/) const
+{
+  return Standard_False;
+}
+
 //=======================================================================
 //function : AttributeDrivers
 //purpose  : 
@@ -58,6 +58,15 @@ public:
   
   Standard_EXPORT virtual Handle(XmlMDF_ADriverTable) AttributeDrivers (const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Sets the flag of streaming retrieval. In this mode the attributes are
+  //! pasted into the document as soon as their elements are parsed, and the
+  //! parsed elements are released at once; the complete DOM tree of the
+  //! file is never built. Disabled by default.
+  void SetStreamingMode (const Standard_Boolean theIsStreaming) { myIsStreaming = theIsStreaming; }
+
+  //! Returns the flag of streaming retrieval.
+  Standard_Boolean IsStreamingMode() const { return myIsStreaming; }
+
 
 
 
@@ -67,6 +76,10 @@ protected:
 
   
   Standard_EXPORT virtual void ReadFromDomDocument (const XmlObjMgt_Element& theDomElement, const Handle(CDM_Document)& theNewDocument, const Handle(CDM_Application)& theApplication);
+
+  //! Reads the "info" and "comments" sections of the document element.
+  //! Returns False if the document version is not supported.
+  Standard_EXPORT Standard_Boolean ReadInfoSection (const XmlObjMgt_Element& theDomElement, const Handle(CDM_Document)& theNewDocument, const Handle(CDM_Application)& theApplication);
   
   Standard_EXPORT virtual Standard_Boolean MakeDocument (const XmlObjMgt_Element& thePDoc, const Handle(CDM_Document)& theTDoc);
   
@@ -76,6 +89,12 @@ protected:
   
   Standard_EXPORT virtual void PropagateDocumentVersion (const Standard_Integer theDocVersion);
 
+  //! Returns True if the attributes of the driver refer to the data stored
+  //! after the label tree (e.g. to the shapes section); in streaming mode
+  //! such attributes are pasted when the whole file has been parsed.
+  //! The default implementation returns False.
+  Standard_EXPORT virtual Standard_Boolean IsPasteDeferred (const Handle(XmlMDF_ADriver)& theDriver) const;
+
   Handle(XmlMDF_ADriverTable) myDrivers;
   XmlObjMgt_RRelocationTable myRelocTable;
   TCollection_ExtendedString myFileName;
@@ -83,6 +102,15 @@ protected:
 
 private:
 
+  //! Parser pasting the attributes while the file is read (streaming mode).
+  class StreamParser;
+
+  //! Retrieves the document in streaming mode.
+  void ReadStreaming (Standard_IStream&              theIStream,
+                      const Handle(CDM_Document)&    theNewDocument,
+                      const Handle(CDM_Application)& theApplication);
+
+  Standard_Boolean myIsStreaming;
 
 
 
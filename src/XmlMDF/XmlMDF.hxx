@@ -71,6 +71,19 @@ public:
   //! Adds the attribute storage drivers to <aDriverSeq>.
   Standard_EXPORT static void AddDrivers (const Handle(XmlMDF_ADriverTable)& aDriverTable, const Handle(Message_Messenger)& theMessageDriver);
 
+  //! Reads the attribute from the persistent element <theElement>
+  //! and attaches it to <theLabel>.
+  //! If <theToPaste> is False, the empty attribute is only attached and
+  //! registered in <aReloc>; it is filled by the next call for the same
+  //! element and label.
+  //! Returns 1 if the attribute has been read, 0 if its type has no
+  //! driver in <aDrivers> and -1 on error.
+  Standard_EXPORT static Standard_Integer ReadAttribute (const XmlObjMgt_Element& theElement, const TDF_Label& theLabel, XmlObjMgt_RRelocationTable& aReloc, const XmlMDF_MapOfDriver& aDrivers, const Standard_Boolean theToPaste = Standard_True);
+
+  //! Fills <anAsciiDriverMap> by the drivers of <aDriverTable>
+  //! indexed by the names of their attribute types.
+  Standard_EXPORT static void CreateDrvMap (const Handle(XmlMDF_ADriverTable)& aDriverTable, XmlMDF_MapOfDriver& anAsciiDriverMap);
+
 
 
 
@@ -86,8 +99,6 @@ private:
   Standard_EXPORT static Standard_Integer WriteSubTree (const TDF_Label& theLabel, XmlObjMgt_Element& theElement, XmlObjMgt_SRelocationTable& aReloc, const Handle(XmlMDF_ADriverTable)& aDrivers);
   
   Standard_EXPORT static Standard_Integer ReadSubTree (const XmlObjMgt_Element& theElement, const TDF_Label& theLabel, XmlObjMgt_RRelocationTable& aReloc, const XmlMDF_MapOfDriver& aDrivers);
-  
-  Standard_EXPORT static void CreateDrvMap (const Handle(XmlMDF_ADriverTable)& aDriverTable, XmlMDF_MapOfDriver& anAsciiDriverMap);
 
 
 